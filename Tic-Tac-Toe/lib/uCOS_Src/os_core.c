@@ -71,6 +71,9 @@ void  OSInit (OS_ERR  *p_err)
 
     OSTCBCurPtr           = (OS_TCB *)0;                        /* Initialize OS_TCB pointers to a known state          */
     OSTCBHighRdyPtr       = (OS_TCB *)0;
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+    OSTCBPreemptPtr       = (OS_TCB *)0;
+#endif
 
     OSPrioCur             =           0u;                       /* Initialize priority variables to a known state       */
     OSPrioHighRdy         =           0u;
@@ -167,6 +170,30 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_RING_EN > 0u)                                       /* Initialize the Ring Manager module                   */
+#if (OS_CFG_DBG_EN > 0u)
+    OSRingDbgListPtr = (OS_RING *)0;
+    OSRingQty        =            0u;
+#endif
+#endif
+
+
+#if (OS_CFG_STREAM_EN > 0u)                                     /* Initialize the Stream Manager module                 */
+#if (OS_CFG_DBG_EN > 0u)
+    OSStreamDbgListPtr = (OS_STREAM *)0;
+    OSStreamQty        =              0u;
+#endif
+#endif
+
+
+#if (OS_CFG_TOPIC_EN > 0u)                                      /* Initialize the Topic Manager module                  */
+#if (OS_CFG_DBG_EN > 0u)
+    OSTopicDbgListPtr = (OS_TOPIC *)0;
+    OSTopicQty        =             0u;
+#endif
+#endif
+
+
 #if (OS_CFG_SEM_EN > 0u)                                        /* Initialize the Semaphore Manager module              */
 #if (OS_CFG_DBG_EN > 0u)
     OSSemDbgListPtr = (OS_SEM *)0;
@@ -293,6 +320,9 @@ void  OSIntEnter (void)
 *                 at the end of the ISR.
 *
 *              2) Rescheduling is prevented when the scheduler is locked (see OSSchedLock())
+*
+*              3) A task is not preempted by the tasks which are not above its preemption threshold (see
+*                 OSTaskPreemptThresholdSet()).
 ************************************************************************************************************************
 */
 
@@ -340,6 +370,9 @@ void  OSIntExit (void)
 #endif
 
     OSPrioHighRdy   = OS_PrioGetHighest();                      /* Find highest priority                                */
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+    OSPrioHighRdy   = OS_SchedThreshold(OSPrioHighRdy);         /* See Note #3                                          */
+#endif
 #if (OS_CFG_TASK_IDLE_EN > 0u)
     OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;         /* Get highest priority task ready-to-run               */
     if (OSTCBHighRdyPtr == OSTCBCurPtr) {                       /* Current task still the highest priority?             */
@@ -368,6 +401,10 @@ void  OSIntExit (void)
     }
 #endif
 
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+    OS_SchedThresholdSw();                                      /* Track the tasks preempted above their threshold      */
+#endif
+
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
     OSTCBHighRdyPtr->CtxSwCtr++;                                /* Inc. # of context switches for this new task         */
 #endif
@@ -424,6 +461,9 @@ void  OSSafetyCriticalStart (void)
 * Returns    : none
 *
 * Note(s)    : 1) Rescheduling is prevented when the scheduler is locked (see OSSchedLock())
+*
+*              2) A task is not preempted by the tasks which are not above its preemption threshold (see
+*                 OSTaskPreemptThresholdSet()).
 ************************************************************************************************************************
 */
 
@@ -448,6 +488,9 @@ void  OSSched (void)
 
     CPU_INT_DIS();
     OSPrioHighRdy   = OS_PrioGetHighest();                      /* Find the highest priority ready                      */
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+    OSPrioHighRdy   = OS_SchedThreshold(OSPrioHighRdy);         /* See Note #2                                          */
+#endif
 #if (OS_CFG_TASK_IDLE_EN > 0u)
     OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;         /* Get highest priority task ready-to-run               */
     if (OSTCBHighRdyPtr == OSTCBCurPtr) {                       /* Current task still the highest priority?             */
@@ -466,6 +509,10 @@ void  OSSched (void)
 
     OS_TRACE_TASK_PREEMPT(OSTCBCurPtr);
 
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+    OS_SchedThresholdSw();                                      /* Track the tasks preempted above their threshold      */
+#endif
+
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
     OSTCBHighRdyPtr->CtxSwCtr++;                                /* Inc. # of context switches to this task              */
 #endif
@@ -710,7 +757,8 @@ void  OSSchedRoundRobinCfg (CPU_BOOLEAN   en,
 *
 *                             OS_ERR_NONE                   The call was successful
 *                             OS_ERR_ROUND_ROBIN_1          Only 1 task at this priority, nothing to yield to
-*                             OS_ERR_ROUND_ROBIN_DISABLED   Round Robin is not enabled
+*                             OS_ERR_ROUND_ROBIN_DISABLED   Round Robin is not enabled, or the task runs at the
+*                                                           Earliest-Deadline-First priority
 *                             OS_ERR_SCHED_LOCKED           The scheduler has been locked
 *                             OS_ERR_YIELD_ISR              Can't be called from an ISR
 *
@@ -753,6 +801,13 @@ void  OSSchedRoundRobinYield (OS_ERR  *p_err)
         return;
     }
 
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    if (OSPrioCur == OS_CFG_SCHED_EDF_PRIO) {                   /* Deadlines, not round-robin, order this priority      */
+       *p_err = OS_ERR_ROUND_ROBIN_DISABLED;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     p_rdy_list = &OSRdyList[OSPrioCur];                         /* Can't yield if it's the only task at that priority   */
     if (p_rdy_list->HeadPtr == p_rdy_list->TailPtr) {
@@ -996,6 +1051,9 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
 *
 *              timeout        Is the amount of time the task will wait for the event to occur.
 *
+*              opt            Are the options of the pend call.  OS_OPT_PEND_TIMEOUT_US specifies that 'timeout' is in
+*                             microseconds rather than in ticks.
+*
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
@@ -1005,7 +1063,8 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
 void  OS_Pend (OS_PEND_OBJ  *p_obj,
                OS_TCB       *p_tcb,
                OS_STATE      pending_on,
-               OS_TICK       timeout)
+               OS_TICK       timeout,
+               OS_OPT        opt)
 {
     OS_PEND_LIST  *p_pend_list;
 
@@ -1014,7 +1073,8 @@ void  OS_Pend (OS_PEND_OBJ  *p_obj,
     p_tcb->PendStatus = OS_STATUS_PEND_OK;
 
     OS_TaskBlock(p_tcb,                                         /* Block the task and add it to the tick list if needed */
-                 timeout);
+                 timeout,
+                 opt);
 
     if (p_obj != (OS_PEND_OBJ *)0) {                            /* Add the current task to the pend list ...            */
         p_pend_list             = &p_obj->PendList;             /* ... if there is an object to pend on                 */
@@ -1157,6 +1217,10 @@ void  OS_PendDbgNameAdd (OS_PEND_OBJ  *p_obj,
                  p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)"Task Sem");
                  break;
 
+            case OS_TASK_PEND_ON_MULTI:
+                 p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)"Multi");
+                 break;
+
             default:
                  p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)" ");
                  break;
@@ -1416,6 +1480,13 @@ void  OS_PendListRemove (OS_TCB  *p_tcb)
     OS_TCB        *p_prev;
 
 
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    if (p_tcb->PendDataTblPtr != (OS_PEND_DATA *)0) {           /* Waiting in OSPendMulti()?                            */
+        OS_PendMultiRemove(p_tcb);                              /* Yes, remove from the lists of all its objects        */
+        return;
+    }
+#endif
+
     if (p_tcb->PendObjPtr != (OS_PEND_OBJ *)0) {                /* Only remove if object has a pend list.               */
         p_pend_list = &p_tcb->PendObjPtr->PendList;             /* Get pointer to pend list                             */
 
@@ -1624,6 +1695,12 @@ void  OS_RdyListInit (void)
 *              The TCB is inserted at the tail of the list if the priority of the TCB is the same as the priority of the
 *              current task.  The TCB is inserted at the head of the list if not.
 *
+*              A task readied at OS_CFG_SCHED_EDF_PRIO is placed by its deadline.  It starts a new job only if it
+*              completed the previous one, a task which blocked within a job keeps its deadline.
+*
+*              A task readied at the priority of a task preempted above its preemption threshold is inserted at the
+*              tail, so the preempted task still resumes first.
+*
 * Arguments  : p_tcb     is a pointer to the TCB to insert into the ready list
 *              -----
 *
@@ -1636,8 +1713,19 @@ void  OS_RdyListInit (void)
 void  OS_RdyListInsert (OS_TCB  *p_tcb)
 {
     OS_PrioInsert(p_tcb->Prio);
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    if ((p_tcb->Prio           == OS_CFG_SCHED_EDF_PRIO) &&     /* Readying an EDF task which completed its job?        */
+        (p_tcb->DeadlineJobEnd == OS_TRUE)) {
+        p_tcb->DeadlineJobEnd = OS_FALSE;
+        OS_SchedEdfRelease(p_tcb);                              /* Yes, compute the deadline of its new job             */
+    }
+#endif
     if (p_tcb->Prio == OSPrioCur) {                             /* Are we readying a task at the same prio?             */
         OS_RdyListInsertTail(p_tcb);                            /* Yes, insert readied task at the end of the list      */
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+    } else if (OS_SchedThresholdHeld(p_tcb->Prio) == OS_TRUE) { /* Is a preempted task waiting at this prio?            */
+        OS_RdyListInsertTail(p_tcb);                            /* Yes, it resumes first                                */
+#endif
     } else {
         OS_RdyListInsertHead(p_tcb);                            /* No,  insert readied task at the beginning of the list*/
     }
@@ -1699,6 +1787,8 @@ void  OS_RdyListInsert (OS_TCB  *p_tcb)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The tasks at OS_CFG_SCHED_EDF_PRIO are kept in deadline order (see OS_RdyListInsertDeadline()).
 ************************************************************************************************************************
 */
 
@@ -1709,6 +1799,13 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 
 
 
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {                 /* See Note #2.                                         */
+        OS_RdyListInsertDeadline(p_tcb);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->HeadPtr == (OS_TCB *)0) {                   /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN > 0u)
@@ -1784,6 +1881,8 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The tasks at OS_CFG_SCHED_EDF_PRIO are kept in deadline order (see OS_RdyListInsertDeadline()).
 ************************************************************************************************************************
 */
 
@@ -1794,6 +1893,13 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 
 
 
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {                 /* See Note #2.                                         */
+        OS_RdyListInsertDeadline(p_tcb);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->HeadPtr == (OS_TCB *)0) {                   /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN > 0u)
@@ -1816,6 +1922,71 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 }
 
 
+/*
+************************************************************************************************************************
+*                                           INSERT TCB IN DEADLINE ORDER
+*
+* Description: This function is called to place an OS_TCB of the Earliest-Deadline-First priority in its list.  The list
+*              is kept sorted by absolute deadline, so its head is the task with the earliest deadline.
+*
+* Arguments  : p_tcb     is the OS_TCB to insert in the list
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The tasks without a deadline are placed ahead of the ones with a deadline, in FIFO order.  This is also
+*                 where a mutex owner which inherits this priority has to run.
+*
+*              3) Deadlines are compared on the difference of their tick values, so they wrap around with OSTickCtr.  A
+*                 task is placed after the tasks with the same deadline.
+*
+*              4) The list is scanned from its head, the cost grows with the number of ready tasks at this priority.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+void  OS_RdyListInsertDeadline (OS_TCB  *p_tcb)
+{
+    OS_RDY_LIST  *p_rdy_list;
+    OS_TCB       *p_tcb2;
+
+
+
+    p_rdy_list = &OSRdyList[p_tcb->Prio];
+    p_tcb2     =  p_rdy_list->HeadPtr;
+    while ((p_tcb2              != (OS_TCB *)0) &&              /* Skip the tasks without a deadline, see Note #2       */
+           (p_tcb2->DeadlineRel ==           0u)) {
+        p_tcb2 = p_tcb2->NextPtr;
+    }
+    if (p_tcb->DeadlineRel != 0u) {
+        while ((p_tcb2 != (OS_TCB *)0) &&                       /* Skip the earlier or equal deadlines, see Note #3     */
+               ((OS_TICK)(p_tcb->Deadline - p_tcb2->Deadline) <= ((OS_TICK)~(OS_TICK)0 >> 1u))) {
+            p_tcb2 = p_tcb2->NextPtr;
+        }
+    }
+
+#if (OS_CFG_DBG_EN > 0u)
+    p_rdy_list->NbrEntries++;                                   /* One more OS_TCB in the list                          */
+#endif
+    p_tcb->NextPtr = p_tcb2;
+    if (p_tcb2 == (OS_TCB *)0) {                                /* Insert at the tail of the list                       */
+        p_tcb->PrevPtr      = p_rdy_list->TailPtr;
+        p_rdy_list->TailPtr = p_tcb;
+    } else {                                                    /* Insert BEFORE p_tcb2                                 */
+        p_tcb->PrevPtr      = p_tcb2->PrevPtr;
+        p_tcb2->PrevPtr     = p_tcb;
+    }
+    if (p_tcb->PrevPtr == (OS_TCB *)0) {                        /* New head of the list?                                */
+        p_rdy_list->HeadPtr    = p_tcb;
+    } else {
+        p_tcb->PrevPtr->NextPtr = p_tcb;
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                MOVE TCB AT HEAD TO TAIL
@@ -1988,6 +2159,12 @@ void  OS_RdyListRemove (OS_TCB  *p_tcb)
     p_tcb->PrevPtr = (OS_TCB *)0;
     p_tcb->NextPtr = (OS_TCB *)0;
 
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+    if (OSTCBPreemptPtr != (OS_TCB *)0) {                       /* A preempted task no longer ready can't be resumed    */
+        OS_SchedThresholdRemove(p_tcb);
+    }
+#endif
+
     OS_TRACE_TASK_SUSPENDED(p_tcb);
 }
 
@@ -2085,6 +2262,13 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
     }
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {                 /* No time slicing of the Earliest-Deadline-First tasks */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#endif
+
     if (p_tcb->TimeQuantaCtr > 0u) {
         p_tcb->TimeQuantaCtr--;
     }
@@ -2116,6 +2300,219 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                          RELEASE AN EARLIEST-DEADLINE-FIRST JOB
+*
+* Description: This function is called when a task at OS_CFG_SCHED_EDF_PRIO starts a new job, to compute the absolute
+*              deadline of that job.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task being readied
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A job is never released less than DeadlinePeriod ticks after the previous one.  A task readied earlier
+*                 than its period allows gets the deadline it would have had, so it cannot take more than its share of
+*                 the CPU away from the other Earliest-Deadline-First tasks.
+*
+*              3) This function is called with interrupts disabled.
+*
+*              4) A job starts when the task is made ready after it completed the previous one, see
+*                 OSTaskWaitNextPeriod() & OSTaskDeadlineJobEnd().  The task may block within a job, on a mutex or a
+*                 delay, & keeps its deadline when it is made ready again.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+void  OS_SchedEdfRelease (OS_TCB  *p_tcb)
+{
+    OS_TICK  time;
+
+
+    if (p_tcb->DeadlineRel != 0u) {                             /* Does the task have a deadline?                       */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        time = OSTickCtr + OS_DynTickGet();
+#else
+        time = OSTickCtr;
+#endif
+                                                                /* Not within a period of the previous job, see Note #2 */
+        if ((time - p_tcb->DeadlineRelease) < p_tcb->DeadlinePeriod) {
+            time = p_tcb->DeadlineRelease + p_tcb->DeadlinePeriod;
+        }
+        p_tcb->DeadlineRelease = time;
+        p_tcb->Deadline        = time + p_tcb->DeadlineRel;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          APPLY THE PREEMPTION THRESHOLD
+*
+* Description: This function is called by the scheduler to hold back the ready tasks which are not allowed to preempt
+*              the task that owns the CPU.
+*
+* Arguments  : prio      is the highest priority ready
+*
+* Returns    : The priority to run: 'prio' or the priority of the task holding the CPU.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The threshold is that of the current task while it is ready.  When it gives up the CPU, the last task
+*                 preempted above its threshold (OSTCBPreemptPtr) sets the threshold until it resumes.  Each preemption
+*                 is by a task above the threshold of the task it preempts, so the last one preempted has the lowest
+*                 threshold of all.
+*
+*              3) Tasks at the priority of the task holding the CPU are not held back, they still share it by round-robin
+*                 or Earliest-Deadline-First.
+*
+*              4) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+OS_PRIO  OS_SchedThreshold (OS_PRIO  prio)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = OSTCBCurPtr;
+    if ((p_tcb->TaskState     != OS_TASK_STATE_RDY) ||          /* Is the current task giving up the CPU ...            */
+        (p_tcb->PrioThreshold >= p_tcb->Prio)) {                /* ... or without a threshold?                          */
+        p_tcb = OSTCBPreemptPtr;                                /* Yes, see Note #2                                     */
+        if (p_tcb == (OS_TCB *)0) {
+            return (prio);
+        }
+    }
+
+    if ((prio >= p_tcb->PrioThreshold) &&                       /* Not above the threshold ...                          */
+        (prio != p_tcb->Prio)) {                                /* ... & not at the task's priority (see Note #3)?      */
+        prio = p_tcb->Prio;                                     /* Yes, the task keeps the CPU                          */
+    }
+
+    return (prio);
+}
+
+
+/*
+************************************************************************************************************************
+*                                   CHECK FOR A PREEMPTED TASK AT A PRIORITY
+*
+* Description: This function is called to find whether a task preempted above its preemption threshold waits at a
+*              priority.
+*
+* Arguments  : prio      is the priority to check
+*
+* Returns    : OS_TRUE   if such a task waits at 'prio'
+*              OS_FALSE  if not
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_SchedThresholdHeld (OS_PRIO  prio)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = OSTCBPreemptPtr;
+    while (p_tcb != (OS_TCB *)0) {
+        if (p_tcb->Prio == prio) {
+            return (OS_TRUE);
+        }
+        p_tcb = p_tcb->PreemptNextPtr;
+    }
+
+    return (OS_FALSE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                   REMOVE A TASK FROM THE LIST OF PREEMPTED TASKS
+*
+* Description: This function is called when a task is removed from the ready list, it no longer holds back the other
+*              tasks.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Nothing is done if the task is not in the list.
+************************************************************************************************************************
+*/
+
+void  OS_SchedThresholdRemove (OS_TCB  *p_tcb)
+{
+    OS_TCB  **p_link;
+
+
+    p_link = &OSTCBPreemptPtr;
+    while (*p_link != (OS_TCB *)0) {
+        if (*p_link == p_tcb) {
+            *p_link               = p_tcb->PreemptNextPtr;
+             p_tcb->PreemptNextPtr = (OS_TCB *)0;
+            return;
+        }
+        p_link = &(*p_link)->PreemptNextPtr;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                   TRACK THE TASKS PREEMPTED ABOVE THEIR THRESHOLD
+*
+* Description: This function is called by the scheduler before switching from OSTCBCurPtr to OSTCBHighRdyPtr.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A ready task with a threshold, which loses the CPU to a higher priority task, is pushed on the list of
+*                 preempted tasks.  It is popped when it resumes.
+*
+*              3) The switch itself is deferred (PendSV), so an ISR ending between OSSched() and the switch runs this
+*                 function again with the same OSTCBCurPtr.  The task is then already at the head of the list, which is
+*                 the only place it can be while it still owns the CPU, and must not be pushed twice: it would link to
+*                 itself and OS_SchedThresholdHeld() or OS_SchedThresholdRemove() would never return.
+*
+*              4) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_SchedThresholdSw (void)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = OSTCBCurPtr;
+    if ((p_tcb->TaskState     == OS_TASK_STATE_RDY) &&          /* Is a task with a threshold being preempted ...       */
+        (p_tcb->PrioThreshold <  p_tcb->Prio)       &&
+        (OSPrioHighRdy        != p_tcb->Prio)       &&
+        (OSTCBPreemptPtr      != p_tcb)) {                      /* ... & not pushed already (see Note #3)?              */
+        p_tcb->PreemptNextPtr = OSTCBPreemptPtr;                /* Yes, push it (see Note #2)                           */
+        OSTCBPreemptPtr       = p_tcb;
+    }
+
+    p_tcb = OSTCBHighRdyPtr;
+    if (p_tcb == OSTCBPreemptPtr) {                             /* Is the last preempted task resuming?                 */
+        OSTCBPreemptPtr       = p_tcb->PreemptNextPtr;          /* Yes, pop it                                          */
+        p_tcb->PreemptNextPtr = (OS_TCB *)0;
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                     BLOCK A TASK
@@ -2128,19 +2525,38 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 *
 *              timeout        is the desired timeout
 *
+*              opt            OS_OPT_PEND_TIMEOUT_US if 'timeout' is in microseconds (see Note #2)
+*
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A timeout in microseconds is timed by the microsecond list instead of the tick list.
 ************************************************************************************************************************
 */
 
 void  OS_TaskBlock (OS_TCB   *p_tcb,
-                    OS_TICK   timeout)
+                    OS_TICK   timeout,
+                    OS_OPT    opt)
 {
 #if (OS_CFG_DYN_TICK_EN > 0u)
     OS_TICK  elapsed;
+#endif
 
 
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    if ((timeout > 0u) &&
+        ((opt & OS_OPT_PEND_TIMEOUT_US) != 0u)) {               /* See Note #2                                          */
+        OS_TickUsListInsert(p_tcb, (CPU_INT32U)timeout);
+        p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;
+        OS_RdyListRemove(p_tcb);
+        return;
+    }
+#else
+    (void)opt;
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
     elapsed = OS_DynTickGet();
 #endif
 
@@ -0,0 +1,931 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       STREAM BUFFER MANAGEMENT
+*
+* File    : os_stream.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) A stream is a byte ring with a single producer (typically an ISR) & a single consumer task.
+*               The producer only ever moves 'InIx' & the consumer only ever moves 'OutIx', so bytes are
+*               written & read without disabling interrupts: the data is stored before 'InIx' is advanced
+*               & read before 'OutIx' is advanced, with a memory barrier in between.
+*
+*           (2) The consumer blocks only when fewer than its trigger level of bytes are available.  The
+*               producer enters a critical section only to ready that task once the level is reached, every
+*               other byte costs a copy & an index update.
+*
+*           (3) The consumer tests the level & blocks within a critical section, so an interrupt writing to
+*               the stream either runs before & is seen by the test, or after & finds the task waiting.  This
+*               relies on the producer & the consumer running on the same CPU.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_stream__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_STREAM_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_MSG_SIZE  OS_StreamCopyOut (OS_STREAM    *p_stream,
+                                       CPU_INT08U   *p_buf,
+                                       OS_MSG_SIZE   len);
+
+
+/*
+************************************************************************************************************************
+*                                                   CREATE A STREAM
+*
+* Description: This function is called by your application to create a stream buffer.  Streams MUST be created before
+*              they can be used.
+*
+* Arguments  : p_stream    is a pointer to the stream
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the stream
+*
+*              p_storage   is a pointer to the array of 'size' bytes that will hold the data
+*
+*              size        is the size of the array in bytes.  It MUST be a power of 2, no larger than half the range of
+*                          OS_MSG_SIZE.
+*
+*              trigger     is the number of bytes that must be available before a task blocked in OSStreamRead() is
+*                          readied, between 1 and 'size'.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the stream after you called
+*                                                               OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_stream'
+*                              OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_storage'
+*                              OS_ERR_Q_SIZE                  If 'size' is not a power of 2 or 'trigger' is out of range
+*                              OS_ERR_OBJ_CREATED             If the stream was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSStreamCreate (OS_STREAM    *p_stream,
+                      CPU_CHAR     *p_name,
+                      void         *p_storage,
+                      OS_MSG_SIZE   size,
+                      OS_MSG_SIZE   trigger,
+                      OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_storage == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if ((size == 0u) ||                                         /* The size must be a power of 2 ...                    */
+        ((size & (OS_MSG_SIZE)(size - 1u)) != 0u) ||            /* ... small enough for 'InIx - OutIx' not to overflow  */
+        (size > (OS_MSG_SIZE)(((OS_MSG_SIZE)~0u >> 1u) + 1u))) {
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+    if ((trigger == 0u) ||
+        (trigger >  size)) {
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    if (p_stream->Type == OS_OBJ_TYPE_STREAM) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+    p_stream->Type         = OS_OBJ_TYPE_STREAM;                /* Mark the data structure as a stream                  */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_stream->NamePtr      = p_name;
+#else
+    (void)p_name;
+#endif
+    p_stream->StoragePtr   = (CPU_INT08U *)p_storage;
+    p_stream->Size         = size;
+    p_stream->TriggerLevel = trigger;
+    p_stream->WaitLevel    = 0u;
+    p_stream->InIx         = 0u;                                /* The stream is empty                                  */
+    p_stream->OutIx        = 0u;
+    p_stream->OverrunCtr   = 0u;
+    OS_PendListInit(&p_stream->PendList);                       /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_StreamDbgListAdd(p_stream);
+    OSStreamQty++;                                              /* One more stream created                              */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   DELETE A STREAM
+*
+* Description: This function deletes a stream and readies the task reading from it, if any.
+*
+* Arguments  : p_stream  is a pointer to the stream you want to delete
+*
+*              opt       determines delete options as follows:
+*
+*                            OS_OPT_DEL_NO_PEND          Delete the stream ONLY if no task pending
+*                            OS_OPT_DEL_ALWAYS           Deletes the stream even if a task is waiting.
+*                                                        In this case, the task pending will be readied.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    The call was successful and the stream was deleted
+*                            OS_ERR_DEL_ISR                 If you tried to delete the stream from an ISR
+*                            OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the stream after you called
+*                                                             OSStart()
+*                            OS_ERR_OBJ_PTR_NULL            If you pass a NULL pointer for 'p_stream'
+*                            OS_ERR_OBJ_TYPE                If the stream was not created
+*                            OS_ERR_OPT_INVALID             An invalid option was specified
+*                            OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                            OS_ERR_TASK_WAITING            A task was waiting on the stream
+*
+* Returns    : == 0          if no task was waiting on the stream, or upon error.
+*              == 1          if the task waiting on the stream is now readied and informed.
+*
+* Note(s)    : 1) The producer MUST stop writing to the stream before it is deleted.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STREAM_DEL_EN > 0u)
+OS_OBJ_QTY  OSStreamDel (OS_STREAM  *p_stream,
+                         OS_OPT      opt,
+                         OS_ERR     *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't delete a stream from an ISR                    */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate 'p_stream'                                  */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_stream->Type != OS_OBJ_TYPE_STREAM) {                 /* Make sure stream was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_stream->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete stream only if no task waiting                */
+             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_StreamDbgListRemove(p_stream);
+                 OSStreamQty--;
+#endif
+                 OS_StreamClr(p_stream);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the stream                             */
+             if (p_pend_list->HeadPtr != (OS_TCB *)0) {         /* Ready the reader, if any                             */
+#if (OS_CFG_TS_EN > 0u)
+                 ts = OS_TS_GET();
+#else
+                 ts = 0u;
+#endif
+                 OS_PendAbort(p_pend_list->HeadPtr,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks = 1u;
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_StreamDbgListRemove(p_stream);
+             OSStreamQty--;
+#endif
+             OS_StreamClr(p_stream);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              ABORT WAITING ON A STREAM
+*
+* Description: This function aborts & readies the task waiting on a stream, if any.
+*
+* Arguments  : p_stream  is a pointer to the stream
+*
+*              opt       provides options for this function:
+*
+*                            OS_OPT_POST_NONE             No option specified
+*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                  The task waiting on the stream was readied and informed of
+*                                                         the aborted wait
+*                            OS_ERR_OBJ_PTR_NULL          If you pass a NULL pointer for 'p_stream'
+*                            OS_ERR_OBJ_TYPE              If the stream was not created
+*                            OS_ERR_OPT_INVALID           You specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
+*                            OS_ERR_PEND_ABORT_ISR        If this function was called from an ISR
+*                            OS_ERR_PEND_ABORT_NONE       No task was pending
+*
+* Returns    : == OS_FALSE   if no task was waiting on the stream, or upon error.
+*              == OS_TRUE    if the task waiting on the stream was readied and informed.
+*
+* Note(s)    : 1) OSStreamRead() returns the bytes that were available when the wait was aborted.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STREAM_PEND_ABORT_EN > 0u)
+CPU_BOOLEAN  OSStreamPendAbort (OS_STREAM  *p_stream,
+                                OS_OPT      opt,
+                                OS_ERR     *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to Pend Abort from an ISR                */
+       *p_err =  OS_ERR_PEND_ABORT_ISR;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate 'p_stream'                                  */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return (OS_FALSE);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_stream->Type != OS_OBJ_TYPE_STREAM) {                 /* Make sure stream was created                         */
+       *p_err =  OS_ERR_OBJ_TYPE;
+        return (OS_FALSE);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_stream->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on the stream?                      */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err =  OS_ERR_PEND_ABORT_NONE;
+        return (OS_FALSE);
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp of when the abort occurred             */
+#else
+    ts = 0u;
+#endif
+    OS_PendAbort(p_pend_list->HeadPtr,
+                 ts,
+                 OS_STATUS_PEND_ABORT);
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (OS_TRUE);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 READ FROM A STREAM
+*
+* Description: This function reads up to 'len' bytes from a stream.  It waits for the stream's trigger level of bytes
+*              (or for 'len' bytes if fewer) to be available, or for the timeout to expire.
+*
+* Arguments  : p_stream      is a pointer to the stream
+*
+*              p_buf         is a pointer to the buffer that will receive the bytes
+*
+*              len           is the size of 'p_buf', the maximum number of bytes to read
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            trigger level up to the amount of time specified by this argument.  If you specify 0,
+*                            however, your task will wait forever or, until the trigger level is reached.
+*
+*              opt           determines whether the user wants to block if the trigger level isn't reached:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_TIMEOUT_US to give 'timeout' in microseconds (see OSTimeDlyUs()).
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful, see the returned number of bytes
+*                                OS_ERR_OBJ_DEL            If 'p_stream' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_stream'
+*                                OS_ERR_OBJ_TYPE           If the stream was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The wait was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the stream was empty
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_buf'
+*                                OS_ERR_Q_SIZE             If 'len' is 0
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TASK_WAITING       Another task is already waiting on the stream
+*                                OS_ERR_TIMEOUT            The trigger level was not reached within the timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : The number of bytes read.
+*
+* Note(s)    : 1) Only one task may read from a stream.
+*
+*              2) Upon timeout or pend abort, and with OS_OPT_PEND_NON_BLOCKING, the bytes available are returned even
+*                 if they are below the trigger level.  This lets a UART reader pick up the tail of a message after an
+*                 idle period.
+*
+*              3) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+OS_MSG_SIZE  OSStreamRead (OS_STREAM    *p_stream,
+                           void         *p_buf,
+                           OS_MSG_SIZE   len,
+                           OS_TICK       timeout,
+                           OS_OPT        opt,
+                           OS_ERR       *p_err)
+{
+    OS_MSG_SIZE  level;
+    OS_MSG_SIZE  nbr;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return (0u);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_buf == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (len == 0u) {
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+    switch (OS_OPT_PEND_OPT(opt)) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_stream->Type != OS_OBJ_TYPE_STREAM) {                 /* Make sure stream was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    level = p_stream->TriggerLevel;                             /* Wait for the trigger level or for 'len' bytes        */
+    if (level > len) {
+        level = len;
+    }
+
+    if ((OS_MSG_SIZE)(p_stream->InIx - p_stream->OutIx) >= level) {
+        nbr    = OS_StreamCopyOut(p_stream,                     /* Enough bytes already, no need to lock (See Note #1)  */
+                                  (CPU_INT08U *)p_buf,
+                                  len);
+       *p_err  = OS_ERR_NONE;
+        return (nbr);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        nbr = OS_StreamCopyOut(p_stream,                        /* No, return what is there (See Note #2)               */
+                               (CPU_INT08U *)p_buf,
+                               len);
+        if (nbr == 0u) {
+           *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        } else {
+           *p_err = OS_ERR_NONE;
+        }
+        return (nbr);
+    }
+
+    CPU_CRITICAL_ENTER();
+    if ((OS_MSG_SIZE)(p_stream->InIx - p_stream->OutIx) >= level) {
+        CPU_CRITICAL_EXIT();                                    /* Level reached meanwhile (See 'os_stream.c' Note #3)  */
+        nbr    = OS_StreamCopyOut(p_stream,
+                                  (CPU_INT08U *)p_buf,
+                                  len);
+       *p_err  = OS_ERR_NONE;
+        return (nbr);
+    }
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't pend when the scheduler is locked              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return (0u);
+    }
+    if (p_stream->PendList.HeadPtr != (OS_TCB *)0) {            /* Only one reader (See Note #1)                        */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_WAITING;
+        return (0u);
+    }
+
+    p_stream->WaitLevel = level;                                /* OSStreamWrite() readies us at that level             */
+    OS_Pend((OS_PEND_OBJ *)((void *)p_stream),                  /* Block task pending on stream                         */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_STREAM,
+            timeout,
+            opt);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Trigger level reached                                */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get the level within TO      */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OBJ_DEL;
+             return (0u);
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATUS_INVALID;
+             return (0u);
+    }
+    CPU_CRITICAL_EXIT();
+
+    nbr = OS_StreamCopyOut(p_stream,                            /* Return the bytes available (See Note #2)             */
+                           (CPU_INT08U *)p_buf,
+                           len);
+    return (nbr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  WRITE TO A STREAM
+*
+* Description: This function copies up to 'len' bytes to a stream and readies the task reading from it once its trigger
+*              level is reached.
+*
+* Arguments  : p_stream      is a pointer to a stream that must have been created by OSStreamCreate().
+*
+*              p_data        is a pointer to the bytes to write.  The buffer may be reused as soon as this function
+*                            returns.
+*
+*              len           is the number of bytes to write
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE         No option specified
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              All the bytes were written
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_stream' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the stream was not created
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_PTR_INVALID       If you passed a NULL pointer for 'p_data'
+*                                OS_ERR_Q_MAX             If the stream filled up, the bytes that did not fit were
+*                                                         dropped & counted in '.OverrunCtr'
+*
+* Returns    : The number of bytes written.
+*
+* Note(s)    : 1) This function may be called from an ISR.  Only one ISR or task may write to a stream.
+*
+*              2) Interrupts are disabled only to ready the reader (See 'os_stream.c' Note #2).
+************************************************************************************************************************
+*/
+
+OS_MSG_SIZE  OSStreamWrite (OS_STREAM    *p_stream,
+                            void         *p_data,
+                            OS_MSG_SIZE   len,
+                            OS_OPT        opt,
+                            OS_ERR       *p_err)
+{
+    CPU_INT08U   *p_src;
+    OS_MSG_SIZE   in_ix;
+    OS_MSG_SIZE   nbr;
+    OS_MSG_SIZE   ix;
+    OS_MSG_SIZE   mask;
+    OS_TCB       *p_tcb;
+    CPU_BOOLEAN   rdy;
+    CPU_TS        ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stream == (OS_STREAM *)0) {                           /* Validate 'p_stream'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_data == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_stream->Type != OS_OBJ_TYPE_STREAM) {                 /* Make sure stream was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+                                                                /* ---------- COPY THE DATA (See Note #2) ------------- */
+    in_ix = p_stream->InIx;
+    nbr   = p_stream->Size - (OS_MSG_SIZE)(in_ix - p_stream->OutIx);
+    if (nbr > len) {                                            /* Write as many bytes as there is room for             */
+        nbr = len;
+    }
+    mask  = p_stream->Size - 1u;
+    p_src = (CPU_INT08U *)p_data;
+    for (ix = 0u; ix < nbr; ix++) {
+        p_stream->StoragePtr[(OS_MSG_SIZE)(in_ix + ix) & mask] = *p_src++;
+    }
+    CPU_MB();                                                   /* Store the data before publishing it                  */
+    p_stream->InIx = (OS_MSG_SIZE)(in_ix + nbr);
+
+    if (nbr < len) {
+        p_stream->OverrunCtr += (CPU_INT32U)(len - nbr);        /* Count the bytes dropped                              */
+       *p_err = OS_ERR_Q_MAX;
+    } else {
+       *p_err = OS_ERR_NONE;
+    }
+
+                                                                /* ------------ READY THE READER, IF DUE -------------- */
+    CPU_MB();                                                   /* Publish 'InIx' before looking for a reader           */
+    if (p_stream->PendList.HeadPtr == (OS_TCB *)0) {
+        return (nbr);
+    }
+
+    rdy = OS_FALSE;
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_stream->PendList.HeadPtr;                         /* Still waiting & level reached?                       */
+    if ((p_tcb                                               != (OS_TCB *)0) &&
+        ((OS_MSG_SIZE)(p_stream->InIx - p_stream->OutIx) >= p_stream->WaitLevel)) {
+#if (OS_CFG_TS_EN > 0u)
+        ts = OS_TS_GET();
+#else
+        ts = 0u;
+#endif
+        OS_Post((OS_PEND_OBJ *)((void *)p_stream),
+                p_tcb,
+                (void *)0,
+                0u,
+                ts);
+        rdy = OS_TRUE;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((rdy                          == OS_TRUE) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+    return (nbr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   CLEAR A STREAM
+*
+* Description: This function is called by OSStreamDel() to clear the contents of a stream
+*
+* Argument(s): p_stream   is a pointer to the stream to clear
+*              --------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_StreamClr (OS_STREAM  *p_stream)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_stream->Type         =  OS_OBJ_TYPE_NONE;                 /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_stream->NamePtr      = (CPU_CHAR *)((void *)"?STREAM");
+#endif
+    p_stream->StoragePtr   = (CPU_INT08U *)0;
+    p_stream->Size         =               0u;
+    p_stream->TriggerLevel =               0u;
+    p_stream->WaitLevel    =               0u;
+    p_stream->InIx         =               0u;
+    p_stream->OutIx        =               0u;
+    p_stream->OverrunCtr   =               0u;
+    OS_PendListInit(&p_stream->PendList);                       /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                         ADD/REMOVE STREAM TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a stream to/from the stream debug list.
+*
+* Arguments  : p_stream  is a pointer to the stream to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_StreamDbgListAdd (OS_STREAM  *p_stream)
+{
+    p_stream->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_stream->DbgPrevPtr               = (OS_STREAM *)0;
+    if (OSStreamDbgListPtr == (OS_STREAM *)0) {
+        p_stream->DbgNextPtr           = (OS_STREAM *)0;
+    } else {
+        p_stream->DbgNextPtr           =  OSStreamDbgListPtr;
+        OSStreamDbgListPtr->DbgPrevPtr =  p_stream;
+    }
+    OSStreamDbgListPtr                 =  p_stream;
+}
+
+
+void  OS_StreamDbgListRemove (OS_STREAM  *p_stream)
+{
+    OS_STREAM  *p_stream_next;
+    OS_STREAM  *p_stream_prev;
+
+
+    p_stream_prev = p_stream->DbgPrevPtr;
+    p_stream_next = p_stream->DbgNextPtr;
+
+    if (p_stream_prev == (OS_STREAM *)0) {
+        OSStreamDbgListPtr = p_stream_next;
+        if (p_stream_next != (OS_STREAM *)0) {
+            p_stream_next->DbgPrevPtr = (OS_STREAM *)0;
+        }
+        p_stream->DbgNextPtr = (OS_STREAM *)0;
+
+    } else if (p_stream_next == (OS_STREAM *)0) {
+        p_stream_prev->DbgNextPtr = (OS_STREAM *)0;
+        p_stream->DbgPrevPtr      = (OS_STREAM *)0;
+
+    } else {
+        p_stream_prev->DbgNextPtr =  p_stream_next;
+        p_stream_next->DbgPrevPtr =  p_stream_prev;
+        p_stream->DbgNextPtr      = (OS_STREAM *)0;
+        p_stream->DbgPrevPtr      = (OS_STREAM *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              COPY BYTES OUT OF A STREAM
+*
+* Description: This function copies the bytes available in a stream, up to 'len', and releases their room to the writer.
+*
+* Arguments  : p_stream  is a pointer to the stream
+*
+*              p_buf     is a pointer to the destination buffer
+*
+*              len       is the maximum number of bytes to copy
+*
+* Returns    : The number of bytes copied
+*
+* Note(s)    : 1) Called by the reader only, without disabling interrupts (See 'os_stream.c' Note #1).
+************************************************************************************************************************
+*/
+
+static  OS_MSG_SIZE  OS_StreamCopyOut (OS_STREAM    *p_stream,
+                                       CPU_INT08U   *p_buf,
+                                       OS_MSG_SIZE   len)
+{
+    OS_MSG_SIZE  out_ix;
+    OS_MSG_SIZE  nbr;
+    OS_MSG_SIZE  ix;
+    OS_MSG_SIZE  mask;
+
+
+    out_ix = p_stream->OutIx;
+    nbr    = (OS_MSG_SIZE)(p_stream->InIx - out_ix);
+    if (nbr > len) {
+        nbr = len;
+    }
+    CPU_MB();                                                   /* Read 'InIx' before the data it publishes             */
+    mask   = p_stream->Size - 1u;
+    for (ix = 0u; ix < nbr; ix++) {
+       *p_buf++ = p_stream->StoragePtr[(OS_MSG_SIZE)(out_ix + ix) & mask];
+    }
+    CPU_MB();                                                   /* Read the data before releasing its room              */
+    p_stream->OutIx = (OS_MSG_SIZE)(out_ix + nbr);
+    return (nbr);
+}
+#endif
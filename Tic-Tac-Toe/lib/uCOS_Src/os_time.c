@@ -334,9 +334,9 @@ void  OSTimeDlyHMSM (CPU_INT16U   hours,
 ************************************************************************************************************************
 *                                                RESUME A DELAYED TASK
 *
-* Description: This function is used resume a task that has been delayed through a call to either OSTimeDly() or
-*              OSTimeDlyHMSM().  Note that you cannot call this function to resume a task that is waiting for an event
-*              with timeout.
+* Description: This function is used resume a task that has been delayed through a call to either OSTimeDly(),
+*              OSTimeDlyHMSM() or OSTimeDlyUs().  Note that you cannot call this function to resume a task that is
+*              waiting for an event with timeout.
 *
 * Arguments  : p_tcb    is a pointer to the TCB of the task to resume.
 *
@@ -433,6 +433,82 @@ void  OSTimeDlyResume (OS_TCB  *p_tcb,
 }
 #endif
 
+/*
+************************************************************************************************************************
+*                                             DELAY TASK 'n' MICROSECONDS
+*
+* Description: This function is called to delay execution of the currently running task for a number of microseconds,
+*              independently of the tick rate.  The delay is timed by the microsecond timer of the BSP (see
+*              OS_UsTmrGet(), OS_UsTmrSet() and OS_UsTmrStop()) instead of the tick list.
+*
+* Arguments  : us        is the number of microseconds that the task will be delayed for.  Delays longer than
+*                        OS_TICK_US_MAX are cut down to it.
+*
+*              p_err     is a pointer to a variable that will contain an error code from this call.
+*
+*                            OS_ERR_NONE              The call was successful and the delay occurred
+*                            OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                            OS_ERR_SCHED_LOCKED      Can't delay when the scheduler is locked
+*                            OS_ERR_TIME_DLY_ISR      If you called this function from an ISR
+*                            OS_ERR_TIME_ZERO_DLY     If the delay is zero
+*
+* Returns    : none
+*
+* Note(s)    : 1) The delay lasts at least 'us' microseconds; the interrupt latency & the time taken to schedule the task
+*                 are added to it.
+*
+*              2) OSTimeDlyResume() resumes a task delayed by this function as well.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+void  OSTimeDlyUs (CPU_INT32U   us,
+                   OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't delay when the scheduler is locked             */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    if (us == 0u) {
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    OS_TickUsListInsert(OSTCBCurPtr, us);                       /* Insert in the microsecond list                       */
+    OSTCBCurPtr->TaskState = OS_TASK_STATE_DLY;
+    OS_RdyListRemove(OSTCBCurPtr);                              /* Remove current task from ready list                  */
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    OSSched();                                                  /* Find next task to run!                               */
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                               GET CURRENT SYSTEM TIME
@@ -565,6 +641,10 @@ void  OSTimeTick (void)
     OS_SchedRoundRobin(&OSRdyList[OSPrioCur]);                  /* Update quanta ctr for the task which just ran        */
 #endif
 
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    OS_TaskBudgetCharge();                                      /* Charge the tick to the budget of the task which ran  */
+#endif
+
 #if (OS_CFG_TICK_EN > 0u)
     OS_TickUpdate(1u);                                          /* Update from the ISR                                  */
 #endif
@@ -598,3 +678,30 @@ void  OSTimeDynTick (OS_TICK  ticks)
     OS_TickUpdate(ticks);                                       /* Update from the ISR                                  */
 }
 #endif
+
+
+/*
+************************************************************************************************************************
+*                                           PROCESS MICROSECOND TIMER MATCH
+*
+* Description: This function is used to signal to uC/OS-III that the compare of the microsecond timer matched.  This
+*              function should be called by the ISR of the microsecond timer.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+void  OSTimeUsTick (void)
+{
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+        return;
+    }
+
+    OS_TickUsUpdate();                                          /* Update from the ISR                                  */
+}
+#endif
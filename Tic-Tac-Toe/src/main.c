@@ -22,6 +22,9 @@
 #define HUMAN_PLAYER_PRIO 3u
 #define ANALYSIS_PRIO 4u
 
+/* Ticks by which the 100 ms polling delays may be late, so that they expire together */
+#define POLL_SLACK_TICKS 10u
+
 /*
 *********************************************************************************************************
 *                                           GLOBAL VARIABLES
@@ -191,6 +194,14 @@ static void AppTaskStart(void *p_arg)
                      (void *)0,
                      (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
                      (OS_ERR *)&err);
+
+        OSTaskSlackSet((OS_TCB *)&HumanPlayerTCB,
+                       (OS_TICK)POLL_SLACK_TICKS,
+                       (OS_ERR *)&err);
+
+        OSTaskSlackSet((OS_TCB *)&AnalysisTCB,
+                       (OS_TICK)POLL_SLACK_TICKS,
+                       (OS_ERR *)&err);
     }
 }
 
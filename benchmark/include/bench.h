@@ -0,0 +1,50 @@
+/*
+*********************************************************************************************************
+*                                       KERNEL MICRO-BENCHMARKS
+*
+* Measure the cost of context switches & of every IPC primitive in CPU_TS_TmrRd() counts : the DWT cycle
+* counter on the STM32F429, the TSC (or nanoseconds) on the host. The context switches per iteration are
+* counted too.
+*
+* The platform supplies the timestamp timer (CPU_TS_TmrInit()/CPU_TS_TmrRd()), routes one interrupt to
+* BenchIntHandler() & raises it with BenchIntTrig().
+*********************************************************************************************************
+*/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "os.h"
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_SAMPLE_NBR 1000u          //Samples kept per benchmark
+#define BENCH_WARMUP_NBR 16u            //Iterations run before sampling starts
+#define BENCH_FLAG_WAITER_NBR 8u        //Tasks woken by one OSFlagPost()
+
+#define BENCH_TASK_STK_SIZE 256u
+
+/* Task Priority, the task calling BenchRun() MUST have a higher priority */
+#define BENCH_TASK_PRIO_HI 4u
+#define BENCH_TASK_PRIO_LO 20u
+
+/* Relative deadlines of the EDF tasks, in ticks */
+#define BENCH_EDF_DEADLINE_HI 1u
+#define BENCH_EDF_DEADLINE_LO 0x10000000u       //Never reached while the benchmark runs
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void BenchRun(void);                    //Run every benchmark & print the results
+void BenchIntHandler(void);             //ISR of the benchmark interrupt
+
+void BenchIntTrig(void);                //Raise the benchmark interrupt, supplied by the platform
+
+#endif
@@ -0,0 +1,37 @@
+/*
+*********************************************************************************************************
+*                                        SOFTWARE TIMER SCALING
+*
+* Measure the cost of the timer API (OSTmrStart(), OSTmrStop(), OSTmrRemainGet()) in CPU_TS_TmrRd()
+* counts while 10, 100, ... up to TMR_BENCH_NBR_MAX timers are running.
+*********************************************************************************************************
+*/
+
+#ifndef TMR_BENCH_H
+#define TMR_BENCH_H
+
+#include "os.h"
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#ifndef TMR_BENCH_NBR_MAX
+#define TMR_BENCH_NBR_MAX 10000u        //Largest number of running timers
+#endif
+
+#define TMR_BENCH_SAMPLE_NBR 256u       //Calls measured per point, the mean is reported
+#define TMR_BENCH_DLY 100u              //Shortest timer delay, in timer ticks, no timer expires during a point
+#define TMR_BENCH_DLY_SPAN 10000u       //Timer delays are spread over this many timer ticks
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void TmrBenchRun(void);                 //Run the sweep & print the scaling table
+
+#endif
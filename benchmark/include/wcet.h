@@ -0,0 +1,44 @@
+/*
+*********************************************************************************************************
+*                                 WORST-CASE EXECUTION TIME EXPLORATION
+*
+* Drive kernel services into their worst-case path while sweeping the number of objects involved
+* (1..WCET_OBJ_NBR_MAX) & report the longest time spent with interrupts masked, measured by uC/CPU's
+* interrupts disabled time measurement (CPU_CFG_INT_DIS_MEAS_EN).
+*********************************************************************************************************
+*/
+
+#ifndef WCET_H
+#define WCET_H
+
+#include "os.h"
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#ifndef WCET_OBJ_NBR_MAX
+#define WCET_OBJ_NBR_MAX 256u           //Largest object count of the sweep
+#endif
+
+#define WCET_REPEAT_NBR 8u              //Runs per point, the largest result is kept
+#define WCET_BUDGET_US 10u              //Interrupt latency budget, results above it are flagged
+
+#define WCET_TASK_STK_SIZE 96u
+#define WCET_DRIVER_STK_SIZE 512u
+
+/* Task Priority, the waiter tasks run above the driver task */
+#define WCET_TASK_PRIO_HI 10u
+#define WCET_TASK_PRIO_LO 30u
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void WcetRun(void);                     //Run the sweep & print the scaling table
+
+#endif
@@ -0,0 +1,1157 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                             ARMv7-M Port
+*
+* File    : os_cpu_c.c
+* Version : V3.08.00
+*********************************************************************************************************
+* For     : ARMv7-M Cortex-M
+* Mode    : Thumb-2 ISA
+*********************************************************************************************************
+* Note(s) : (1) This port supports the ARM Cortex-M3, Cortex-M4 and Cortex-M7 architectures.
+*           (2) It has been tested with the following Hardware Floating Point Unit.
+*               (a) Single-precision: FPv4-SP-D16-M and FPv5-SP-D16-M
+*               (b) Double-precision: FPv5-D16-M
+*********************************************************************************************************
+*/
+
+#define   OS_CPU_GLOBALS
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_cpu_c__c = "$Id: $";
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "os.h"
+
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+CPU_INT32U  OS_KA_BASEPRI_Boundary;                             /* Base Priority boundary.                              */
+
+#if (OS_CFG_DYN_TICK_EN > 0u) || (OS_CFG_TIME_DLY_US_EN > 0u)
+static  CPU_INT32U  OS_CPU_TmrCntFreq;                          /* Timer counting frequency, 0 until it is started.     */
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT32U  OS_CPU_DynTickCnts;                         /* Timer counts per tick, 0 until the timer is started. */
+static  CPU_INT32U  OS_CPU_DynTickBase;                         /* Timer count when OSTickCtr was ...                   */
+static  OS_TICK     OS_CPU_DynTickBaseCtr;                      /* ... equal to OS_CPU_DynTickBaseCtr.                  */
+static  OS_TICK     OS_CPU_DynTickStep;                         /* Ticks from the base to the programmed event.         */
+static  OS_TICK     OS_CPU_DynTickMax;                          /* Longest step the 32-bit timer can count.             */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FLOATING POINT DEFINES
+*********************************************************************************************************
+*/
+
+#define  CPU_REG_FP_FPCCR              (*((CPU_REG32 *)0xE000EF34uL))   /* Floating-Point Context Control Reg.         */
+
+                                                                        /* Enabled FP lazy stacking and enable ..      */
+                                                                        /* ..automatic state saving.                   */
+#define  CPU_REG_FPCCR_LAZY_STK                        0xC0000000uL
+
+
+/*
+*********************************************************************************************************
+*                                         DYNAMIC TICK DEFINES
+*
+* Note(s) : (1) The dynamic tick counts on a 32-bit general purpose timer of the STM32F4xx clocked from
+*               APB1, TIM2 or TIM5 (see 'os_cpu.h  OS_CPU_CFG_DYN_TICK_TMR').
+*
+*           (2) The microsecond timer (OS_CFG_TIME_DLY_US_EN) shares that timer : it then counts at 1 MHz,
+*               the dynamic tick on compare channel 1 & the microsecond delays on compare channel 2.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_DYN_TICK_TMR == 2u)
+#define  OS_CPU_DYN_TICK_TMR_BASE                      0x40000000uL     /* TIM2.                                       */
+#define  OS_CPU_DYN_TICK_TMR_CLK_EN                    DEF_BIT_00       /* RCC_APB1ENR.TIM2EN                          */
+#define  OS_CPU_DYN_TICK_INT_POS                      (CPU_INT_EXT0 + 28u)
+#else
+#define  OS_CPU_DYN_TICK_TMR_BASE                      0x40000C00uL     /* TIM5.                                       */
+#define  OS_CPU_DYN_TICK_TMR_CLK_EN                    DEF_BIT_03       /* RCC_APB1ENR.TIM5EN                          */
+#define  OS_CPU_DYN_TICK_INT_POS                      (CPU_INT_EXT0 + 50u)
+#endif
+
+#define  OS_CPU_REG_RCC_APB1ENR        (*((CPU_REG32 *)0x40023840uL))   /* APB1 Peripheral Clock Enable Reg.           */
+
+#define  OS_CPU_REG_TMR_CR1            (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x00u)))   /* Control Reg. 1.       */
+#define  OS_CPU_REG_TMR_DIER           (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x0Cu)))   /* DMA/Int. Enable Reg.  */
+#define  OS_CPU_REG_TMR_SR             (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x10u)))   /* Status Reg.           */
+#define  OS_CPU_REG_TMR_EGR            (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x14u)))   /* Event Generation Reg. */
+#define  OS_CPU_REG_TMR_CNT            (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x24u)))   /* Counter.              */
+#define  OS_CPU_REG_TMR_PSC            (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x28u)))   /* Prescaler.            */
+#define  OS_CPU_REG_TMR_ARR            (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x2Cu)))   /* Auto-Reload Reg.      */
+#define  OS_CPU_REG_TMR_CCR1           (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x34u)))   /* Capture/Compare Reg 1 */
+#define  OS_CPU_REG_TMR_CCR2           (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x38u)))   /* Capture/Compare Reg 2 */
+
+#define  OS_CPU_REG_TMR_CR1_CEN                        DEF_BIT_00       /* Counter enable.                             */
+#define  OS_CPU_REG_TMR_EGR_UG                         DEF_BIT_00       /* Update generation.                          */
+#define  OS_CPU_REG_TMR_CC1                            DEF_BIT_01       /* DIER.CC1IE, SR.CC1IF & EGR.CC1G.            */
+#define  OS_CPU_REG_TMR_CC2                            DEF_BIT_02       /* DIER.CC2IE, SR.CC2IF & EGR.CC2G.            */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u) || (OS_CFG_TIME_DLY_US_EN > 0u)
+static  CPU_INT32U  OS_CPU_TmrStart (CPU_INT32U  tmr_freq);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           IDLE TASK HOOK
+*
+* Description: This function is called by the idle task.  This hook has been added to allow you to do
+*              such things as STOP the CPU to conserve power.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) With the dynamic tick, the CPU sleeps until the next interrupt : the tick list event
+*                 programmed in the timer or a peripheral.  OSIdleTaskCtr then no longer measures the idle
+*                 time & the CPU usage computed by the statistic task is meaningless.
+*********************************************************************************************************
+*/
+
+void  OSIdleTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppIdleTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppIdleTaskHookPtr)();
+    }
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_WaitForInt();                                           /* See Note #1.                                         */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*
+* Description: This function is called by OSInit() at the beginning of OSInit().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) When using hardware floating point please do the following during the reset handler:
+*                 a) Set full access for CP10 & CP11 bits in CPACR register.
+*                 b) Set bits ASPEN and LSPEN in FPCCR register.
+*********************************************************************************************************
+*/
+
+void  OSInitHook (void)
+{
+#if (OS_CPU_ARM_FP_EN > 0u)
+    CPU_INT32U   reg_val;
+#endif
+                                                                /* 8-byte align the ISR stack.                          */
+    OS_CPU_ExceptStkBase = (CPU_STK *)(OSCfg_ISRStkBasePtr + OSCfg_ISRStkSize);
+    OS_CPU_ExceptStkBase = (CPU_STK *)((CPU_STK)(OS_CPU_ExceptStkBase) & 0xFFFFFFF8);
+
+#if (OS_CPU_ARM_FP_EN > 0u)
+    reg_val = CPU_REG_FP_FPCCR;                                 /* Check the floating point mode.                       */
+    if ((reg_val & CPU_REG_FPCCR_LAZY_STK) != CPU_REG_FPCCR_LAZY_STK) {
+        while (1u) {                                            /* See Note (1).                                        */
+            ;
+        }
+    }
+#endif
+                                                                /* Set BASEPRI boundary from the configuration.         */
+    OS_KA_BASEPRI_Boundary = (CPU_INT32U)(CPU_CFG_KA_IPL_BOUNDARY << (8u - CPU_CFG_NVIC_PRIO_BITS));
+}
+
+
+/*
+*********************************************************************************************************
+*                                           REDZONE HIT HOOK
+*
+* Description: This function is called when a task's stack overflowed.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the offending task. NULL if ISR.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+void  OSRedzoneHitHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppRedzoneHitHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppRedzoneHitHookPtr)(p_tcb);
+    } else {
+        CPU_SW_EXCEPTION(;);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+    CPU_SW_EXCEPTION(;);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         STATISTIC TASK HOOK
+*
+* Description: This function is called every second by uC/OS-III's statistics task.  This allows your
+*              application to add functionality to the statistics task.
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSStatTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppStatTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppStatTaskHookPtr)();
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TASK CREATION HOOK
+*
+* Description: This function is called when a task is created.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being created.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskCreateHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskCreateHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskCreateHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TASK DELETION HOOK
+*
+* Description: This function is called when a task is deleted.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being deleted.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskDelHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskDelHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskDelHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                            TASK RETURN HOOK
+*
+* Description: This function is called if a task accidentally returns.  In other words, a task should
+*              either be an infinite loop or delete itself when done.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task that is returning.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskReturnHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskReturnHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskReturnHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        INITIALIZE A TASK'S STACK
+*
+* Description: This function is called by either OSTaskCreate() or OSTaskCreateExt() to initialize the
+*              stack frame of the task being created.  This function is highly processor specific.
+*
+* Arguments  : p_task       Pointer to the task entry point address.
+*
+*              p_arg        Pointer to a user supplied data area that will be passed to the task
+*                               when the task first executes.
+*
+*              p_stk_base   Pointer to the base address of the stack.
+*
+*              stk_size     Size of the stack, in number of CPU_STK elements.
+*
+*              opt          Options used to alter the behavior of OS_Task_StkInit().
+*                            (see OS.H for OS_TASK_OPT_xxx).
+*
+* Returns    : Always returns the location of the new top-of-stack once the processor registers have
+*              been placed on the stack in the proper order.
+*
+* Note(s)    : (1) Interrupts are enabled when task starts executing.
+*
+*              (2) All tasks run in Thread mode, using process stack.
+*
+*              (3) There are two different stack frames depending on whether the task uses the Floating-Point(FP)
+*                  co-processor or not.
+*
+*                  (a) The stack frame shown in the diagram is used by every task when it is created and by a task
+*                      which never executes an FP instruction. In this case, the FP registers(S0- S31) & FP Status
+*                      Control(FPSCR) register are not saved in the stack frame.
+*
+*                  (b) The stack frame shown in the diagram is used once the task has executed an FP instruction,
+*                      which is flagged by bit 4 of EXEC_RETURN being clear (see Note 5). The processor stacks
+*                      S0-S15 & FPSCR lazily and PendSV saves S16-S31 above EXEC_RETURN.
+*
+*                      (1) When enabling the FPU through CPACR, make sure to set bits ASPEN and LSPEN in the
+*                          Floating-Point Context Control Register (FPCCR).
+*
+*                                          +-------------+
+*                                          |             |
+*                                          +-------------+
+*                                          |             |
+*                                          +-------------+
+*                                          |    FPSCR    |
+*                                          +-------------+
+*                                          |     S15     |
+*                                          +-------------+
+*                                          |     S14     |
+*                                          +-------------+
+*                                          |     S13     |
+*                                          +-------------+
+*                                                .
+*                                                .
+*                                                .
+*                                          +-------------+
+*                                          |     S2      |
+*                                          +-------------+
+*                                          |     S1      |
+*                    +-------------+       +-------------+
+*                    |             |       |     S0      |
+*                    +-------------+       +-------------+
+*                    |    xPSR     |       |    xPSR     |
+*                    +-------------+       +-------------+
+*                    | Return Addr |       | Return Addr |
+*                    +-------------+       +-------------+
+*                    |  LR(R14)    |       |   LR(R14)   |
+*                    +-------------+       +-------------+
+*                    |    R12      |       |     R12     |
+*                    +-------------+       +-------------+
+*                    |    R3       |       |     R3      |
+*                    +-------------+       +-------------+
+*                    |    R2       |       |     R2      |
+*                    +-------------+       +-------------+
+*                    |    R1       |       |     R1      |
+*                    +-------------+       +-------------+
+*                    |    R0       |       |     R0      |
+*                    +-------------+       +-------------+
+*                    | EXEC_RETURN |       |     S31     |
+*                    +-------------+       +-------------+
+*                    |    R11      |       |     S30     |
+*                    +-------------+       +-------------+
+*                    |    R10      |       |     S29     |
+*                    +-------------+       +-------------+
+*                    |    R9       |             .
+*                    +-------------+             .
+*                    |    R8       |             .
+*                    +-------------+       +-------------+
+*                    |    R7       |       |     S17     |
+*                    +-------------+       +-------------+
+*                    |    R6       |       |     S16     |
+*                    +-------------+       +-------------+
+*                    |    R5       |       | EXEC_RETURN |
+*                    +-------------+       +-------------+
+*                    |    R4       |       |     R11     |
+*                    +-------------+       +-------------+
+*                          (a)             |     R10     |
+*                                          +-------------+
+*                                                .
+*                                                .
+*                                                .
+*                                          +-------------+
+*                                          |     R5      |
+*                                          +-------------+
+*                                          |     R4      |
+*                                          +-------------+
+*                                               (b)
+*
+*             (4) The SP must be 8-byte aligned in conforming to the Procedure Call Standard for the ARM architecture
+*
+*                    (a) Section 2.1 of the  ABI for the ARM Architecture Advisory Note. SP must be 8-byte aligned
+*                        on entry to AAPCS-Conforming functions states :
+*
+*                        The Procedure Call Standard for the ARM Architecture [AAPCS] requires primitive
+*                        data types to be naturally aligned according to their sizes (for size = 1, 2, 4, 8 bytes).
+*                        Doing otherwise creates more problems than it solves.
+*
+*                        In return for preserving the natural alignment of data, conforming code is permitted
+*                        to rely on that alignment. To support aligning data allocated on the stack, the stack
+*                        pointer (SP) is required to be 8-byte aligned on entry to a conforming function. In
+*                        practice this requirement is met if:
+*
+*                           (1) At each call site, the current size of the calling function's stack frame is a multiple of 8 bytes.
+*                               This places an obligation on compilers and assembly language programmers.
+*
+*                           (2) SP is a multiple of 8 when control first enters a program.
+*                               This places an obligation on authors of low level OS, RTOS, and runtime library
+*                               code to align SP at all points at which control first enters
+*                               a body of (AAPCS-conforming) code.
+*
+*                       In turn, this requires the value of SP to be aligned to 0 modulo 8:
+*
+*                           (3) By exception handlers, before calling AAPCS-conforming code.
+*
+*                           (4) By OS/RTOS/run-time system code, before giving control to an application.
+*
+*                 (b) Section 2.3.1 corrective steps from the the SP must be 8-byte aligned on entry
+*                     to AAPCS-conforming functions advisory note also states.
+*
+*                     " This requirement extends to operating systems and run-time code for all architecture versions
+*                       prior to ARMV7 and to the A, R and M architecture profiles thereafter. Special considerations
+*                       associated with ARMV7M are discussed in section 2.3.3"
+*
+*                     (1) Even if the SP 8-byte aligment is not a requirement for the ARMv7M profile, the stack is aligned
+*                         to 8-byte boundaries to support legacy execution enviroments.
+*
+*                 (c) Section 5.2.1.2 from the Procedure Call Standard for the ARM
+*                     architecture states :  "The stack must also conform to the following
+*                     constraint at a public interface:
+*
+*                     (1) SP mod 8 = 0. The stack must be double-word aligned"
+*
+*                 (d) From the ARM Technical Support Knowledge Base. 8 Byte stack aligment.
+*
+*                     "8 byte stack alignment is a requirement of the ARM Architecture Procedure
+*                      Call Standard [AAPCS]. This specifies that functions must maintain an 8 byte
+*                      aligned stack address (e.g. 0x00, 0x08, 0x10, 0x18, 0x20) on all external
+*                      interfaces. In practice this requirement is met if:
+*
+*                      (1) At each external interface, the current stack pointer
+*                          is a multiple of 8 bytes.
+*
+*                      (2) Your OS maintains 8 byte stack alignment on its external interfaces
+*                          e.g. on task switches"
+*
+*              (5) Exception Return Behavior(EXEC_RETURN)
+*                  0xFFFFFFFD      Return to Thread mode, exception return uses non-floating point state
+*                                  from the PSP and execution uses PSP after return.
+*
+*                  0xFFFFFFED      Return to Thread mode, exception return uses floating point state
+*                                  from the PSP and execution uses PSP after return.
+**********************************************************************************************************
+*/
+
+CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
+                         void          *p_arg,
+                         CPU_STK       *p_stk_base,
+                         CPU_STK       *p_stk_limit,
+                         CPU_STK_SIZE   stk_size,
+                         OS_OPT         opt)
+{
+    CPU_STK    *p_stk;
+
+
+    (void)opt;                                                  /* 'opt' is not used, prevent warning                   */
+
+    p_stk = &p_stk_base[stk_size];                              /* Load stack pointer                                   */
+                                                                /* Align the stack to 8-bytes.                          */
+    p_stk = (CPU_STK *)((CPU_STK)(p_stk) & 0xFFFFFFF8u);
+                                                                /* Registers stacked as if auto-saved on exception      */
+    *(--p_stk) = (CPU_STK)0x01000000u;                          /* xPSR                                                 */
+    *(--p_stk) = (CPU_STK)p_task;                               /* Entry Point                                          */
+    *(--p_stk) = (CPU_STK)OS_TaskReturn;                        /* R14 (LR)                                             */
+    *(--p_stk) = (CPU_STK)0x12121212u;                          /* R12                                                  */
+    *(--p_stk) = (CPU_STK)0x03030303u;                          /* R3                                                   */
+    *(--p_stk) = (CPU_STK)0x02020202u;                          /* R2                                                   */
+    *(--p_stk) = (CPU_STK)p_stk_limit;                          /* R1                                                   */
+    *(--p_stk) = (CPU_STK)p_arg;                                /* R0 : argument                                        */
+
+    *(--p_stk) = (CPU_STK)0xFFFFFFFDuL;                         /* R14: EXEC_RETURN; See Note 3a & 5                    */
+                                                                /* Remaining registers saved on process stack           */
+    *(--p_stk) = (CPU_STK)0x11111111uL;                         /* R11                                                  */
+    *(--p_stk) = (CPU_STK)0x10101010uL;                         /* R10                                                  */
+    *(--p_stk) = (CPU_STK)0x09090909uL;                         /* R9                                                   */
+    *(--p_stk) = (CPU_STK)0x08080808uL;                         /* R8                                                   */
+    *(--p_stk) = (CPU_STK)0x07070707uL;                         /* R7                                                   */
+    *(--p_stk) = (CPU_STK)0x06060606uL;                         /* R6                                                   */
+    *(--p_stk) = (CPU_STK)0x05050505uL;                         /* R5                                                   */
+    *(--p_stk) = (CPU_STK)0x04040404uL;                         /* R4                                                   */
+
+    return (p_stk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.  This allows you to perform other
+*              operations during a context switch.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task
+*                 that will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points
+*                 to the task being switched out (i.e. the preempted task).
+*              3) The FP registers are saved & restored by OS_CPU_PendSVHandler(), only for the tasks
+*                 which use the FPU.
+*********************************************************************************************************
+*/
+
+void  OSTaskSwHook (void)
+{
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    CPU_TS  ts;
+#endif
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    CPU_TS  int_dis_time;
+#endif
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    CPU_BOOLEAN  stk_status;
+#endif
+
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskSwHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTaskSwHookPtr)();
+    }
+#endif
+
+    OS_TRACE_TASK_SWITCHED_IN(OSTCBHighRdyPtr);
+
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    ts = OS_TS_GET();
+    if (OSTCBCurPtr != OSTCBHighRdyPtr) {
+        OSTCBCurPtr->CyclesDelta  = ts - OSTCBCurPtr->CyclesStart;
+        OSTCBCurPtr->CyclesTotal += (OS_CYCLES)OSTCBCurPtr->CyclesDelta;
+    }
+
+    OSTCBHighRdyPtr->CyclesStart = ts;
+#endif
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    int_dis_time = CPU_IntDisMeasMaxCurReset();                 /* Keep track of per-task interrupt disable time        */
+    if (OSTCBCurPtr->IntDisTimeMax < int_dis_time) {
+        OSTCBCurPtr->IntDisTimeMax = int_dis_time;
+    }
+#endif
+
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+                                                                /* Keep track of per-task scheduler lock time           */
+    if (OSTCBCurPtr->SchedLockTimeMax < OSSchedLockTimeMaxCur) {
+        OSTCBCurPtr->SchedLockTimeMax = OSSchedLockTimeMaxCur;
+    }
+    OSSchedLockTimeMaxCur = (CPU_TS)0;                          /* Reset the per-task value                             */
+#endif
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+                                                                /* Check if stack overflowed.                           */
+    stk_status = OSTaskStkRedzoneChk((OS_TCB *)0u);
+    if (stk_status != OS_TRUE) {
+        OSRedzoneHitHook(OSTCBCurPtr);
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                              TICK HOOK
+*
+* Description: This function is called every tick.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is assumed to be called from the Tick ISR.
+*********************************************************************************************************
+*/
+
+void  OSTimeTickHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTimeTickHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTimeTickHookPtr)();
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SYS TICK HANDLER
+*
+* Description: Handle the system tick (SysTick) interrupt, which is used to generate the uC/OS-III tick
+*              interrupt.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function MUST be placed on entry 15 of the Cortex-M vector table.
+*
+*              2) With the dynamic tick, the kernel is ticked by OS_CPU_DynTickHandler() only.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickHandler  (void)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_DYN_TICK_EN == 0u)                                  /* See Note #2.                                         */
+    OSTimeTick();                                               /* Call uC/OS-III's OSTimeTick()                        */
+#endif
+
+    OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
+}
+
+
+/*
+*********************************************************************************************************
+*                                         INITIALIZE SYS TICK
+*
+* Description: Initialize the SysTick using the CPU clock frequency.
+*
+* Arguments  : cpu_freq         CPU clock frequency.
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*
+*              2) Either OS_CPU_SysTickInitFreq or OS_CPU_SysTickInit() can be called.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickInitFreq (CPU_INT32U  cpu_freq)
+{
+#if (OS_CFG_TICK_EN > 0u)
+    CPU_INT32U  cnts;
+
+
+    cnts = (cpu_freq / (CPU_INT32U)OSCfg_TickRate_Hz);          /* Determine nbr SysTick cnts between two OS tick intr. */
+
+    OS_CPU_SysTickInit(cnts);
+#else
+    (void)cpu_freq;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                         INITIALIZE SYS TICK
+*
+* Description: Initialize the SysTick using the number of countes between two ticks.
+*
+* Arguments  : cnts         Number of SysTick counts between two OS tick interrupts.
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*
+*              2) Either OS_CPU_SysTickInitFreq or OS_CPU_SysTickInit() can be called.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
+{
+#if (OS_CFG_TICK_EN > 0u)
+    CPU_INT32U  prio;
+    CPU_INT32U  basepri;
+
+
+                                                                /* Set BASEPRI boundary from the configuration.         */
+    basepri             = (CPU_INT32U)(CPU_CFG_KA_IPL_BOUNDARY << (8u - CPU_CFG_NVIC_PRIO_BITS));
+    CPU_REG_SYST_RVR    = cnts - 1u;                            /* Set Reload Register                                  */
+
+                                                                /* Set SysTick handler prio.                            */
+    prio                = CPU_REG_SCB_SHPRI3;
+    prio               &= 0x00FFFFFFu;
+    prio               |= (basepri << 24u);
+
+    CPU_REG_SCB_SHPRI3  = prio;
+
+                                                                /* Enable timer.                                        */
+    CPU_REG_SYST_CSR   |= CPU_REG_SYST_CSR_CLKSOURCE |
+                          CPU_REG_SYST_CSR_ENABLE;
+
+    CPU_REG_SYST_CSR   |= CPU_REG_SYST_CSR_TICKINT;             /* Enable timer interrupt.                              */
+#else
+    (void)cnts;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       INITIALIZE DYNAMIC TICK
+*
+* Description: Start the dynamic tick timer (see 'DYNAMIC TICK DEFINES') & program the first event of the
+*              tick list.
+*
+* Arguments  : tmr_freq     Timer clock frequency : the APB1 timer clock, twice PCLK1 when the APB1
+*                           prescaler is not 1 (90 MHz with a 180 MHz core clock).
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization, instead
+*                 of OS_CPU_SysTickInit().  With the microsecond timer, the tick is counted in microseconds
+*                 (see 'DYNAMIC TICK DEFINES  Note #2').
+*
+*              2) The SysTick may keep running for the HAL, but its interrupt no longer ticks the kernel.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_DynTickInit (CPU_INT32U  tmr_freq)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_INT32U  cnt_freq;
+    CPU_SR_ALLOC();
+
+
+    cnt_freq                = OS_CPU_TmrStart(tmr_freq);
+
+    CPU_REG_SYST_CSR       &= ~CPU_REG_SYST_CSR_TICKINT;        /* See Note #2.                                         */
+
+    CPU_CRITICAL_ENTER();
+    OS_CPU_DynTickCnts      = cnt_freq / (CPU_INT32U)OSCfg_TickRate_Hz;
+    OS_CPU_DynTickMax       = (OS_TICK)((DEF_INT_32U_MAX_VAL / OS_CPU_DynTickCnts) - 1u);
+    OS_CPU_DynTickBase      = OS_CPU_REG_TMR_CNT;
+    OS_CPU_DynTickBaseCtr   = OSTickCtr;
+    OS_CPU_REG_TMR_DIER    |= OS_CPU_REG_TMR_CC1;               /* Interrupt on a compare match.                        */
+
+    (void)OS_DynTickSet(OSTickCtrStep);                         /* Program the first event of the tick list.            */
+    CPU_CRITICAL_EXIT();
+#else
+    (void)tmr_freq;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DYNAMIC TICK HANDLER
+*
+* Description: Handle the compare match of the dynamic tick timer : announce the ticks elapsed to the
+*              kernel, which programs the next event of the tick list.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is called by OS_CPU_TmrHandler() on a compare 1 match.
+*
+*              2) The elapsed ticks are read from the timer, so a late interrupt loses no time.  Reading
+*                 them & updating the tick list is done in one critical section : an interrupt posting
+*                 to a task waiting with a timeout also moves OSTickCtr forward (see OS_TickListRemove()).
+*
+*              3) A match of the previous event may be raised while OS_DynTickSet() programs the next one.
+*                 The interrupt then finds no elapsed tick & the same event is simply programmed again.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_DynTickHandler (void)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK  ticks;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+    OS_CPU_REG_TMR_SR = ~OS_CPU_REG_TMR_CC1;                    /* Clear the compare match.                             */
+
+    ticks = OS_DynTickGet();                                    /* See Note #2.                                         */
+    if (ticks > 0u) {
+        OSTimeDynTick(ticks);                                   /* Update the tick list & program its next event.       */
+    } else {
+        (void)OS_DynTickSet(OS_CPU_DynTickStep);                /* See Note #3.                                         */
+    }
+    CPU_CRITICAL_EXIT();
+
+    OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                     GET ELAPSED DYNAMIC TICKS
+*
+* Description: Return the number of ticks elapsed since OSTickCtr was last brought up to date.
+*
+* Arguments  : None.
+*
+* Returns    : The number of ticks not yet accounted for in OSTickCtr.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled.
+*
+*              2) Ticks past the programmed event belong to the timer interrupt, which is pending : the
+*                 kernel must not step over the event before its tick list is updated.
+*
+*              3) OS_TickUpdate() adds the ticks to OSTickCtr before it programs the next event : ticks
+*                 already in OSTickCtr are not returned twice (e.g. to OS_SchedEdfRelease()).
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    OS_TICK  ticks;
+    OS_TICK  done;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* Timer not started yet.                               */
+        return (0u);
+    }
+
+    ticks = (OS_TICK)((CPU_INT32U)(OS_CPU_REG_TMR_CNT - OS_CPU_DynTickBase) / OS_CPU_DynTickCnts);
+    if (ticks > OS_CPU_DynTickStep) {                           /* See Note #2.                                         */
+        ticks = OS_CPU_DynTickStep;
+    }
+
+    done = OSTickCtr - OS_CPU_DynTickBaseCtr;                   /* See Note #3.                                         */
+    if (ticks <= done) {
+        return (0u);
+    }
+
+    return (ticks - done);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     SET NEXT DYNAMIC TICK EVENT
+*
+* Description: Program the timer to interrupt 'ticks' ticks after OSTickCtr.
+*
+* Arguments  : ticks        Number of ticks from OSTickCtr to the next event of the tick list, 0 if the
+*                           tick list is empty.
+*
+* Returns    : The number of ticks programmed.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled, right after OSTickCtr is brought up to
+*                 date.
+*
+*              2) The base moves by whole ticks, so the tick boundaries never drift from the timer count.
+*
+*              3) Without an event, or with one beyond the 32-bit timer range, the timer interrupts after
+*                 the longest step it can count : the kernel then catches up & programs the rest.
+*
+*              4) A compare only matches when the counter equals CCR1 : a match already passed while
+*                 programming is forced by software.
+*
+*              5) The interrupt itself is left pending : it may be a match of the microsecond timer, and
+*                 OS_CPU_TmrHandler() ignores an interrupt without a match flag.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    CPU_INT32U  cnts;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* OS_CPU_DynTickInit() programs the first event.       */
+        return (ticks);
+    }
+                                                                /* See Note #2.                                         */
+    OS_CPU_DynTickBase    += (CPU_INT32U)(OSTickCtr - OS_CPU_DynTickBaseCtr) * OS_CPU_DynTickCnts;
+    OS_CPU_DynTickBaseCtr  =  OSTickCtr;
+
+    if ((ticks == 0u) || (ticks > OS_CPU_DynTickMax)) {         /* See Note #3.                                         */
+        ticks = OS_CPU_DynTickMax;
+    }
+    OS_CPU_DynTickStep     =  ticks;
+
+    cnts                   = (CPU_INT32U)ticks * OS_CPU_DynTickCnts;
+    OS_CPU_REG_TMR_SR      = ~OS_CPU_REG_TMR_CC1;               /* Drop a match of the previous event (see Note #5).    */
+    OS_CPU_REG_TMR_CCR1    =  OS_CPU_DynTickBase + cnts;
+
+    if ((CPU_INT32U)(OS_CPU_REG_TMR_CNT - OS_CPU_DynTickBase) >= cnts) {
+        OS_CPU_REG_TMR_EGR = OS_CPU_REG_TMR_CC1;                /* See Note #4.                                         */
+    }
+
+    return (ticks);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            TIMER HANDLER
+*
+* Description: Handle the interrupt of the 32-bit timer shared by the dynamic tick & the microsecond timer
+*              (see 'DYNAMIC TICK DEFINES').
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function MUST be placed on the TIM2 or TIM5 entry of the vector table (see
+*                 'cortex_ports.S').
+*
+*              2) Only the matches whose interrupt is enabled are handled : a stale interrupt, whose flag
+*                 was cleared when the next match was programmed, does nothing.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_TmrHandler (void)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u) || (OS_CFG_TIME_DLY_US_EN > 0u)
+    CPU_INT32U  flags;
+
+
+    flags = OS_CPU_REG_TMR_SR & OS_CPU_REG_TMR_DIER;            /* See Note #2.                                         */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if ((flags & OS_CPU_REG_TMR_CC1) != 0u) {
+        OS_CPU_DynTickHandler();
+    }
+#endif
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    if ((flags & OS_CPU_REG_TMR_CC2) != 0u) {
+        OS_CPU_UsTmrHandler();
+    }
+#endif
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                    INITIALIZE MICROSECOND TIMER
+*
+* Description: Start the timer (see 'DYNAMIC TICK DEFINES') which times OSTimeDlyUs() & the pend timeouts
+*              given in microseconds.
+*
+* Arguments  : tmr_freq     Timer clock frequency : the APB1 timer clock, a multiple of 1 MHz.
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization, before
+*                 the first microsecond delay.  With the dynamic tick, 'tmr_freq' MUST be the same as the
+*                 one given to OS_CPU_DynTickInit().
+*********************************************************************************************************
+*/
+
+void  OS_CPU_UsTmrInit (CPU_INT32U  tmr_freq)
+{
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    (void)OS_CPU_TmrStart(tmr_freq);
+#else
+    (void)tmr_freq;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MICROSECOND TIMER HANDLER
+*
+* Description: Handle the compare match of the microsecond timer : the kernel readies the tasks whose
+*              microsecond delay or timeout expired & programs the next match.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is called by OS_CPU_TmrHandler() on a compare 2 match.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_UsTmrHandler (void)
+{
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+    OS_CPU_REG_TMR_SR = ~OS_CPU_REG_TMR_CC2;                    /* Clear the compare match.                             */
+    CPU_CRITICAL_EXIT();
+
+    OSTimeUsTick();                                             /* Expire the microsecond delays due                    */
+
+    OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                      READ MICROSECOND TIMER
+*
+* Description: Return the free running 32-bit microsecond count.
+*
+* Arguments  : None.
+*
+* Returns    : The timer count, in microseconds.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+CPU_INT32U  OS_UsTmrGet (void)
+{
+    return (OS_CPU_REG_TMR_CNT);
+}
+
+
+/*
+*********************************************************************************************************
+*                                   SET MICROSECOND TIMER MATCH
+*
+* Description: Program compare channel 2 to interrupt when the count reaches 'match'.
+*
+* Arguments  : match        Count at which to interrupt.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled.
+*
+*              2) A compare only matches when the counter equals CCR2 : a match already passed while
+*                 programming is forced by software.
+*********************************************************************************************************
+*/
+
+void  OS_UsTmrSet (CPU_INT32U  match)
+{
+    OS_CPU_REG_TMR_SR    = ~OS_CPU_REG_TMR_CC2;                 /* Drop a match of the previous entry.                  */
+    OS_CPU_REG_TMR_CCR2  =  match;
+    OS_CPU_REG_TMR_DIER |=  OS_CPU_REG_TMR_CC2;
+
+    if ((CPU_INT32S)(OS_CPU_REG_TMR_CNT - match) >= 0) {
+        OS_CPU_REG_TMR_EGR = OS_CPU_REG_TMR_CC2;                /* See Note #2.                                         */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                  STOP MICROSECOND TIMER MATCH
+*
+* Description: Disable the compare 2 interrupt; the timer keeps counting.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled.
+*********************************************************************************************************
+*/
+
+void  OS_UsTmrStop (void)
+{
+    OS_CPU_REG_TMR_DIER &= ~OS_CPU_REG_TMR_CC2;
+    OS_CPU_REG_TMR_SR    = ~OS_CPU_REG_TMR_CC2;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_TmrStart()
+*
+* Description: Start the 32-bit timer of the dynamic tick & of the microsecond timer, once.
+*
+* Arguments  : tmr_freq     Timer clock frequency.
+*
+* Returns    : The counting frequency : 1 MHz with the microsecond timer (see 'DYNAMIC TICK DEFINES
+*              Note #2'), else 'tmr_freq'.
+*
+* Note(s)    : 1) The timer interrupt is kernel aware, at the SysTick priority.  Each user enables the
+*                 interrupt of its own compare channel.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u) || (OS_CFG_TIME_DLY_US_EN > 0u)
+static  CPU_INT32U  OS_CPU_TmrStart (CPU_INT32U  tmr_freq)
+{
+    CPU_INT32U  cnt_freq;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (OS_CPU_TmrCntFreq == 0u) {                              /* Not started yet?                                     */
+        OS_CPU_REG_RCC_APB1ENR |= OS_CPU_DYN_TICK_TMR_CLK_EN;   /* Clock the timer.                                     */
+
+        OS_CPU_REG_TMR_CR1      = 0u;
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+        OS_CPU_REG_TMR_PSC      = (tmr_freq / 1000000u) - 1u;   /* Count microseconds ...                               */
+        OS_CPU_TmrCntFreq       =  1000000u;
+#else
+        OS_CPU_REG_TMR_PSC      = 0u;                           /* Count at the timer clock ...                         */
+        OS_CPU_TmrCntFreq       = tmr_freq;
+#endif
+        OS_CPU_REG_TMR_ARR      = DEF_INT_32U_MAX_VAL;          /* ... over the full 32-bit range.                      */
+        OS_CPU_REG_TMR_EGR      = OS_CPU_REG_TMR_EGR_UG;        /* Load the prescaler.                                  */
+        OS_CPU_REG_TMR_SR       = 0u;
+        OS_CPU_REG_TMR_DIER     = 0u;
+        OS_CPU_REG_TMR_CNT      = 0u;
+        OS_CPU_REG_TMR_CR1      = OS_CPU_REG_TMR_CR1_CEN;       /* Start counting.                                      */
+
+        CPU_IntSrcPrioSet(OS_CPU_DYN_TICK_INT_POS, CPU_CFG_KA_IPL_BOUNDARY, CPU_INT_KA);
+        CPU_IntSrcEn(OS_CPU_DYN_TICK_INT_POS);                  /* See Note #1.                                         */
+    }
+    cnt_freq = OS_CPU_TmrCntFreq;
+    CPU_CRITICAL_EXIT();
+
+    return (cnt_freq);
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
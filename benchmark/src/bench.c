@@ -0,0 +1,1328 @@
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <stdio.h>
+#include "bench.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_TASK_NBR (BENCH_FLAG_WAITER_NBR + 1u)
+#define BENCH_MEM_BLK_NBR 4u
+#define BENCH_MEM_BLK_SIZE 16u
+#define BENCH_OVRHD_NBR 64u
+#define BENCH_Q_SIZE 4u                 //Entries of BenchQ & BenchQPriv
+#define BENCH_Q_BATCH_NBR 4u            //Messages posted per batch, fit in BenchQ
+#define BENCH_Q_PRIO_NBR 8u             //Message priorities of BenchQPrio
+#define BENCH_RING_MSG_NBR 4u           //Slots of BenchRing, a power of 2
+#define BENCH_RING_MSG_SIZE 16u         //Bytes copied per BenchRing message
+#define BENCH_STREAM_SIZE 64u           //Bytes of BenchStream, a power of 2
+#define BENCH_TOPIC_SUB_NBR 3u          //Subscribers of BenchTopic
+#define BENCH_TOPIC_BUF_NBR 2u          //Buffers of BenchTopic
+#define BENCH_TOPIC_BUF_SIZE 32u        //Bytes per BenchTopic buffer, header included
+#define BENCH_INT_BURST_NBR 16u         //Interrupts per sample of the burst benchmarks
+
+#define BENCH_FLAG_BIT ((OS_FLAGS)0x01u)
+
+#define BENCH_TS_GET() ((CPU_INT32U)CPU_TS_TmrRd())
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef struct bench_test
+{
+    const CPU_CHAR *Name;
+    void (*Start)(void);                //Create the tasks of the benchmark
+} BENCH_TEST;
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/* Task Control Block, the first created task (index 0) is always the highest priority one */
+static OS_TCB BenchTaskTCB[BENCH_TASK_NBR];
+
+/* Task Stack */
+static CPU_STK BenchTaskStk[BENCH_TASK_NBR][BENCH_TASK_STK_SIZE];
+static CPU_INT08U BenchTaskNbr;
+
+/* OS Kernal Objects */
+static OS_SEM BenchDoneSem;
+static OS_SEM BenchSem1;
+static OS_SEM BenchSem2;
+static OS_Q BenchQ;
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+static OS_Q BenchQPriv;                         //Same as BenchQ with a private pool of OS_MSGs
+static OS_MSG_POOL BenchQPrivPool;
+static OS_MSG BenchQPrivMsgTbl[BENCH_Q_SIZE];
+#endif
+#if (OS_CFG_Q_PRIO_EN > 0u)
+static OS_Q BenchQPrio;                         //Same as BenchQ with messages ordered by priority
+static OS_MSG *BenchQPrioTailTbl[BENCH_Q_PRIO_NBR];
+#endif
+static OS_MUTEX BenchMutex;
+static OS_FLAG_GRP BenchFlagGrp;
+static OS_MEM BenchMem;
+static CPU_INT08U BenchMemStorage[BENCH_MEM_BLK_NBR][BENCH_MEM_BLK_SIZE];
+#if (OS_CFG_RING_EN > 0u)
+static OS_RING BenchRing;
+static CPU_ALIGN BenchRingStorage[BENCH_RING_MSG_NBR][BENCH_RING_MSG_SIZE / sizeof(CPU_ALIGN)];
+#endif
+#if (OS_CFG_STREAM_EN > 0u)
+static OS_STREAM BenchStream;
+static CPU_INT08U BenchStreamStorage[BENCH_STREAM_SIZE];
+#endif
+#if (OS_CFG_TOPIC_EN > 0u)
+static OS_TOPIC BenchTopic;
+static OS_TOPIC_SUB BenchTopicSub[BENCH_TOPIC_SUB_NBR];
+static OS_Q BenchTopicQ[BENCH_TOPIC_SUB_NBR];   //One queue per subscriber
+static OS_MEM BenchTopicMem;
+static CPU_ALIGN BenchTopicStorage[BENCH_TOPIC_BUF_NBR][BENCH_TOPIC_BUF_SIZE / sizeof(CPU_ALIGN)];
+#endif
+
+/* Samples */
+static volatile CPU_INT32U BenchTsStart;        //Timestamp taken before the measured operation
+static CPU_INT32U BenchTsOvrhd;                 //Cost of reading the timestamp twice
+static CPU_INT32U BenchSampleTbl[BENCH_SAMPLE_NBR];
+static CPU_INT32U BenchIterCtr;
+static OS_TCB *BenchIntTCBPtr;                  //Task signaled by BenchIntHandler()
+#if (OS_CFG_STREAM_EN > 0u)
+static OS_STREAM *BenchIntStreamPtr;            //Stream BenchIntHandler() writes a byte to
+#endif
+static volatile float BenchFpVal;               //Touched by the FPU benchmark tasks
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/* Benchmarks */
+static void BenchYieldStart(void);
+static void BenchYieldFpStart(void);
+static void BenchResumeStart(void);
+static void BenchSemStart(void);
+static void BenchSemRoundTripStart(void);
+static void BenchTaskSemStart(void);
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+static void BenchPendMultiStart(void);
+#endif
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+static void BenchTaskSemEdfStart(void);
+#endif
+static void BenchQStart(void);
+static void BenchQSelfStart(void);
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+static void BenchQPrivStart(void);
+static void BenchQPrivSelfStart(void);
+#endif
+#if (OS_CFG_Q_PRIO_EN > 0u)
+static void BenchQPrioSelfStart(void);
+#endif
+static void BenchQBatchStart(void);
+#if (OS_CFG_Q_N_EN > 0u)
+static void BenchQBatchNStart(void);
+#endif
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+static void BenchQBatchThresholdStart(void);
+#endif
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+static void BenchQPostBlockingStart(void);
+#endif
+#if (OS_CFG_RING_EN > 0u)
+static void BenchRingStart(void);
+static void BenchRingSelfStart(void);
+#endif
+#if (OS_CFG_TOPIC_EN > 0u)
+static void BenchTopicSelfStart(void);
+#endif
+static void BenchTaskQStart(void);
+static void BenchMutexStart(void);
+static void BenchFlagStart(void);
+static void BenchMemGetStart(void);
+static void BenchMemPutStart(void);
+static void BenchIntStart(void);
+static void BenchIntBurstStart(void);
+#if (OS_CFG_STREAM_EN > 0u)
+static void BenchIntStreamStart(void);
+#endif
+
+/* Utilities */
+static void BenchTaskCreate(OS_TASK_PTR p_task, void *p_arg, OS_PRIO prio);
+static void BenchTestRun(const BENCH_TEST *p_test);
+static void BenchSample(CPU_INT32U ts_end);
+static CPU_BOOLEAN BenchDone(void);
+static void BenchFinish(void);
+static void BenchSort(CPU_INT32U *p_tbl, CPU_INT32U nbr);
+
+/*
+*********************************************************************************************************
+*                                           BENCHMARK TABLE
+*********************************************************************************************************
+*/
+
+static const BENCH_TEST BenchTestTbl[] = {
+    {"Yield, same priority (cooperative)", BenchYieldStart},
+    {"Yield, same priority, FPU in use", BenchYieldFpStart},
+    {"OSTaskResume -> preempt", BenchResumeStart},
+    {"OSSemPost -> OSSemPend", BenchSemStart},
+    {"OSSemPost/OSSemPend round trip", BenchSemRoundTripStart},
+    {"OSTaskSemPost -> OSTaskSemPend", BenchTaskSemStart},
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    {"OSSemPost -> OSPendMulti, 3 objects", BenchPendMultiStart},
+#endif
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    {"OSTaskSemPost -> OSTaskSemPend (EDF)", BenchTaskSemEdfStart},
+#endif
+    {"OSQPost -> OSQPend", BenchQStart},
+    {"OSQPost + OSQPend, no switch", BenchQSelfStart},
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+    {"OSQPost -> OSQPend, private pool", BenchQPrivStart},
+    {"OSQPost + OSQPend, private pool", BenchQPrivSelfStart},
+#endif
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    {"OSQPostPrio + OSQPend, no switch", BenchQPrioSelfStart},
+#endif
+    {"OSQPost x4 -> OSQPend, batch", BenchQBatchStart},
+#if (OS_CFG_Q_N_EN > 0u)
+    {"OSQPostN x4 -> OSQPendN, batch", BenchQBatchNStart},
+#endif
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+    {"OSQPost x4 -> OSQPend, threshold", BenchQBatchThresholdStart},
+#endif
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+    {"OSQPend -> blocked OSQPost resumes", BenchQPostBlockingStart},
+#endif
+#if (OS_CFG_RING_EN > 0u)
+    {"OSRingPost -> OSRingPend, 16 bytes", BenchRingStart},
+    {"OSRingPost + OSRingPend, no switch", BenchRingSelfStart},
+#endif
+#if (OS_CFG_TOPIC_EN > 0u)
+    {"OSTopicPublish, 3 subs, no switch", BenchTopicSelfStart},
+#endif
+    {"OSTaskQPost -> OSTaskQPend", BenchTaskQStart},
+    {"OSMutexPost -> OSMutexPend (PI)", BenchMutexStart},
+    {"OSFlagPost -> all waiters woken", BenchFlagStart},
+    {"OSMemGet", BenchMemGetStart},
+    {"OSMemPut", BenchMemPutStart},
+    {"ISR -> OSTaskSemPost -> task", BenchIntStart},
+    {"ISR x16 -> OSTaskSemPost -> task", BenchIntBurstStart},
+#if (OS_CFG_STREAM_EN > 0u)
+    {"ISR x16 -> OSStreamWrite -> task", BenchIntStreamStart},
+#endif
+};
+
+/*
+*********************************************************************************************************
+*                                          RUN THE BENCHMARKS
+*********************************************************************************************************
+*/
+
+void BenchRun(void)
+{
+    OS_ERR err;
+    CPU_TS_TMR_FREQ freq;
+    CPU_ERR cpu_err;
+    CPU_INT32U ts;
+    CPU_INT32U i;
+
+    OSSemCreate(&BenchDoneSem, (CPU_CHAR *)"Bench Done", 0, &err);
+    OSSemCreate(&BenchSem1, (CPU_CHAR *)"Bench Sem 1", 0, &err);
+    OSSemCreate(&BenchSem2, (CPU_CHAR *)"Bench Sem 2", 0, &err);
+    OSQCreate(&BenchQ, (CPU_CHAR *)"Bench Q", BENCH_Q_SIZE, &err);
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+    OSQCreate(&BenchQPriv, (CPU_CHAR *)"Bench Q Priv", BENCH_Q_SIZE, &err);
+    OSMsgPoolCreate(&BenchQPrivPool, &BenchQPrivMsgTbl[0], BENCH_Q_SIZE, &err);
+    OSQPoolSet(&BenchQPriv, &BenchQPrivPool, &err);
+#endif
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    OSQCreate(&BenchQPrio, (CPU_CHAR *)"Bench Q Prio", BENCH_Q_SIZE, &err);
+    OSQPrioSet(&BenchQPrio, &BenchQPrioTailTbl[0], BENCH_Q_PRIO_NBR, &err);
+#endif
+#if (OS_CFG_RING_EN > 0u)
+    OSRingCreate(&BenchRing,
+                 (CPU_CHAR *)"Bench Ring",
+                 &BenchRingStorage[0][0],
+                 BENCH_RING_MSG_SIZE,
+                 BENCH_RING_MSG_NBR,
+                 &err);
+#endif
+#if (OS_CFG_STREAM_EN > 0u)
+    OSStreamCreate(&BenchStream,
+                   (CPU_CHAR *)"Bench Stream",
+                   &BenchStreamStorage[0],
+                   BENCH_STREAM_SIZE,
+                   BENCH_INT_BURST_NBR,
+                   &err);
+#endif
+#if (OS_CFG_TOPIC_EN > 0u)
+    OSMemCreate(&BenchTopicMem,
+                (CPU_CHAR *)"Bench Topic Mem",
+                &BenchTopicStorage[0][0],
+                BENCH_TOPIC_BUF_NBR,
+                BENCH_TOPIC_BUF_SIZE,
+                &err);
+    OSTopicCreate(&BenchTopic, (CPU_CHAR *)"Bench Topic", &BenchTopicMem, &err);
+    for (i = 0; i < BENCH_TOPIC_SUB_NBR; i++)
+    {
+        OSQCreate(&BenchTopicQ[i], (CPU_CHAR *)"Bench Topic Q", BENCH_Q_SIZE, &err);
+        OSTopicSubscribe(&BenchTopic, &BenchTopicSub[i], &BenchTopicQ[i], &err);
+    }
+#endif
+    OSMutexCreate(&BenchMutex, (CPU_CHAR *)"Bench Mutex", &err);
+    OSFlagCreate(&BenchFlagGrp, (CPU_CHAR *)"Bench Flags", 0, &err);
+    OSMemCreate(&BenchMem,
+                (CPU_CHAR *)"Bench Mem",
+                &BenchMemStorage[0][0],
+                BENCH_MEM_BLK_NBR,
+                BENCH_MEM_BLK_SIZE,
+                &err);
+
+    BenchTsOvrhd = DEF_INT_32U_MAX_VAL;     //Smallest cost of reading the timestamp, subtracted from samples
+    for (i = 0; i < BENCH_OVRHD_NBR; i++)
+    {
+        ts = BENCH_TS_GET();
+        ts = BENCH_TS_GET() - ts;
+        if (ts < BenchTsOvrhd)
+        {
+            BenchTsOvrhd = ts;
+        }
+    }
+
+    freq = CPU_TS_TmrFreqGet(&cpu_err);
+    printf("\nKernel micro-benchmarks, %u samples, timestamp counts at %lu Hz\n\n",
+           (unsigned)BENCH_SAMPLE_NBR, (unsigned long)freq);
+    printf("%-36s %8s %8s %8s %8s %8s\n", "Benchmark", "mean", "p50", "p99", "max", "ctxsw");
+
+    OSSchedRoundRobinCfg(DEF_ENABLED, 0u, &err);        //Needed by OSSchedRoundRobinYield()
+    for (i = 0; i < sizeof(BenchTestTbl) / sizeof(BenchTestTbl[0]); i++)
+    {
+        BenchTestRun(&BenchTestTbl[i]);
+    }
+    OSSchedRoundRobinCfg(DEF_DISABLED, 0u, &err);
+}
+
+/*
+*********************************************************************************************************
+*                                             BENCHMARKS
+*
+* Each benchmark creates a high and/or a low priority task. The task starting the measured operation
+* stores a timestamp in BenchTsStart, the task seeing its end calls BenchSample(). The task that finds
+* all samples taken calls BenchFinish().
+*********************************************************************************************************
+*/
+
+/* Context switch between tasks of the same priority */
+static void BenchYieldTaskA(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        OSSchedRoundRobinYield(&err);
+    }
+}
+
+static void BenchYieldTaskB(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSSchedRoundRobinYield(&err);
+        BenchSample(BENCH_TS_GET());
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchYieldStart(void)
+{
+    BenchTaskCreate(BenchYieldTaskA, (void *)0, BENCH_TASK_PRIO_LO);
+    BenchTaskCreate(BenchYieldTaskB, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+/* Same as above, both tasks have an FP context so their FP registers are switched too */
+static void BenchYieldFpTaskA(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        BenchFpVal = BenchFpVal * 0.5f + 1.0f;
+        BenchTsStart = BENCH_TS_GET();
+        OSSchedRoundRobinYield(&err);
+    }
+}
+
+static void BenchYieldFpTaskB(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        BenchFpVal = BenchFpVal * 0.5f + 1.0f;
+        OSSchedRoundRobinYield(&err);
+        BenchSample(BENCH_TS_GET());
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchYieldFpStart(void)
+{
+    BenchTaskCreate(BenchYieldFpTaskA, (void *)0, BENCH_TASK_PRIO_LO);
+    BenchTaskCreate(BenchYieldFpTaskB, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+/* Preemption by a higher priority task made ready */
+static void BenchResumeTaskHi(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSTaskSuspend((OS_TCB *)0, &err);
+        BenchSample(BENCH_TS_GET());
+    }
+}
+
+static void BenchResumeTaskLo(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        OSTaskResume(&BenchTaskTCB[0], &err);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchResumeStart(void)
+{
+    BenchTaskCreate(BenchResumeTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchResumeTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+/* Semaphore signaling a higher priority task */
+static void BenchSemTaskHi(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSSemPend(&BenchSem1, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchSample(BENCH_TS_GET());
+    }
+}
+
+static void BenchSemTaskLo(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        OSSemPost(&BenchSem1, OS_OPT_POST_1, &err);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchSemStart(void)
+{
+    BenchTaskCreate(BenchSemTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchSemTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+/* Semaphore ping-pong, two context switches */
+static void BenchSemRoundTripTaskHi(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSSemPend(&BenchSem1, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSSemPost(&BenchSem2, OS_OPT_POST_1, &err);
+    }
+}
+
+static void BenchSemRoundTripTaskLo(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        OSSemPost(&BenchSem1, OS_OPT_POST_1, &err);
+        OSSemPend(&BenchSem2, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchSample(BENCH_TS_GET());
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchSemRoundTripStart(void)
+{
+    BenchTaskCreate(BenchSemRoundTripTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchSemRoundTripTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+/* Task semaphore signaling a higher priority task */
+static void BenchTaskSemTaskHi(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchSample(BENCH_TS_GET());
+    }
+}
+
+static void BenchTaskSemTaskLo(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        OSTaskSemPost(&BenchTaskTCB[0], OS_OPT_POST_NONE, &err);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchTaskSemStart(void)
+{
+    BenchTaskCreate(BenchTaskSemTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchTaskSemTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+/* Same as BenchSemStart but the higher priority task also waits on BenchQ and BenchFlagGrp */
+static void BenchPendMultiTaskHi(void *p_arg)
+{
+    OS_ERR err;
+    OS_PEND_DATA pend_data_tbl[3];
+
+    pend_data_tbl[0].PendObjPtr = (OS_PEND_OBJ *)&BenchQ;
+    pend_data_tbl[1].PendObjPtr = (OS_PEND_OBJ *)&BenchFlagGrp;
+    pend_data_tbl[1].FlagsPend = BENCH_FLAG_BIT;
+    pend_data_tbl[1].FlagsOpt = OS_OPT_PEND_FLAG_SET_ANY | OS_OPT_PEND_FLAG_CONSUME;
+    pend_data_tbl[2].PendObjPtr = (OS_PEND_OBJ *)&BenchSem1;
+    while (DEF_TRUE)
+    {
+        (void)OSPendMulti(pend_data_tbl, 3u, 0, OS_OPT_PEND_BLOCKING, &err);
+        BenchSample(BENCH_TS_GET());
+    }
+}
+
+static void BenchPendMultiStart(void)
+{
+    BenchTaskCreate(BenchPendMultiTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchSemTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+/* Same as above, both tasks at the EDF priority, the pending one preempts by its earlier deadline */
+static void BenchTaskSemEdfStart(void)
+{
+    OS_ERR err;
+
+    BenchTaskCreate(BenchTaskSemTaskHi, (void *)0, OS_CFG_SCHED_EDF_PRIO);
+    OSTaskDeadlineSet(&BenchTaskTCB[0], BENCH_EDF_DEADLINE_HI, (OS_TICK)0, &err);
+    BenchTaskCreate(BenchTaskSemTaskLo, (void *)0, OS_CFG_SCHED_EDF_PRIO);
+    OSTaskDeadlineSet(&BenchTaskTCB[1], BENCH_EDF_DEADLINE_LO, (OS_TICK)0, &err);
+}
+#endif
+
+/* Message queue to a higher priority task, 'p_arg' is the queue */
+static void BenchQTaskHi(void *p_arg)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+
+    while (DEF_TRUE)
+    {
+        (void)OSQPend((OS_Q *)p_arg, 0, OS_OPT_PEND_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        BenchSample(BENCH_TS_GET());
+    }
+}
+
+static void BenchQTaskLo(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        OSQPost((OS_Q *)p_arg, (void *)&BenchTsStart, sizeof(BenchTsStart), OS_OPT_POST_FIFO, &err);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchQStart(void)
+{
+    BenchTaskCreate(BenchQTaskHi, (void *)&BenchQ, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchQTaskLo, (void *)&BenchQ, BENCH_TASK_PRIO_LO);
+}
+
+/* Message queue throughput, a message is always waiting so nobody blocks */
+static void BenchQSelfTask(void *p_arg)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        OSQPost((OS_Q *)p_arg, (void *)&BenchTsStart, sizeof(BenchTsStart), OS_OPT_POST_FIFO, &err);
+        (void)OSQPend((OS_Q *)p_arg, 0, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        BenchSample(BENCH_TS_GET());
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchQSelfStart(void)
+{
+    BenchTaskCreate(BenchQSelfTask, (void *)&BenchQ, BENCH_TASK_PRIO_LO);
+}
+
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+/* Same as the two above, the OS_MSGs come from the queue's own pool instead of OSMsgPool */
+static void BenchQPrivStart(void)
+{
+    BenchTaskCreate(BenchQTaskHi, (void *)&BenchQPriv, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchQTaskLo, (void *)&BenchQPriv, BENCH_TASK_PRIO_LO);
+}
+
+static void BenchQPrivSelfStart(void)
+{
+    BenchTaskCreate(BenchQSelfTask, (void *)&BenchQPriv, BENCH_TASK_PRIO_LO);
+}
+#endif
+
+#if (OS_CFG_Q_PRIO_EN > 0u)
+/* Same as BenchQSelfStart, a message of a lower priority waits in the queue so each post is placed ahead of it */
+static void BenchQPrioSelfTask(void *p_arg)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+    OS_PRIO prio;
+
+    (void)p_arg;
+    OSQPostPrio(&BenchQPrio, (void *)0, 0, BENCH_Q_PRIO_NBR - 1u, OS_OPT_POST_NONE, &err);
+    prio = 0;
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        OSQPostPrio(&BenchQPrio, (void *)&BenchTsStart, sizeof(BenchTsStart), prio, OS_OPT_POST_NONE, &err);
+        (void)OSQPend(&BenchQPrio, 0, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        BenchSample(BENCH_TS_GET());
+        prio = (prio + 1u) % (BENCH_Q_PRIO_NBR - 1u);   //Every priority above the waiting message
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchQPrioSelfStart(void)
+{
+    BenchTaskCreate(BenchQPrioSelfTask, (void *)0, BENCH_TASK_PRIO_LO);
+}
+#endif
+
+/* A batch of messages to a higher priority task, a sample covers the whole batch */
+static void BenchQBatchTaskHi(void *p_arg)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+    CPU_INT32U i;
+
+    while (DEF_TRUE)
+    {
+        for (i = 0; i < BENCH_Q_BATCH_NBR; i++)
+        {
+            (void)OSQPend(&BenchQ, 0, OS_OPT_PEND_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        }
+        BenchSample(BENCH_TS_GET());
+        OSSemPost(&BenchSem1, OS_OPT_POST_1, &err);
+    }
+}
+
+static void BenchQBatchTaskLo(void *p_arg)
+{
+    OS_ERR err;
+    CPU_INT32U i;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        for (i = 0; i < BENCH_Q_BATCH_NBR; i++)
+        {
+            OSQPost(&BenchQ, (void *)&BenchTsStart, sizeof(BenchTsStart), OS_OPT_POST_FIFO, &err);
+        }
+        (void)OSSemPend(&BenchSem1, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchQBatchStart(void)
+{
+    BenchTaskCreate(BenchQBatchTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchQBatchTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+#if (OS_CFG_Q_N_EN > 0u)
+/* Same batch posted & received in single calls, the consumer is readied & switched to once */
+static void BenchQBatchNTaskHi(void *p_arg)
+{
+    OS_ERR err;
+    void *msg_tbl[BENCH_Q_BATCH_NBR];
+    OS_MSG_SIZE msg_size_tbl[BENCH_Q_BATCH_NBR];
+    OS_MSG_QTY nbr;
+
+    while (DEF_TRUE)
+    {
+        nbr = 0u;
+        while (nbr < BENCH_Q_BATCH_NBR)
+        {
+            nbr += OSQPendN(&BenchQ, &msg_tbl[nbr], &msg_size_tbl[nbr], BENCH_Q_BATCH_NBR - nbr, 0,
+                            OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        }
+        BenchSample(BENCH_TS_GET());
+        OSSemPost(&BenchSem1, OS_OPT_POST_1, &err);
+    }
+}
+
+static void BenchQBatchNTaskLo(void *p_arg)
+{
+    OS_ERR err;
+    void *msg_tbl[BENCH_Q_BATCH_NBR];
+    OS_MSG_SIZE msg_size_tbl[BENCH_Q_BATCH_NBR];
+    CPU_INT32U i;
+
+    for (i = 0; i < BENCH_Q_BATCH_NBR; i++)
+    {
+        msg_tbl[i] = (void *)&BenchTsStart;
+        msg_size_tbl[i] = sizeof(BenchTsStart);
+    }
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        (void)OSQPostN(&BenchQ, &msg_tbl[0], &msg_size_tbl[0], BENCH_Q_BATCH_NBR, OS_OPT_POST_FIFO, &err);
+        (void)OSSemPend(&BenchSem1, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchQBatchNStart(void)
+{
+    BenchTaskCreate(BenchQBatchNTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchQBatchNTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+#endif
+
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+/* Same as above, the consumer can't preempt the producer & drains the batch once it blocks */
+static void BenchQBatchThresholdStart(void)
+{
+    OS_ERR err;
+
+    BenchTaskCreate(BenchQBatchTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchQBatchTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+    OSTaskPreemptThresholdSet(&BenchTaskTCB[1], BENCH_TASK_PRIO_HI, &err);
+}
+#endif
+
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+/* A higher priority producer keeps BenchQ full, each message retrieved lets its blocked post complete */
+static void BenchQPostBlockingTaskHi(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSQPost(&BenchQ, (void *)&BenchTsStart, sizeof(BenchTsStart), OS_OPT_POST_FIFO | OS_OPT_POST_BLOCKING, &err);
+        BenchSample(BENCH_TS_GET());            //The first BENCH_Q_SIZE posts don't block, they are warmup
+    }
+}
+
+static void BenchQPostBlockingTaskLo(void *p_arg)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        (void)OSQPend(&BenchQ, 0, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchQPostBlockingStart(void)
+{
+    BenchTaskCreate(BenchQPostBlockingTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchQPostBlockingTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+#endif
+
+#if (OS_CFG_RING_EN > 0u)
+/* Ring to a higher priority task, the message is copied straight to the waiting task's buffer */
+static void BenchRingTaskHi(void *p_arg)
+{
+    OS_ERR err;
+    CPU_ALIGN msg[BENCH_RING_MSG_SIZE / sizeof(CPU_ALIGN)];
+
+    while (DEF_TRUE)
+    {
+        OSRingPend(&BenchRing, (void *)&msg[0], 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchSample(BENCH_TS_GET());
+    }
+}
+
+static void BenchRingTaskLo(void *p_arg)
+{
+    OS_ERR err;
+    CPU_ALIGN msg[BENCH_RING_MSG_SIZE / sizeof(CPU_ALIGN)] = {0};
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        OSRingPost(&BenchRing, (void *)&msg[0], OS_OPT_POST_FIFO, &err);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchRingStart(void)
+{
+    BenchTaskCreate(BenchRingTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchRingTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+/* Ring throughput, compare with OSQPost + OSQPend: the message is copied in & out of a slot */
+static void BenchRingSelfTask(void *p_arg)
+{
+    OS_ERR err;
+    CPU_ALIGN msg[BENCH_RING_MSG_SIZE / sizeof(CPU_ALIGN)] = {0};
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        OSRingPost(&BenchRing, (void *)&msg[0], OS_OPT_POST_FIFO, &err);
+        OSRingPend(&BenchRing, (void *)&msg[0], 0, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+        BenchSample(BENCH_TS_GET());
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchRingSelfStart(void)
+{
+    BenchTaskCreate(BenchRingSelfTask, (void *)0, BENCH_TASK_PRIO_LO);
+}
+#endif
+
+#if (OS_CFG_TOPIC_EN > 0u)
+/* One buffer to 3 subscriber queues & back to the partition, compare with 3 x OSQPost + OSQPend */
+static void BenchTopicSelfTask(void *p_arg)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+    void *p_buf;
+    CPU_INT32U i;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        p_buf = OSTopicBufGet(&BenchTopic, &err);
+        (void)OSTopicPublish(&BenchTopic, p_buf, sizeof(CPU_INT32U), OS_OPT_POST_NONE, &err);
+        for (i = 0; i < BENCH_TOPIC_SUB_NBR; i++)
+        {
+            p_buf = OSQPend(&BenchTopicQ[i], 0, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+            OSTopicBufRelease(p_buf, &err);     //The last release returns the buffer
+        }
+        BenchSample(BENCH_TS_GET());
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchTopicSelfStart(void)
+{
+    BenchTaskCreate(BenchTopicSelfTask, (void *)0, BENCH_TASK_PRIO_LO);
+}
+#endif
+
+/* Task message queue to a higher priority task */
+static void BenchTaskQTaskHi(void *p_arg)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+
+    while (DEF_TRUE)
+    {
+        (void)OSTaskQPend(0, OS_OPT_PEND_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        BenchSample(BENCH_TS_GET());
+    }
+}
+
+static void BenchTaskQTaskLo(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        OSTaskQPost(&BenchTaskTCB[0], (void *)&BenchTsStart, sizeof(BenchTsStart), OS_OPT_POST_FIFO, &err);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchTaskQStart(void)
+{
+    BenchTaskCreate(BenchTaskQTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchTaskQTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+/* Mutex handed from a low priority owner, raised by priority inheritance, to a high priority waiter */
+static void BenchMutexTaskHi(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&BenchMutex, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);      //Blocks, raises the owner
+        BenchSample(BENCH_TS_GET());
+        OSMutexPost(&BenchMutex, OS_OPT_POST_NONE, &err);
+    }
+}
+
+static void BenchMutexTaskLo(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSMutexPend(&BenchMutex, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSTaskSemPost(&BenchTaskTCB[0], OS_OPT_POST_NONE, &err);
+        BenchTsStart = BENCH_TS_GET();
+        OSMutexPost(&BenchMutex, OS_OPT_POST_NONE, &err);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchMutexStart(void)
+{
+    BenchTaskCreate(BenchMutexTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchTaskCreate(BenchMutexTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+/* Event flag broadcast, until the last (lowest priority) waiter runs */
+static void BenchFlagTaskWaiter(void *p_arg)
+{
+    OS_ERR err;
+    CPU_INT32U ix = (CPU_INT32U)(CPU_ADDR)p_arg;
+
+    while (DEF_TRUE)
+    {
+        (void)OSFlagPend(&BenchFlagGrp,
+                         BENCH_FLAG_BIT,
+                         0,
+                         OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_BLOCKING,
+                         (CPU_TS *)0,
+                         &err);
+        if (ix == BENCH_FLAG_WAITER_NBR - 1u)
+        {
+            BenchSample(BENCH_TS_GET());
+        }
+        OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);     //Wait to be rearmed
+    }
+}
+
+static void BenchFlagTaskPoster(void *p_arg)
+{
+    OS_ERR err;
+    CPU_INT32U i;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        (void)OSFlagPost(&BenchFlagGrp, BENCH_FLAG_BIT, OS_OPT_POST_FLAG_SET, &err);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+        (void)OSFlagPost(&BenchFlagGrp, BENCH_FLAG_BIT, OS_OPT_POST_FLAG_CLR, &err);
+        for (i = 0; i < BENCH_FLAG_WAITER_NBR; i++)     //Rearm the waiters
+        {
+            OSTaskSemPost(&BenchTaskTCB[i], OS_OPT_POST_NONE, &err);
+        }
+    }
+}
+
+static void BenchFlagStart(void)
+{
+    CPU_INT32U i;
+
+    for (i = 0; i < BENCH_FLAG_WAITER_NBR; i++)
+    {
+        BenchTaskCreate(BenchFlagTaskWaiter, (void *)(CPU_ADDR)i, (OS_PRIO)(BENCH_TASK_PRIO_HI + i));
+    }
+    BenchTaskCreate(BenchFlagTaskPoster, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+/* Memory partition */
+static void BenchMemGetTask(void *p_arg)
+{
+    OS_ERR err;
+    void *p_blk;
+    CPU_INT32U ts_end;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        p_blk = OSMemGet(&BenchMem, &err);
+        ts_end = BENCH_TS_GET();
+        OSMemPut(&BenchMem, p_blk, &err);
+        BenchSample(ts_end);
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchMemGetStart(void)
+{
+    BenchTaskCreate(BenchMemGetTask, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+static void BenchMemPutTask(void *p_arg)
+{
+    OS_ERR err;
+    void *p_blk;
+
+    while (DEF_TRUE)
+    {
+        p_blk = OSMemGet(&BenchMem, &err);
+        BenchTsStart = BENCH_TS_GET();
+        OSMemPut(&BenchMem, p_blk, &err);
+        BenchSample(BENCH_TS_GET());
+        if (BenchDone())
+        {
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchMemPutStart(void)
+{
+    BenchTaskCreate(BenchMemPutTask, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+/* Interrupt to task latency, the ISR signals a higher priority task than the interrupted one */
+void BenchIntHandler(void)
+{
+    OS_ERR err;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();
+    CPU_CRITICAL_EXIT();
+
+    if (BenchIntTCBPtr != (OS_TCB *)0)
+    {
+        OSTaskSemPost(BenchIntTCBPtr, OS_OPT_POST_NONE, &err);
+    }
+#if (OS_CFG_STREAM_EN > 0u)
+    if (BenchIntStreamPtr != (OS_STREAM *)0)
+    {
+        CPU_INT08U data = 0u;
+
+        (void)OSStreamWrite(BenchIntStreamPtr, (void *)&data, 1u, OS_OPT_POST_NONE, &err);
+    }
+#endif
+
+    OSIntExit();
+}
+
+static void BenchIntTaskLo(void *p_arg)
+{
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        BenchIntTrig();
+        if (BenchDone())
+        {
+            BenchIntTCBPtr = (OS_TCB *)0;
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchIntStart(void)
+{
+    BenchTaskCreate(BenchTaskSemTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchIntTCBPtr = &BenchTaskTCB[0];
+    BenchTaskCreate(BenchIntTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+/* Burst of interrupts, e.g. bytes received by a UART, the task is readied by each of them */
+static void BenchIntBurstTaskHi(void *p_arg)
+{
+    OS_ERR err;
+    CPU_INT32U i;
+
+    while (DEF_TRUE)
+    {
+        for (i = 0; i < BENCH_INT_BURST_NBR; i++)
+        {
+            OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        }
+        BenchSample(BENCH_TS_GET());
+    }
+}
+
+static void BenchIntBurstTaskLo(void *p_arg)
+{
+    CPU_INT32U i;
+
+    while (DEF_TRUE)
+    {
+        BenchTsStart = BENCH_TS_GET();
+        for (i = 0; i < BENCH_INT_BURST_NBR; i++)
+        {
+            BenchIntTrig();
+        }
+        if (BenchDone())
+        {
+            BenchIntTCBPtr = (OS_TCB *)0;
+#if (OS_CFG_STREAM_EN > 0u)
+            BenchIntStreamPtr = (OS_STREAM *)0;
+#endif
+            BenchFinish();
+        }
+    }
+}
+
+static void BenchIntBurstStart(void)
+{
+    BenchTaskCreate(BenchIntBurstTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchIntTCBPtr = &BenchTaskTCB[0];
+    BenchTaskCreate(BenchIntBurstTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+
+#if (OS_CFG_STREAM_EN > 0u)
+/* Same burst through a stream, the task is readied once the last byte is written */
+static void BenchIntStreamTaskHi(void *p_arg)
+{
+    OS_ERR err;
+    CPU_INT08U buf[BENCH_INT_BURST_NBR];
+
+    while (DEF_TRUE)
+    {
+        (void)OSStreamRead(&BenchStream, (void *)&buf[0], BENCH_INT_BURST_NBR, 0, OS_OPT_PEND_BLOCKING, &err);
+        BenchSample(BENCH_TS_GET());
+    }
+}
+
+static void BenchIntStreamStart(void)
+{
+    BenchTaskCreate(BenchIntStreamTaskHi, (void *)0, BENCH_TASK_PRIO_HI);
+    BenchIntStreamPtr = &BenchStream;
+    BenchTaskCreate(BenchIntBurstTaskLo, (void *)0, BENCH_TASK_PRIO_LO);
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                              UTILITIES
+*********************************************************************************************************
+*/
+
+static void BenchTaskCreate(OS_TASK_PTR p_task, void *p_arg, OS_PRIO prio)
+{
+    OS_ERR err;
+
+    OSTaskCreate((OS_TCB *)&BenchTaskTCB[BenchTaskNbr],
+                 (CPU_CHAR *)"Bench Task",
+                 (OS_TASK_PTR)p_task,
+                 (void *)p_arg,
+                 (OS_PRIO)prio,
+                 (CPU_STK *)&BenchTaskStk[BenchTaskNbr][0],
+                 (CPU_STK_SIZE)BENCH_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)BENCH_TASK_STK_SIZE,
+                 (OS_MSG_QTY)4u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+    BenchTaskNbr++;
+}
+
+static void BenchTestRun(const BENCH_TEST *p_test)
+{
+    OS_ERR err;
+    CPU_INT64U sum;
+    CPU_INT32U sw = 0u;
+    CPU_INT32U i;
+
+    BenchIterCtr = 0;
+    BenchTaskNbr = 0;
+#if ((OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u))
+    sw = (CPU_INT32U)OSTaskCtxSwCtr;
+#endif
+
+    p_test->Start();        //Tasks run as soon as we block
+
+    OSSemPend(&BenchDoneSem, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+
+#if ((OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u))
+    sw = ((CPU_INT32U)OSTaskCtxSwCtr - sw) * 100u / (BENCH_WARMUP_NBR + BENCH_SAMPLE_NBR); //x100
+#endif
+
+    for (i = 0; i < BenchTaskNbr; i++)
+    {
+        OSTaskDel(&BenchTaskTCB[i], &err);
+    }
+    OSSemSet(&BenchSem1, 0, &err);      //Leave the objects as created
+    OSSemSet(&BenchSem2, 0, &err);
+    OSQFlush(&BenchQ, &err);
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    OSQFlush(&BenchQPrio, &err);
+#endif
+    (void)OSFlagPost(&BenchFlagGrp, BENCH_FLAG_BIT, OS_OPT_POST_FLAG_CLR, &err);
+
+    BenchSort(BenchSampleTbl, BENCH_SAMPLE_NBR);
+    sum = 0;
+    for (i = 0; i < BENCH_SAMPLE_NBR; i++)
+    {
+        sum += BenchSampleTbl[i];
+    }
+
+    printf("%-36s %8lu %8lu %8lu %8lu %5lu.%02lu\n",
+           p_test->Name,
+           (unsigned long)(sum / BENCH_SAMPLE_NBR),
+           (unsigned long)BenchSampleTbl[BENCH_SAMPLE_NBR / 2u],
+           (unsigned long)BenchSampleTbl[(BENCH_SAMPLE_NBR * 99u) / 100u],
+           (unsigned long)BenchSampleTbl[BENCH_SAMPLE_NBR - 1u],
+           (unsigned long)(sw / 100u),
+           (unsigned long)(sw % 100u));
+    fflush(stdout);
+}
+
+static void BenchSample(CPU_INT32U ts_end)
+{
+    CPU_INT32U cnts;
+
+    if (BenchIterCtr >= BENCH_WARMUP_NBR + BENCH_SAMPLE_NBR)
+    {
+        return;
+    }
+
+    cnts = ts_end - BenchTsStart;
+    cnts = (cnts > BenchTsOvrhd) ? (cnts - BenchTsOvrhd) : 0u;
+    if (BenchIterCtr >= BENCH_WARMUP_NBR)
+    {
+        BenchSampleTbl[BenchIterCtr - BENCH_WARMUP_NBR] = cnts;
+    }
+    BenchIterCtr++;
+}
+
+static CPU_BOOLEAN BenchDone(void)
+{
+    return ((BenchIterCtr >= BENCH_WARMUP_NBR + BENCH_SAMPLE_NBR) ? DEF_TRUE : DEF_FALSE);
+}
+
+static void BenchFinish(void)
+{
+    OS_ERR err;
+
+    OSSemPost(&BenchDoneSem, OS_OPT_POST_1, &err);      //The benchmark task deletes us right away
+
+    while (DEF_TRUE)
+    {
+        OSTaskSuspend((OS_TCB *)0, &err);
+    }
+}
+
+static void BenchSort(CPU_INT32U *p_tbl, CPU_INT32U nbr)     //Shell sort, in place
+{
+    CPU_INT32U gap;
+    CPU_INT32U i;
+    CPU_INT32U j;
+    CPU_INT32U val;
+
+    for (gap = nbr / 2u; gap > 0u; gap /= 2u)
+    {
+        for (i = gap; i < nbr; i++)
+        {
+            val = p_tbl[i];
+            for (j = i; (j >= gap) && (p_tbl[j - gap] > val); j -= gap)
+            {
+                p_tbl[j] = p_tbl[j - gap];
+            }
+            p_tbl[j] = val;
+        }
+    }
+}
@@ -0,0 +1,247 @@
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "stm32f4xx_hal.h"
+#include "stm32f429i_discovery.h"
+#include "os.h"
+#include "bench.h"
+#include "wcet.h"
+#include "tmrbench.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/* Task Stack Size */
+#define APP_TASK_START_STK_SIZE 1024u
+
+/* Task Priority */
+#define APP_TASK_START_PRIO 1u
+
+/* DWT cycle counter, used as the CPU timestamp timer */
+#define BSP_REG_DEM_CR (*(CPU_REG32 *)0xE000EDFC)
+#define BSP_REG_DWT_CR (*(CPU_REG32 *)0xE0001000)
+#define BSP_REG_DWT_CYCCNT (*(CPU_REG32 *)0xE0001004)
+#define BSP_BIT_DEM_CR_TRCENA DEF_BIT_24
+#define BSP_BIT_DWT_CR_CYCCNTENA DEF_BIT_00
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/* Task Control Block */
+static OS_TCB AppTaskStartTCB;
+
+/* Task Stack */
+static CPU_STK AppTaskStartStk[APP_TASK_START_STK_SIZE];
+
+/* UART */
+UART_HandleTypeDef huart1;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/* Task Prototypes */
+static void AppTaskStart(void *p_arg);
+
+/* System Initilization Prototypes */
+void SystemClock_Config(void);
+static void MX_USART1_UART_Init(void);
+static void BenchInt_Init(void);
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int main(void)
+{
+    OS_ERR err;
+
+    OSInit(&err);
+
+    OSTaskCreate((OS_TCB *)&AppTaskStartTCB,
+                 (CPU_CHAR *)"App Task Start",
+                 (OS_TASK_PTR)AppTaskStart,
+                 (void *)0,
+                 (OS_PRIO)APP_TASK_START_PRIO,
+                 (CPU_STK *)&AppTaskStartStk[0],
+                 (CPU_STK_SIZE)APP_TASK_START_STK_SIZE / 10,
+                 (CPU_STK_SIZE)APP_TASK_START_STK_SIZE,
+                 (OS_MSG_QTY)5u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+
+    OSStart(&err);
+}
+
+/*
+*********************************************************************************************************
+*                                              STARTUP TASK
+*********************************************************************************************************
+*/
+
+static void AppTaskStart(void *p_arg)
+{
+    HAL_Init();
+
+    SystemClock_Config();
+
+    CPU_Init();     //Starts the DWT cycle counter, see CPU_TS_TmrInit()
+
+    BSP_LED_Init(LED3);
+    BSP_LED_Init(LED4);
+
+    MX_USART1_UART_Init();
+    BenchInt_Init();
+
+    BenchRun();
+    WcetRun();
+    TmrBenchRun();
+
+    BSP_LED_On(LED4);       //Indicate completed benchmarks
+}
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void CPU_TS_TmrInit(void)
+{
+    BSP_REG_DEM_CR |= BSP_BIT_DEM_CR_TRCENA;        //Enable the DWT unit
+    BSP_REG_DWT_CYCCNT = 0u;
+    BSP_REG_DWT_CR |= BSP_BIT_DWT_CR_CYCCNTENA;
+
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)HAL_RCC_GetHCLKFreq());
+}
+
+CPU_TS_TMR CPU_TS_TmrRd(void)
+{
+    return ((CPU_TS_TMR)BSP_REG_DWT_CYCCNT);
+}
+
+void BenchIntTrig(void)
+{
+    HAL_NVIC_SetPendingIRQ(EXTI0_IRQn);       //Software triggered, no EXTI line is configured
+}
+
+void EXTI0_IRQHandler(void)
+{
+    BenchIntHandler();
+}
+
+int _write(int file, char *ptr, int len)      //Route printf() to USART1
+{
+    HAL_UART_Transmit(&huart1, (uint8_t *)ptr, (uint16_t)len, HAL_MAX_DELAY);
+    return len;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    OS_ERR err;
+    OSTimeDly((OS_TICK)Delay,
+              (OS_OPT)OS_OPT_TIME_DLY,
+              (OS_ERR *)&err);
+}
+
+/*
+*********************************************************************************************************
+*                                      System Initializations
+*********************************************************************************************************
+*/
+
+static void BenchInt_Init(void)
+{
+    HAL_NVIC_SetPriority(EXTI0_IRQn, CPU_CFG_KA_IPL_BOUNDARY, 0);     //Kernel aware, may call OSTaskSemPost()
+    HAL_NVIC_EnableIRQ(EXTI0_IRQn);
+}
+
+static void MX_USART1_UART_Init(void)
+{
+    huart1.Instance = USART1;
+    huart1.Init.BaudRate = 115200;
+    huart1.Init.WordLength = UART_WORDLENGTH_8B;
+    huart1.Init.StopBits = UART_STOPBITS_1;
+    huart1.Init.Parity = UART_PARITY_NONE;
+    huart1.Init.Mode = UART_MODE_TX_RX;
+    huart1.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+    huart1.Init.OverSampling = UART_OVERSAMPLING_16;
+    if (HAL_UART_Init(&huart1) == HAL_OK)
+    {
+        BSP_LED_On(LED3);
+    }
+}
+
+void HAL_UART_MspInit(UART_HandleTypeDef *huart)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+    if (huart->Instance == USART1)
+    {
+        /* Peripheral clock enable */
+        __HAL_RCC_USART1_CLK_ENABLE();
+
+        __HAL_RCC_GPIOA_CLK_ENABLE();
+        /**USART1 GPIO Configuration
+        PA9 ------> USART1_TX
+        PA10 ------> USART1_RX
+        */
+        GPIO_InitStruct.Pin = GPIO_PIN_9 | GPIO_PIN_10;
+        GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+        GPIO_InitStruct.Pull = GPIO_NOPULL;
+        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+        GPIO_InitStruct.Alternate = GPIO_AF7_USART1;
+        HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+    }
+}
+
+void SystemClock_Config(void)
+{
+    RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+    RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+
+    /** Configure the main internal regulator output voltage
+  */
+    __HAL_RCC_PWR_CLK_ENABLE();
+    __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+    /** Initializes the CPU, AHB and APB busses clocks
+  */
+    RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+    RCC_OscInitStruct.HSIState = RCC_HSI_ON;
+    RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+    RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+    RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+    RCC_OscInitStruct.PLL.PLLM = 8;
+    RCC_OscInitStruct.PLL.PLLN = 180;
+    RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+    RCC_OscInitStruct.PLL.PLLQ = 7;
+    HAL_RCC_OscConfig(&RCC_OscInitStruct);
+
+    /** Activate the Over-Drive mode
+  */
+    HAL_PWREx_EnableOverDrive();
+
+    /** Initializes the CPU, AHB and APB busses clocks
+  */
+    RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+    RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+    RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+    RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;
+    RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;
+
+    HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5);
+}
@@ -0,0 +1,446 @@
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <stdio.h>
+#include "wcet.h"
+
+#ifndef CPU_CFG_INT_DIS_MEAS_EN
+#error "CPU_CFG_INT_DIS_MEAS_EN MUST be defined (see platformio.ini build_flags)"
+#endif
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define WCET_FLAG_BIT ((OS_FLAGS)0x01u)
+#define WCET_TICK_MARGIN 10u            //Ticks given to the waiters to start their delay
+#define WCET_TMR_DLY 1000u              //Timer delays, long enough for no timer to expire
+
+#define WCET_TS_GET() ((CPU_INT32U)CPU_TS_TmrRd())
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef struct wcet_test
+{
+    const CPU_CHAR *Name;
+    CPU_INT32U (*Run)(CPU_INT32U n);    //Worst case for 'n' objects, in CPU_TS_TmrRd() counts
+} WCET_TEST;
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/* Task Control Block */
+static OS_TCB WcetDriverTCB;
+static OS_TCB WcetTaskTCB[WCET_OBJ_NBR_MAX];
+
+/* Task Stack */
+static CPU_STK WcetDriverStk[WCET_DRIVER_STK_SIZE];
+static CPU_STK WcetTaskStk[WCET_OBJ_NBR_MAX][WCET_TASK_STK_SIZE];
+
+/* OS Kernal Objects */
+static OS_SEM WcetDoneSem;
+static OS_SEM WcetSem;
+static OS_FLAG_GRP WcetFlagGrp;
+static OS_MUTEX WcetMutex[WCET_OBJ_NBR_MAX];
+static OS_TMR WcetTmr[WCET_OBJ_NBR_MAX + 1u];
+
+static OS_TICK WcetTickMatch;           //Tick on which all the delayed waiters expire
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void WcetDriverTask(void *p_arg);
+
+/* Scenarios */
+static CPU_INT32U WcetPendListRun(CPU_INT32U n);
+static CPU_INT32U WcetTickListRun(CPU_INT32U n);
+static CPU_INT32U WcetFlagPostRun(CPU_INT32U n);
+static CPU_INT32U WcetMutexGrpRun(CPU_INT32U n);
+static CPU_INT32U WcetTmrLinkRun(CPU_INT32U n);
+
+/* Utilities */
+static void WcetTaskCreate(CPU_INT32U ix, OS_TASK_PTR p_task, OS_PRIO prio);
+static void WcetTaskDel(CPU_INT32U n);
+static void WcetMaskedReset(void);
+static CPU_INT32U WcetMaskedGet(void);
+
+/*
+*********************************************************************************************************
+*                                           SCENARIO TABLE
+*********************************************************************************************************
+*/
+
+static const WCET_TEST WcetTestTbl[] = {
+    {"PendList", WcetPendListRun},      //OS_PendListInsertPrio(), n tasks already waiting
+    {"TickList", WcetTickListRun},      //OS_TickListUpdate(), n tasks expire on the same tick
+    {"FlagPost", WcetFlagPostRun},      //OSFlagPost() readies n waiters
+    {"MutexGrp", WcetMutexGrpRun},      //OS_MutexGrpPrioFindHighest(), n mutexes owned
+    {"TmrLink*", WcetTmrLinkRun},       //OS_TmrLink(), n timers running
+};
+
+#define WCET_TEST_NBR (sizeof(WcetTestTbl) / sizeof(WcetTestTbl[0]))
+
+/*
+*********************************************************************************************************
+*                                             RUN THE SWEEP
+*********************************************************************************************************
+*/
+
+void WcetRun(void)
+{
+    OS_ERR err;
+
+    OSSemCreate(&WcetDoneSem, (CPU_CHAR *)"Wcet Done", 0, &err);
+
+    OSTaskCreate((OS_TCB *)&WcetDriverTCB,      //Runs below the waiters it creates
+                 (CPU_CHAR *)"Wcet Driver",
+                 (OS_TASK_PTR)WcetDriverTask,
+                 (void *)0,
+                 (OS_PRIO)WCET_TASK_PRIO_LO,
+                 (CPU_STK *)&WcetDriverStk[0],
+                 (CPU_STK_SIZE)WCET_DRIVER_STK_SIZE / 10,
+                 (CPU_STK_SIZE)WCET_DRIVER_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+
+    OSSemPend(&WcetDoneSem, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+
+    OSTaskDel(&WcetDriverTCB, &err);
+}
+
+static void WcetDriverTask(void *p_arg)
+{
+    OS_ERR err;
+    CPU_ERR cpu_err;
+    CPU_INT32U budget;
+    CPU_INT32U cnts;
+    CPU_INT32U n;
+    CPU_INT32U i;
+
+    OSSemCreate(&WcetSem, (CPU_CHAR *)"Wcet Sem", 0, &err);
+    OSFlagCreate(&WcetFlagGrp, (CPU_CHAR *)"Wcet Flags", 0, &err);
+
+    budget = (CPU_INT32U)(((CPU_INT64U)CPU_TS_TmrFreqGet(&cpu_err) * WCET_BUDGET_US) / 1000000u);
+
+    printf("\nWorst case, counts with interrupts masked (largest of %u runs), budget %u us = %lu counts\n\n",
+           (unsigned)WCET_REPEAT_NBR, (unsigned)WCET_BUDGET_US, (unsigned long)budget);
+    printf("%5s", "n");
+    for (i = 0; i < WCET_TEST_NBR; i++)
+    {
+        printf(" %10s", WcetTestTbl[i].Name);
+    }
+    printf("\n");
+
+    for (n = 1; n <= WCET_OBJ_NBR_MAX; n *= 2u)
+    {
+        printf("%5lu", (unsigned long)n);
+        for (i = 0; i < WCET_TEST_NBR; i++)
+        {
+            cnts = WcetTestTbl[i].Run(n);
+            printf(" %9lu%c", (unsigned long)cnts, (cnts > budget) ? '!' : ' ');
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+    printf("\n* time holding the timer lock, OS_TmrLink() runs with interrupts enabled\n");
+    printf("! over budget\n");
+    fflush(stdout);
+
+    OSFlagDel(&WcetFlagGrp, OS_OPT_DEL_ALWAYS, &err);
+    OSSemDel(&WcetSem, OS_OPT_DEL_ALWAYS, &err);
+
+    OSSemPost(&WcetDoneSem, OS_OPT_POST_1, &err);       //WcetRun() deletes us right away
+    while (DEF_TRUE)
+    {
+        OSTaskSuspend((OS_TCB *)0, &err);
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                              SCENARIOS
+*********************************************************************************************************
+*/
+
+/* Pend behind n tasks of higher priority, so the insertion walks the whole pend list */
+static void WcetSemWaiter(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSSemPend(&WcetSem, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
+
+static CPU_INT32U WcetPendListRun(CPU_INT32U n)
+{
+    OS_ERR err;
+    CPU_INT32U worst = 0u;
+    CPU_INT32U cnts;
+    CPU_INT32U r;
+    CPU_INT32U i;
+
+    for (i = 0; i < n; i++)
+    {
+        WcetTaskCreate(i, WcetSemWaiter, WCET_TASK_PRIO_HI);        //Runs & pends at once
+    }
+
+    for (r = 0; r < WCET_REPEAT_NBR; r++)
+    {
+        WcetMaskedReset();
+        OSSemPend(&WcetSem, 1u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);     //Times out on the next tick
+        cnts = WcetMaskedGet();
+        worst = (cnts > worst) ? cnts : worst;
+    }
+
+    WcetTaskDel(n);
+    return worst;
+}
+
+/* n tasks delayed until the same tick */
+static void WcetDlyWaiter(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSTimeDly(WcetTickMatch, OS_OPT_TIME_MATCH, &err);
+    }
+}
+
+static CPU_INT32U WcetTickListRun(CPU_INT32U n)
+{
+    OS_ERR err;
+    CPU_INT32U worst = 0u;
+    CPU_INT32U cnts;
+    CPU_INT32U r;
+    CPU_INT32U i;
+
+    for (i = 0; i < n; i++)
+    {
+        WcetTaskCreate(i, WcetDlyWaiter, WCET_TASK_PRIO_HI);
+    }
+
+    for (r = 0; r < WCET_REPEAT_NBR; r++)
+    {
+        WcetTickMatch = OSTimeGet(&err) + WCET_TICK_MARGIN;
+        for (i = 0; i < n; i++)
+        {
+            OSTaskSemPost(&WcetTaskTCB[i], OS_OPT_POST_NONE, &err);      //Starts its delay at once
+        }
+        WcetMaskedReset();
+        OSTimeDly(WcetTickMatch + 1u, OS_OPT_TIME_MATCH, &err);         //Wake up right after them
+        cnts = WcetMaskedGet();
+        worst = (cnts > worst) ? cnts : worst;
+    }
+
+    WcetTaskDel(n);
+    return worst;
+}
+
+/* Set a flag n tasks are waiting for */
+static void WcetFlagWaiter(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        (void)OSFlagPend(&WcetFlagGrp,
+                         WCET_FLAG_BIT,
+                         0,
+                         OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_BLOCKING,
+                         (CPU_TS *)0,
+                         &err);
+        OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);     //Wait to be rearmed
+    }
+}
+
+static CPU_INT32U WcetFlagPostRun(CPU_INT32U n)
+{
+    OS_ERR err;
+    CPU_INT32U worst = 0u;
+    CPU_INT32U cnts;
+    CPU_INT32U r;
+    CPU_INT32U i;
+
+    for (i = 0; i < n; i++)
+    {
+        WcetTaskCreate(i, WcetFlagWaiter, WCET_TASK_PRIO_HI);
+    }
+
+    for (r = 0; r < WCET_REPEAT_NBR; r++)
+    {
+        WcetMaskedReset();
+        (void)OSFlagPost(&WcetFlagGrp, WCET_FLAG_BIT, OS_OPT_POST_FLAG_SET, &err);
+        cnts = WcetMaskedGet();
+        worst = (cnts > worst) ? cnts : worst;
+
+        (void)OSFlagPost(&WcetFlagGrp, WCET_FLAG_BIT, OS_OPT_POST_FLAG_CLR, &err);
+        for (i = 0; i < n; i++)
+        {
+            OSTaskSemPost(&WcetTaskTCB[i], OS_OPT_POST_NONE, &err);
+        }
+    }
+
+    WcetTaskDel(n);
+    return worst;
+}
+
+/* Release one of n owned mutexes while raised by priority inheritance */
+static void WcetMutexWaiter(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&WcetMutex[0], 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);       //Raises the driver
+        OSMutexPost(&WcetMutex[0], OS_OPT_POST_NONE, &err);
+    }
+}
+
+static CPU_INT32U WcetMutexGrpRun(CPU_INT32U n)
+{
+    OS_ERR err;
+    CPU_INT32U worst = 0u;
+    CPU_INT32U cnts;
+    CPU_INT32U r;
+    CPU_INT32U i;
+
+    for (i = 0; i < n; i++)
+    {
+        OSMutexCreate(&WcetMutex[i], (CPU_CHAR *)"Wcet Mutex", &err);
+        OSMutexPend(&WcetMutex[i], 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+    WcetTaskCreate(0, WcetMutexWaiter, WCET_TASK_PRIO_HI);
+
+    for (r = 0; r < WCET_REPEAT_NBR; r++)
+    {
+        OSTaskSemPost(&WcetTaskTCB[0], OS_OPT_POST_NONE, &err);     //Waiter blocks on WcetMutex[0]
+        WcetMaskedReset();
+        OSMutexPost(&WcetMutex[0], OS_OPT_POST_NONE, &err);         //Drop back to our base priority
+        cnts = WcetMaskedGet();
+        worst = (cnts > worst) ? cnts : worst;
+
+        OSMutexPend(&WcetMutex[0], 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+
+    WcetTaskDel(1u);
+    for (i = 0; i < n; i++)
+    {
+        OSMutexPost(&WcetMutex[i], OS_OPT_POST_NONE, &err);
+        OSMutexDel(&WcetMutex[i], OS_OPT_DEL_ALWAYS, &err);
+    }
+    return worst;
+}
+
+/* (Re)start a timer expiring after n running timers */
+static CPU_INT32U WcetTmrLinkRun(CPU_INT32U n)
+{
+    OS_ERR err;
+    CPU_INT32U worst = 0u;
+    CPU_INT32U cnts;
+    CPU_INT32U r;
+    CPU_INT32U i;
+
+    for (i = 0; i <= n; i++)
+    {
+        OSTmrCreate(&WcetTmr[i],
+                    (CPU_CHAR *)"Wcet Tmr",
+                    (OS_TICK)(WCET_TMR_DLY + i),
+                    (OS_TICK)0,
+                    OS_OPT_TMR_ONE_SHOT,
+                    (OS_TMR_CALLBACK_PTR)0,
+                    (void *)0,
+                    &err);
+    }
+    for (i = 0; i < n; i++)
+    {
+        (void)OSTmrStart(&WcetTmr[i], &err);
+    }
+
+    for (r = 0; r < WCET_REPEAT_NBR; r++)
+    {
+        cnts = WCET_TS_GET();
+        (void)OSTmrStart(&WcetTmr[n], &err);
+        cnts = WCET_TS_GET() - cnts;
+        worst = (cnts > worst) ? cnts : worst;
+    }
+
+    for (i = 0; i <= n; i++)
+    {
+        (void)OSTmrDel(&WcetTmr[i], &err);
+    }
+    return worst;
+}
+
+/*
+*********************************************************************************************************
+*                                              UTILITIES
+*********************************************************************************************************
+*/
+
+static void WcetTaskCreate(CPU_INT32U ix, OS_TASK_PTR p_task, OS_PRIO prio)
+{
+    OS_ERR err;
+
+    OSTaskCreate((OS_TCB *)&WcetTaskTCB[ix],
+                 (CPU_CHAR *)"Wcet Task",
+                 (OS_TASK_PTR)p_task,
+                 (void *)0,
+                 (OS_PRIO)prio,
+                 (CPU_STK *)&WcetTaskStk[ix][0],
+                 (CPU_STK_SIZE)WCET_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)WCET_TASK_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+}
+
+static void WcetTaskDel(CPU_INT32U n)
+{
+    OS_ERR err;
+    CPU_INT32U i;
+
+    for (i = 0; i < n; i++)
+    {
+        OSTaskDel(&WcetTaskTCB[i], &err);
+    }
+}
+
+/* OSTaskSwHook() resets the per-task maximum on every switch, the global maximum spans the whole run */
+static void WcetMaskedReset(void)
+{
+    CPU_SR_ALLOC();
+
+    CPU_INT_DIS();
+    CPU_IntDisMeasMax_cnts = 0u;
+    CPU_INT_EN();
+}
+
+static CPU_INT32U WcetMaskedGet(void)
+{
+    return ((CPU_INT32U)CPU_IntDisMeasMaxGet());
+}
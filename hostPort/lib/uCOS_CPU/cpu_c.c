@@ -0,0 +1,569 @@
+/*
+*********************************************************************************************************
+*                                               uC/CPU
+*                                    CPU CONFIGURATION & PORT LAYER
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                            CPU PORT FILE
+*
+*                                         POSIX (Linux host)
+*
+* Filename : cpu_c.c
+* Version  : v1.32.00
+*********************************************************************************************************
+* Note(s)  : (1) See 'cpu.h  Note #1'.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    _GNU_SOURCE
+#define    MICRIUM_SOURCE
+#include  <cpu.h>
+#include  <cpu_core.h>
+
+#include  <lib_def.h>
+
+#include  <signal.h>
+#include  <time.h>
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  CPU_TS_TMR_CAL_NS                          10000000u   /* Cycle counter calibration window (10 ms).            */
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*
+* Note(s) : (1) The virtual interrupt controller is made of :
+*
+*               (a) CPU_IntDisFlag      the interrupt mask (PRIMASK) : 1 while interrupts are disabled.
+*               (b) CPU_IntSrcPendTbl   one pending bit per interrupt table position.
+*               (c) CPU_IntSrcEnTbl     one enable  bit per interrupt table position.
+*               (d) CPU_IntSrcHandlerTbl the vector table.
+*
+*           (2) Pending bits are set from POSIX signal handlers & MUST only be modified with atomic
+*               read-modify-write operations.
+*********************************************************************************************************
+*/
+
+static  volatile  CPU_INT32U     CPU_IntDisFlag;
+static  volatile  CPU_INT32U     CPU_IntSrcPendTbl;
+static  volatile  CPU_INT32U     CPU_IntSrcEnTbl;
+static            CPU_FNCT_VOID  CPU_IntSrcHandlerTbl[CPU_INT_SRC_POS_MAX];
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  CPU_IntSrcDispatch(void);
+
+
+/*
+*********************************************************************************************************
+*                                    CPU_IntDis() / CPU_IntEn()
+*
+* Description : Disable/enable the virtual interrupts.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Interrupts held pending while disabled are taken by CPU_IntEn().
+*********************************************************************************************************
+*/
+
+void  CPU_IntDis (void)
+{
+    CPU_IntDisFlag = 1u;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+
+void  CPU_IntEn (void)
+{
+    CPU_SR_Restore(0u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  CPU_SR_Save() / CPU_SR_Restore()
+*
+* Description : Save & disable / restore the virtual interrupt mask.
+*
+* Argument(s) : cpu_sr      Interrupt mask previously returned by CPU_SR_Save().
+*
+* Return(s)   : CPU_SR_Save() returns the interrupt mask in effect before the call.
+*
+* Note(s)     : (1) Only compiler barriers are needed : the mask is shared with signal handlers running
+*                   on the same thread, not with other processors.
+*
+*               (2) Re-enabling interrupts takes every pending & enabled interrupt, like the NVIC does
+*                   when PRIMASK/BASEPRI is cleared.
+*********************************************************************************************************
+*/
+
+CPU_SR  CPU_SR_Save (void)
+{
+    CPU_SR  cpu_sr;
+
+
+    cpu_sr         = CPU_IntDisFlag;
+    CPU_IntDisFlag = 1u;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);                    /* See Note #1.                                         */
+
+    return (cpu_sr);
+}
+
+
+void  CPU_SR_Restore (CPU_SR  cpu_sr)
+{
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    CPU_IntDisFlag = cpu_sr;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+
+    if (cpu_sr == 0u) {                                         /* See Note #2.                                         */
+        if ((CPU_IntSrcPendTbl & CPU_IntSrcEnTbl) != 0u) {
+            CPU_IntSrcDispatch();
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           CPU_IntSrcDis()
+*
+* Description : Disable an interrupt source.
+*
+* Argument(s) : pos     Position of interrupt vector in the virtual interrupt table (see 'cpu.h
+*                       INTERRUPT SOURCES').
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcDis (CPU_INT08U  pos)
+{
+    if (pos < CPU_INT_SRC_POS_MAX) {
+        (void)__atomic_fetch_and(&CPU_IntSrcEnTbl, ~DEF_BIT32(pos), __ATOMIC_SEQ_CST);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           CPU_IntSrcEn()
+*
+* Description : Enable an interrupt source.
+*
+* Argument(s) : pos     Position of interrupt vector in the virtual interrupt table.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) An interrupt that became pending while its source was disabled is taken as soon as
+*                   the source is enabled, if interrupts are enabled.
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcEn (CPU_INT08U  pos)
+{
+    CPU_SR_ALLOC();
+
+
+    if (pos < CPU_INT_SRC_POS_MAX) {
+        CPU_CRITICAL_ENTER();
+        (void)__atomic_fetch_or(&CPU_IntSrcEnTbl, DEF_BIT32(pos), __ATOMIC_SEQ_CST);
+        CPU_CRITICAL_EXIT();                                    /* See Note #1.                                         */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_IntSrcPendClr()
+*
+* Description : Clear a pending interrupt.
+*
+* Argument(s) : pos     Position of interrupt vector in the virtual interrupt table.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcPendClr (CPU_INT08U  pos)
+{
+    if (pos < CPU_INT_SRC_POS_MAX) {
+        (void)__atomic_fetch_and(&CPU_IntSrcPendTbl, ~DEF_BIT32(pos), __ATOMIC_SEQ_CST);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_IntSrcPendSet()
+*
+* Description : Raise an interrupt.
+*
+* Argument(s) : pos     Position of interrupt vector in the virtual interrupt table.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) This function may be called from a POSIX signal handler; it is the host equivalent of
+*                   a peripheral asserting its interrupt line.
+*
+*               (2) The interrupt is taken immediately if interrupts are enabled, otherwise it remains
+*                   pending until they are re-enabled.
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcPendSet (CPU_INT08U  pos)
+{
+    if (pos >= CPU_INT_SRC_POS_MAX) {
+        return;
+    }
+
+    (void)__atomic_fetch_or(&CPU_IntSrcPendTbl, DEF_BIT32(pos), __ATOMIC_SEQ_CST);
+
+    if (CPU_IntDisFlag == 0u) {                                 /* See Note #2.                                         */
+        if ((CPU_IntSrcPendTbl & CPU_IntSrcEnTbl) != 0u) {
+            CPU_IntSrcDispatch();
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntSrcHandlerSet()
+*
+* Description : Install an interrupt handler in the virtual vector table.
+*
+* Argument(s) : pos         Position of interrupt vector in the virtual interrupt table.
+*
+*               handler     Interrupt handler.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcHandlerSet (CPU_INT08U     pos,
+                            CPU_FNCT_VOID  handler)
+{
+    CPU_SR_ALLOC();
+
+
+    if (pos < CPU_INT_SRC_POS_MAX) {
+        CPU_CRITICAL_ENTER();
+        CPU_IntSrcHandlerTbl[pos] = handler;
+        CPU_CRITICAL_EXIT();
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          CPU_WaitForInt()
+*
+* Description : Enters sleep state, which will be exited when an interrupt is received.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The process sleeps until the next signal; the signal handler takes the interrupt
+*                   before sigsuspend() returns.
+*********************************************************************************************************
+*/
+
+void  CPU_WaitForInt (void)
+{
+    sigset_t  mask;
+
+
+    sigemptyset(&mask);
+    sigsuspend(&mask);                                          /* See Note #1.                                         */
+}
+
+
+void  CPU_WaitForExcept (void)
+{
+    CPU_WaitForInt();
+}
+
+
+/*
+*********************************************************************************************************
+*                                            CPU_RevBits()
+*
+* Description : Reverse the bits in a data value.
+*
+* Argument(s) : val         Data value to reverse bits.
+*
+* Return(s)   : Value with all bits in 'val' reversed.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_DATA  CPU_RevBits (CPU_DATA  val)
+{
+    CPU_DATA    val_rev;
+    CPU_INT08U  ix;
+
+
+    val_rev = 0u;
+    for (ix = 0u; ix < DEF_INT_CPU_NBR_BITS; ix++) {
+        val_rev = (val_rev << 1u) | (val & 1u);
+        val   >>= 1u;
+    }
+
+    return (val_rev);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 CPU_CntLeadZeros() / CPU_CntTrailZeros()
+*
+* Description : Count the number of contiguous, most-significant/least-significant, leading/trailing
+*               zero bits in a data value.
+*
+* Argument(s) : val         Data value to count zero bits.
+*
+* Return(s)   : Number of contiguous zero bits in 'val'.
+*
+* Note(s)     : (1) The GCC built-ins compile to LZCNT/BSR/CLZ; their result is undefined for zero, which
+*                   returns the data word size like the Cortex-M CLZ instruction.
+*********************************************************************************************************
+*/
+
+CPU_DATA  CPU_CntLeadZeros (CPU_DATA  val)
+{
+    if (val == 0u) {                                            /* See Note #1.                                         */
+        return (DEF_INT_CPU_NBR_BITS);
+    }
+
+    return ((CPU_DATA)__builtin_clz(val));
+}
+
+
+CPU_DATA  CPU_CntTrailZeros (CPU_DATA  val)
+{
+    if (val == 0u) {                                            /* See Note #1.                                         */
+        return (DEF_INT_CPU_NBR_BITS);
+    }
+
+    return ((CPU_DATA)__builtin_ctz(val));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          CPU_TS_TmrInit()
+*
+* Description : Initialize & start CPU timestamp timer.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) On x86-64 the timestamp timer is the invariant TSC, read with RDTSC.  Its frequency is
+*                   calibrated against CLOCK_MONOTONIC.
+*
+*               (2) On other hosts the timestamp timer counts CLOCK_MONOTONIC nanoseconds.
+*
+*               (3) The POSIX port's virtual time simulation (OS_CPU_CFG_SIM_EN) provides its own
+*                   CPU_TS_TmrInit() & CPU_TS_TmrRd(), based on the virtual clock.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED) && \
+   (!defined(OS_CPU_CFG_SIM_EN) || (OS_CPU_CFG_SIM_EN == 0u))   /* See Note #3.                                         */
+void  CPU_TS_TmrInit (void)
+{
+#if defined(__x86_64__) || defined(__i386__)                    /* See Note #1.                                         */
+    struct timespec  ts_start;
+    struct timespec  ts_now;
+    CPU_INT64U       ns;
+    CPU_INT64U       tsc_start;
+    CPU_INT64U       tsc_stop;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts_start);
+    tsc_start = __builtin_ia32_rdtsc();
+    do {
+        clock_gettime(CLOCK_MONOTONIC, &ts_now);
+        ns = (CPU_INT64U)(ts_now.tv_sec  - ts_start.tv_sec) * 1000000000u
+           + (CPU_INT64U) ts_now.tv_nsec
+           - (CPU_INT64U) ts_start.tv_nsec;
+    } while (ns < CPU_TS_TMR_CAL_NS);
+    tsc_stop  = __builtin_ia32_rdtsc();
+
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)(((tsc_stop - tsc_start) * 1000000000u) / ns));
+#else
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)1000000000u);            /* See Note #2.                                         */
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           CPU_TS_TmrRd()
+*
+* Description : Get current CPU timestamp timer count value.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Timestamp timer count (see 'CPU_TS_TmrInit()  Note #1 & #2').
+*
+* Note(s)     : (1) See 'CPU_TS_TmrInit()  Note #3'.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED) && \
+   (!defined(OS_CPU_CFG_SIM_EN) || (OS_CPU_CFG_SIM_EN == 0u))   /* See Note #1.                                         */
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return ((CPU_TS_TMR)__builtin_ia32_rdtsc());
+#else
+    struct timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((CPU_TS_TMR)((CPU_INT64U)ts.tv_sec * 1000000000u + (CPU_INT64U)ts.tv_nsec));
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_TS32_to_uSec()
+*
+* Description : Convert a 32-bit CPU timestamp from timer counts to microseconds.
+*
+* Argument(s) : ts_cnts   CPU timestamp (in timestamp timer counts).
+*
+* Return(s)   : Converted CPU timestamp (in microseconds).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+CPU_INT64U  CPU_TS32_to_uSec (CPU_TS32  ts_cnts)
+{
+    CPU_TS_TMR_FREQ  freq_hz;
+    CPU_ERR          err;
+
+
+    freq_hz = CPU_TS_TmrFreqGet(&err);
+    if ((err != CPU_ERR_NONE) || (freq_hz == 0u)) {
+        return (0u);
+    }
+
+    return (((CPU_INT64U)ts_cnts * 1000000u) / freq_hz);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntSrcDispatch()
+*
+* Description : Take every pending & enabled interrupt, lowest table position first.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Handlers run with interrupts disabled, so interrupts do not nest.  A handler may switch
+*                   to another task (through OSIntExit()); this dispatch then resumes when that task is
+*                   switched back in.
+*
+*               (2) A signal that arrives between the last check & re-enabling interrupts only sets its
+*                   pending bit, so the pending table is checked again once interrupts are enabled.
+*********************************************************************************************************
+*/
+
+static  void  CPU_IntSrcDispatch (void)
+{
+    CPU_INT32U     pend;
+    CPU_DATA       pos;
+    CPU_FNCT_VOID  handler;
+
+
+    do {
+        CPU_IntDisFlag = 1u;                                    /* See Note #1.                                         */
+        __atomic_signal_fence(__ATOMIC_SEQ_CST);
+
+        pend = CPU_IntSrcPendTbl & CPU_IntSrcEnTbl;
+        while (pend != 0u) {
+            pos = CPU_CntTrailZeros(pend);
+            (void)__atomic_fetch_and(&CPU_IntSrcPendTbl, ~DEF_BIT32(pos), __ATOMIC_SEQ_CST);
+            handler = CPU_IntSrcHandlerTbl[pos];
+            if (handler != (CPU_FNCT_VOID)0) {
+                handler();
+            }
+            pend = CPU_IntSrcPendTbl & CPU_IntSrcEnTbl;
+        }
+
+        __atomic_signal_fence(__ATOMIC_SEQ_CST);
+        CPU_IntDisFlag = 0u;
+        __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    } while ((CPU_IntSrcPendTbl & CPU_IntSrcEnTbl) != 0u);      /* See Note #2.                                         */
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,199 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              POSIX Port
+*
+* File      : os_cpu.h
+* Version   : V3.08.00
+*********************************************************************************************************
+* For       : Linux host (x86-64, AArch64)
+* Mode      : Single process, single thread
+* Toolchain : GNU C Compiler
+*********************************************************************************************************
+* Note(s)   : (1) Tasks are ucontext(3) contexts switched on the process' only thread; the tick
+*                 interrupt is a SIGALRM delivered by an interval timer (see 'os_cpu_c.c').
+*             (2) The C library is NOT re-entrant across tasks.  Tasks that call into stdio, malloc(),
+*                 etc. MUST serialize those calls (e.g. with a mutex) so that a task preempted inside
+*                 the C library does not have another task re-enter it.
+*             (3) Setting OS_CPU_CFG_SIM_EN (e.g. with -DOS_CPU_CFG_SIM_EN=1) replaces the host clock with a
+*                 deterministic virtual clock (see 'os_cpu_sim.c').
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_H
+#define  OS_CPU_H
+
+#ifdef   OS_CPU_GLOBALS
+#define  OS_CPU_EXT
+#else
+#define  OS_CPU_EXT  extern
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     EXTERNAL C LANGUAGE LINKAGE
+*
+* Note(s) : (1) C++ compilers MUST 'extern'ally declare ALL C function prototypes & variable/object
+*               declarations for correct C language linkage.
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+extern  "C" {                                    /* See Note #1.                                       */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+* Note(s) : (1) The host 'SysTick' counts at 1 MHz, so OS_CPU_SysTickInit() is given microseconds.  The
+*               virtual 'SysTick' counts the cycles of the STM32F429 core clock.
+*
+*           (2) Size, in bytes, of the host stack allocated to each task (see 'os_cpu_c.c  OSTaskStkInit()
+*               Note #2').
+*
+*           (3) Maximum number of simulated peripheral interrupts scheduled at once (see 'os_cpu_sim.c
+*               OS_CPU_SimIntPend()').
+*
+*           (4) The microsecond timer (OS_CFG_TIME_DLY_US_EN) takes the last position of the virtual
+*               interrupt table, after the peripheral interrupts of the application.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_CFG_SIM_EN
+#define  OS_CPU_CFG_SIM_EN                          0u   /* Virtual time simulation (see file Note #3)         */
+#endif
+
+#if     (OS_CPU_CFG_SIM_EN > 0u)
+#define  OS_CPU_SYS_TICK_FREQ_HZ            180000000u   /* See Note #1.                                       */
+#else
+#define  OS_CPU_SYS_TICK_FREQ_HZ              1000000u   /* See Note #1.                                       */
+#endif
+
+#ifndef  OS_CPU_CFG_HOST_STK_SIZE
+#define  OS_CPU_CFG_HOST_STK_SIZE          (64u * 1024u) /* See Note #2.                                       */
+#endif
+
+#ifndef  OS_CPU_CFG_SIM_EVT_NBR
+#define  OS_CPU_CFG_SIM_EVT_NBR                    16u   /* See Note #3.                                       */
+#endif
+
+#define  OS_CPU_US_TMR_INT_POS    (CPU_INT_SRC_POS_MAX - 1u) /* See Note #4.                                       */
+                                                         /* SysTick counts per microsecond                     */
+#define  OS_CPU_US_TMR_CNTS       (OS_CPU_SYS_TICK_FREQ_HZ / 1000000u)
+
+
+/*
+*********************************************************************************************************
+*                                               MACROS
+*********************************************************************************************************
+*/
+
+#define  OS_TASK_SW()               OSCtxSw()
+
+
+/*
+*********************************************************************************************************
+*                                       TIMESTAMP CONFIGURATION
+*
+* Note(s) : (1) OS_TS_GET() is generally defined as CPU_TS_Get32() to allow CPU timestamp timer to be of
+*               any data type size.
+*
+*           (2) For architectures that provide 32-bit or higher precision free running counters
+*               (i.e. cycle count registers):
+*
+*               (a) OS_TS_GET() may be defined as CPU_TS_TmrRd() to improve performance when retrieving
+*                   the timestamp.
+*
+*               (b) CPU_TS_TmrRd() MUST be configured to be greater or equal to 32-bits to avoid
+*                   truncation of TS.
+*********************************************************************************************************
+*/
+
+#if      OS_CFG_TS_EN == 1u
+#define  OS_TS_GET()               (CPU_TS)CPU_TS_TmrRd()   /* See Note #2a.                                          */
+#else
+#define  OS_TS_GET()               (CPU_TS)0u
+#endif
+
+#if (CPU_CFG_TS_32_EN    > 0u) && \
+    (CPU_CFG_TS_TMR_SIZE < CPU_WORD_SIZE_32)
+                                                            /* CPU_CFG_TS_TMR_SIZE MUST be >= 32-bit (see Note #2b).  */
+#error  "cpu_cfg.h, CPU_CFG_TS_TMR_SIZE MUST be >= CPU_WORD_SIZE_32"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+                                                  /* See OS_CPU_C.C                                    */
+void  OSCtxSw               (void);
+void  OSIntCtxSw            (void);
+void  OSStartHighRdy        (void);
+
+void  OS_CPU_SysTickInit    (CPU_INT32U   cnts);
+void  OS_CPU_SysTickInitFreq(CPU_INT32U   cpu_freq);
+
+void  OS_CPU_SysTickHandler (void);
+void  OS_CPU_DynTickHandler (void);
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+void  OS_CPU_UsTmrInit      (void);
+void  OS_CPU_UsTmrHandler   (void);
+#endif
+
+void  OS_CPU_Stop           (void);
+
+#if (OS_CPU_CFG_SIM_EN > 0u)
+                                                  /* See OS_CPU_SIM.C                                  */
+CPU_INT64U   OS_CPU_SimTimeGet  (void);
+void         OS_CPU_SimConsume  (CPU_INT64U   cnts);
+CPU_BOOLEAN  OS_CPU_SimIntPend  (CPU_INT08U   pos,
+                                 CPU_INT64U   dly);
+
+void         OS_CPU_SimIdle     (void);
+void         OS_CPU_SimTickInit (CPU_INT32U   cnts);
+OS_TICK      OS_CPU_SimTickAck  (void);
+void         OS_CPU_SimTickSet  (CPU_INT64U   time);
+void         OS_CPU_SimUsTmrSet (CPU_INT64U   time);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   EXTERNAL C LANGUAGE LINKAGE END
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+}                                                 /* End of 'extern'al C lang linkage.                 */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
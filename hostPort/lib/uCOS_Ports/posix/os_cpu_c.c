@@ -0,0 +1,1270 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              POSIX Port
+*
+* File    : os_cpu_c.c
+* Version : V3.08.00
+*********************************************************************************************************
+* For     : Linux host (x86-64, AArch64)
+* Mode    : Single process, single thread
+*********************************************************************************************************
+* Note(s) : (1) Each task owns a context record (OS_CPU_CTX) holding its ucontext(3) & host stack.  The
+*               task's uC/OS-III stack only stores a pointer to that record, so OSTCBxxxPtr->StkPtr keeps
+*               pointing inside the stack declared by the application.
+*
+*           (2) OSCtxSw(), OSIntCtxSw() & OSStartHighRdy() perform the work of the Cortex-M PendSV
+*               handler synchronously : call OSTaskSwHook(), update OSPrioCur & OSTCBCurPtr, then switch
+*               contexts.  They are always called with interrupts disabled.
+*
+*           (3) The tick is a SIGALRM from an ITIMER_REAL interval timer.  The signal handler only raises
+*               CPU_INT_SYSTICK in the virtual interrupt controller (see 'cpu_c.c'), which runs
+*               OS_CPU_SysTickHandler() at once or when interrupts are next enabled.  A context switch
+*               requested by OSIntExit() is made from the signal handler; the interrupted task resumes
+*               in its handler frame & returns from the signal when it is switched back in.
+*
+*           (4) glibc's swapcontext() saves & restores the signal mask with a system call, which adds to
+*               the measured context switch time compared with the target.
+*
+*           (5) With OS_CPU_CFG_SIM_EN set, the tick is not a signal but an event of the virtual clock
+*               (see 'os_cpu_sim.c').  OSIdleTaskHook() then fast-forwards the clock instead of sleeping.
+*
+*           (6) OSStartHighRdy() saves the context of main() so that OS_CPU_Stop() can return from OSStart()
+*               (with OS_ERR_FATAL_RETURN) to end a run, e.g. to print results collected by the tasks.
+*
+*           (7) With OS_CFG_DYN_TICK_EN set, the tick is one-shot : OS_DynTickSet() programs the next
+*               event of the tick list on ITIMER_REAL or, in simulation, on the virtual clock.  The idle
+*               task then sleeps (or fast-forwards) from one event to the next.
+*
+*           (8) With OS_CFG_TIME_DLY_US_EN set, the microsecond timer counts CLOCK_MONOTONIC : its match
+*               is a one-shot POSIX timer raising a real-time signal, whose handler raises position
+*               OS_CPU_US_TMR_INT_POS.  In simulation, the timer counts the virtual clock & its match
+*               is an event of the virtual clock.
+*********************************************************************************************************
+*/
+
+#define   _GNU_SOURCE
+#define   OS_CPU_GLOBALS
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_cpu_c__c = "$Id: $";
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "os.h"
+
+#include  <signal.h>
+#include  <stdlib.h>
+#include  <string.h>
+#include  <sys/time.h>
+#include  <time.h>
+#include  <ucontext.h>
+
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  os_cpu_ctx  OS_CPU_CTX;
+
+struct  os_cpu_ctx {
+    ucontext_t    Ctx;                                          /* Saved host registers & signal mask                   */
+    OS_TASK_PTR   TaskPtr;                                      /* Task entry point                                     */
+    void         *ArgPtr;                                       /* Task entry argument                                  */
+    CPU_INT08U    Stk[OS_CPU_CFG_HOST_STK_SIZE];                /* Host stack                                           */
+};
+
+                                                                /* Nbr of CPU_STK elements holding a context pointer.   */
+#define  OS_CPU_CTX_PTR_STK_NBR    ((sizeof(OS_CPU_CTX *) + sizeof(CPU_STK) - 1u) / sizeof(CPU_STK))
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_CPU_CTX  *OS_CPU_CtxCurPtr;                          /* Context of the running task                          */
+static  OS_CPU_CTX  *OS_CPU_CtxDelPtr;                          /* Context of a task that deleted itself                */
+static  ucontext_t   OS_CPU_MainCtx;                            /* Context of main(), resumed by OS_CPU_Stop()          */
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u) && (OS_CPU_CFG_SIM_EN == 0u)
+static  timer_t      OS_CPU_UsTmrId;                            /* One-shot POSIX timer of the microsecond timer match  */
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT32U   OS_CPU_DynTickCnts;                        /* SysTick counts per tick, 0 until the tick is started */
+static  CPU_INT64U   OS_CPU_DynTickBase;                        /* SysTick count when OSTickCtr was ...                 */
+static  OS_TICK      OS_CPU_DynTickBaseCtr;                     /* ... equal to OS_CPU_DynTickBaseCtr                   */
+static  OS_TICK      OS_CPU_DynTickStep;                        /* Ticks from the base to the event, 0 if none          */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  OS_CPU_CTX  *OS_CPU_CtxGet      (OS_TCB  *p_tcb);
+static  void         OS_CPU_CtxSw       (void);
+static  void         OS_CPU_CtxReap     (void);
+static  void         OS_CPU_TaskEntry   (void);
+#if (OS_CPU_CFG_SIM_EN == 0u)
+static  void         OS_CPU_SigAlrmHandler(int  sig);
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+static  void         OS_CPU_SigUsTmrHandler(int  sig);
+#endif
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT64U   OS_CPU_DynTickCntGet (void);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           IDLE TASK HOOK
+*
+* Description: This function is called by the idle task.  This hook has been added to allow you to do
+*              such things as STOP the CPU to conserve power.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) The process sleeps until the next signal instead of spinning on a host core.
+*
+*              2) In simulation, the virtual clock jumps to the next event (see 'os_cpu_sim.c  Note #2b').
+*********************************************************************************************************
+*/
+
+void  OSIdleTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppIdleTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppIdleTaskHookPtr)();
+    }
+#endif
+
+#if (OS_CPU_CFG_SIM_EN > 0u)
+    OS_CPU_SimIdle();                                           /* See Note #2.                                         */
+#else
+    CPU_WaitForInt();                                           /* See Note #1.                                         */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*
+* Description: This function is called by OSInit() at the beginning of OSInit().
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSInitHook (void)
+{
+    OS_CPU_CtxCurPtr = (OS_CPU_CTX *)0;
+    OS_CPU_CtxDelPtr = (OS_CPU_CTX *)0;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           REDZONE HIT HOOK
+*
+* Description: This function is called when a task's stack overflowed.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the offending task. NULL if ISR.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+void  OSRedzoneHitHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppRedzoneHitHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppRedzoneHitHookPtr)(p_tcb);
+    } else {
+        CPU_SW_EXCEPTION(;);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+    CPU_SW_EXCEPTION(;);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         STATISTIC TASK HOOK
+*
+* Description: This function is called every second by uC/OS-III's statistics task.  This allows your
+*              application to add functionality to the statistics task.
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSStatTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppStatTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppStatTaskHookPtr)();
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TASK CREATION HOOK
+*
+* Description: This function is called when a task is created.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being created.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskCreateHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskCreateHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskCreateHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TASK DELETION HOOK
+*
+* Description: This function is called when a task is deleted.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being deleted.
+*
+* Note(s)    : 1) A task deleting itself still runs on its host stack, so its context record is released
+*                 by the next task switched in.
+*********************************************************************************************************
+*/
+
+void  OSTaskDelHook (OS_TCB  *p_tcb)
+{
+    OS_CPU_CTX  *p_ctx;
+
+
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskDelHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskDelHookPtr)(p_tcb);
+    }
+#endif
+
+    p_ctx = OS_CPU_CtxGet(p_tcb);
+    if (p_ctx == OS_CPU_CtxCurPtr) {
+        OS_CPU_CtxDelPtr = p_ctx;                               /* See Note #1.                                         */
+    } else {
+        free(p_ctx);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            TASK RETURN HOOK
+*
+* Description: This function is called if a task accidentally returns.  In other words, a task should
+*              either be an infinite loop or delete itself when done.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task that is returning.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskReturnHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskReturnHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskReturnHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        INITIALIZE A TASK'S STACK
+*
+* Description: This function is called by either OSTaskCreate() or OSTaskCreateExt() to initialize the
+*              stack frame of the task being created.  This function is highly processor specific.
+*
+* Arguments  : p_task       Pointer to the task entry point address.
+*
+*              p_arg        Pointer to a user supplied data area that will be passed to the task
+*                               when the task first executes.
+*
+*              p_stk_base   Pointer to the base address of the stack.
+*
+*              stk_size     Size of the stack, in number of CPU_STK elements.
+*
+*              opt          Options used to alter the behavior of OS_Task_StkInit().
+*                            (see OS.H for OS_TASK_OPT_xxx).
+*
+* Returns    : Always returns the location of the new top-of-stack once the context record pointer has
+*              been placed on the stack, or a NULL pointer if the context record can't be allocated
+*              (OSTaskCreate() then fails with OS_ERR_STK_OVF).
+*
+* Note(s)    : (1) Interrupts are enabled when task starts executing.
+*
+*              (2) The task runs on a host stack of OS_CPU_CFG_HOST_STK_SIZE bytes allocated with its
+*                  context record; the stack given to OSTaskCreate() only holds the record's address :
+*
+*                                          +-------------+
+*                                          | p_ctx       |   <- p_stk_base[stk_size]
+*                                          +-------------+   <- Returned stack pointer
+*                                          |             |
+*                                                .
+*                                                .
+*
+*                  Stack usage reported by OSTaskStkChk() therefore does not reflect the host stack.
+*
+*              (3) The allocation is made with interrupts disabled so that no task is switched in while
+*                  the C library's allocator is in use (see 'os_cpu.h  Note #2').
+**********************************************************************************************************
+*/
+
+CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
+                         void          *p_arg,
+                         CPU_STK       *p_stk_base,
+                         CPU_STK       *p_stk_limit,
+                         CPU_STK_SIZE   stk_size,
+                         OS_OPT         opt)
+{
+    CPU_STK     *p_stk;
+    OS_CPU_CTX  *p_ctx;
+    CPU_SR_ALLOC();
+
+
+    (void)p_stk_limit;
+    (void)opt;                                                  /* 'opt' is not used, prevent warning                   */
+
+    if (stk_size < OS_CPU_CTX_PTR_STK_NBR) {
+        return ((CPU_STK *)0);
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #3.                                         */
+    OS_CPU_CtxReap();
+    p_ctx = (OS_CPU_CTX *)malloc(sizeof(OS_CPU_CTX));
+    CPU_CRITICAL_EXIT();
+    if (p_ctx == (OS_CPU_CTX *)0) {
+        return ((CPU_STK *)0);
+    }
+
+    p_ctx->TaskPtr = p_task;
+    p_ctx->ArgPtr  = p_arg;
+
+    getcontext(&p_ctx->Ctx);
+    p_ctx->Ctx.uc_stack.ss_sp   = &p_ctx->Stk[0];
+    p_ctx->Ctx.uc_stack.ss_size = sizeof(p_ctx->Stk);
+    p_ctx->Ctx.uc_link          = (ucontext_t *)0;
+    sigemptyset(&p_ctx->Ctx.uc_sigmask);                        /* Signals unblocked when the task starts.              */
+    makecontext(&p_ctx->Ctx, OS_CPU_TaskEntry, 0);
+
+    p_stk = &p_stk_base[stk_size];                              /* Load stack pointer                                   */
+    p_stk = p_stk - OS_CPU_CTX_PTR_STK_NBR;                     /* Store the context record pointer (see Note #2).      */
+    (void)memcpy(p_stk, &p_ctx, sizeof(p_ctx));
+
+    return (p_stk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.  This allows you to perform other
+*              operations during a context switch.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task
+*                 that will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points
+*                 to the task being switched out (i.e. the preempted task).
+*********************************************************************************************************
+*/
+
+void  OSTaskSwHook (void)
+{
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    CPU_TS  ts;
+#endif
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    CPU_TS  int_dis_time;
+#endif
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    CPU_BOOLEAN  stk_status;
+#endif
+
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskSwHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTaskSwHookPtr)();
+    }
+#endif
+
+    OS_TRACE_TASK_SWITCHED_IN(OSTCBHighRdyPtr);
+
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    ts = OS_TS_GET();
+    if (OSTCBCurPtr != OSTCBHighRdyPtr) {
+        OSTCBCurPtr->CyclesDelta  = ts - OSTCBCurPtr->CyclesStart;
+        OSTCBCurPtr->CyclesTotal += (OS_CYCLES)OSTCBCurPtr->CyclesDelta;
+    }
+
+    OSTCBHighRdyPtr->CyclesStart = ts;
+#endif
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    int_dis_time = CPU_IntDisMeasMaxCurReset();                 /* Keep track of per-task interrupt disable time        */
+    if (OSTCBCurPtr->IntDisTimeMax < int_dis_time) {
+        OSTCBCurPtr->IntDisTimeMax = int_dis_time;
+    }
+#endif
+
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+                                                                /* Keep track of per-task scheduler lock time           */
+    if (OSTCBCurPtr->SchedLockTimeMax < OSSchedLockTimeMaxCur) {
+        OSTCBCurPtr->SchedLockTimeMax = OSSchedLockTimeMaxCur;
+    }
+    OSSchedLockTimeMaxCur = (CPU_TS)0;                          /* Reset the per-task value                             */
+#endif
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+                                                                /* Check if stack overflowed.                           */
+    stk_status = OSTaskStkRedzoneChk((OS_TCB *)0u);
+    if (stk_status != OS_TRUE) {
+        OSRedzoneHitHook(OSTCBCurPtr);
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                              TICK HOOK
+*
+* Description: This function is called every tick.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is assumed to be called from the Tick ISR.
+*********************************************************************************************************
+*/
+
+void  OSTimeTickHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTimeTickHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTimeTickHookPtr)();
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SYS TICK HANDLER
+*
+* Description: Handle the system tick (SysTick) interrupt, which is used to generate the uC/OS-III tick
+*              interrupt.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is installed at position CPU_INT_SYSTICK of the virtual interrupt table by
+*                 OS_CPU_SysTickInit().
+*
+*              2) In simulation, an idle fast-forward may have skipped several ticks : all but the last are
+*                 accounted for in one OS_TickUpdate() call.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickHandler  (void)
+{
+#if (OS_CPU_CFG_SIM_EN > 0u) && (OS_CFG_TICK_EN > 0u)
+    OS_TICK  ticks;
+#endif
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+#if (OS_CPU_CFG_SIM_EN > 0u) && (OS_CFG_TICK_EN > 0u)
+    ticks = OS_CPU_SimTickAck();
+#endif
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CPU_CFG_SIM_EN > 0u) && (OS_CFG_TICK_EN > 0u)
+    if (ticks > 1u) {                                           /* See Note #2.                                         */
+        OS_TickUpdate(ticks - 1u);
+    }
+#endif
+    OSTimeTick();                                               /* Call uC/OS-III's OSTimeTick()                        */
+
+    OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
+}
+
+
+/*
+*********************************************************************************************************
+*                                         INITIALIZE SYS TICK
+*
+* Description: Initialize the SysTick using the CPU clock frequency.
+*
+* Arguments  : cpu_freq         SysTick clock frequency, normally OS_CPU_SYS_TICK_FREQ_HZ.
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*
+*              2) Either OS_CPU_SysTickInitFreq or OS_CPU_SysTickInit() can be called.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickInitFreq (CPU_INT32U  cpu_freq)
+{
+#if (OS_CFG_TICK_EN > 0u)
+    CPU_INT32U  cnts;
+
+
+    cnts = (cpu_freq / (CPU_INT32U)OSCfg_TickRate_Hz);          /* Determine nbr SysTick cnts between two OS tick intr. */
+
+    OS_CPU_SysTickInit(cnts);
+#else
+    (void)cpu_freq;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                         INITIALIZE SYS TICK
+*
+* Description: Initialize the SysTick using the number of countes between two ticks.
+*
+* Arguments  : cnts         Number of SysTick counts between two OS tick interrupts, in microseconds or,
+*                           in simulation, in virtual CPU cycles (see 'os_cpu.h  DEFINES  Note #1').
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*
+*              2) Either OS_CPU_SysTickInitFreq or OS_CPU_SysTickInit() can be called.
+*
+*              3) In simulation, the tick is an event of the virtual clock (see 'os_cpu_sim.c').
+*
+*              4) With the dynamic tick, 'cnts' only sets the tick length : the tick interrupt is raised
+*                 once, on the next event of the tick list (see file Note #7).
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
+{
+#if (OS_CFG_TICK_EN > 0u)
+#if (OS_CPU_CFG_SIM_EN == 0u)
+    struct  sigaction   act;
+#if (OS_CFG_DYN_TICK_EN == 0u)
+    struct  itimerval   tmr;
+#endif
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+#if (OS_CPU_CFG_SIM_EN == 0u)
+    memset(&act, 0, sizeof(act));
+    act.sa_handler = OS_CPU_SigAlrmHandler;
+    act.sa_flags   = SA_RESTART;
+    sigemptyset(&act.sa_mask);
+    sigaction(SIGALRM, &act, (struct sigaction *)0);
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_IntSrcHandlerSet(CPU_INT_SYSTICK, OS_CPU_DynTickHandler);
+
+    CPU_CRITICAL_ENTER();
+    OS_CPU_DynTickCnts    = cnts;
+    OS_CPU_DynTickBase    = OS_CPU_DynTickCntGet();
+    OS_CPU_DynTickBaseCtr = OSTickCtr;
+    (void)OS_DynTickSet(OSTickCtrStep);                         /* One-shot tick on the next event (see Note #4).       */
+    CPU_CRITICAL_EXIT();
+#elif (OS_CPU_CFG_SIM_EN > 0u)
+    CPU_IntSrcHandlerSet(CPU_INT_SYSTICK, OS_CPU_SysTickHandler);
+
+    OS_CPU_SimTickInit(cnts);                                   /* Tick on the virtual clock (see Note #3).             */
+#else
+    CPU_IntSrcHandlerSet(CPU_INT_SYSTICK, OS_CPU_SysTickHandler);
+
+    tmr.it_interval.tv_sec  = (time_t)     (cnts / OS_CPU_SYS_TICK_FREQ_HZ);
+    tmr.it_interval.tv_usec = (suseconds_t)(cnts % OS_CPU_SYS_TICK_FREQ_HZ);
+    tmr.it_value            = tmr.it_interval;
+    setitimer(ITIMER_REAL, &tmr, (struct itimerval *)0);       /* Set Reload Register & enable timer.                  */
+#endif
+
+    CPU_IntSrcEn(CPU_INT_SYSTICK);                              /* Enable timer interrupt.                              */
+#else
+    (void)cnts;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DYNAMIC TICK HANDLER
+*
+* Description: Handle the one-shot tick interrupt of the dynamic tick : announce the ticks elapsed to the
+*              kernel, which programs the next event of the tick list.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is installed at position CPU_INT_SYSTICK of the virtual interrupt table by
+*                 OS_CPU_SysTickInit().
+*
+*              2) The elapsed ticks are read from the clock, so a late interrupt loses no time.  Reading
+*                 them & updating the tick list is done in one critical section : an interrupt posting
+*                 to a task waiting with a timeout also moves OSTickCtr forward (see OS_TickListRemove()).
+*
+*              3) An interrupt raised before the programmed tick (e.g. a SIGALRM left over from the
+*                 previous event) finds no elapsed tick : the same event is programmed again.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_DynTickHandler (void)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK  ticks;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+
+    ticks = OS_DynTickGet();                                    /* See Note #2.                                         */
+    if (ticks > 0u) {
+        OSTimeDynTick(ticks);                                   /* Update the tick list & program its next event.       */
+    } else {
+        (void)OS_DynTickSet(OS_CPU_DynTickStep);                /* See Note #3.                                         */
+    }
+    CPU_CRITICAL_EXIT();
+
+    OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                     GET ELAPSED DYNAMIC TICKS
+*
+* Description: Return the number of ticks elapsed since OSTickCtr was last brought up to date.
+*
+* Arguments  : None.
+*
+* Returns    : The number of ticks not yet accounted for in OSTickCtr.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled.
+*
+*              2) Ticks past the programmed event belong to the tick interrupt, which is pending : the
+*                 kernel must not step over the event before its tick list is updated.
+*
+*              3) OS_TickUpdate() adds the ticks to OSTickCtr before it programs the next event : ticks
+*                 already in OSTickCtr are not returned twice (e.g. to OS_SchedEdfRelease()).
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    OS_TICK  ticks;
+    OS_TICK  done;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* Tick not started yet.                                */
+        return (0u);
+    }
+
+    ticks = (OS_TICK)((OS_CPU_DynTickCntGet() - OS_CPU_DynTickBase) / OS_CPU_DynTickCnts);
+    if ((OS_CPU_DynTickStep != 0u) &&                           /* See Note #2.                                         */
+        (ticks              >  OS_CPU_DynTickStep)) {
+        ticks = OS_CPU_DynTickStep;
+    }
+
+    done = OSTickCtr - OS_CPU_DynTickBaseCtr;                   /* See Note #3.                                         */
+    if (ticks <= done) {
+        return (0u);
+    }
+
+    return (ticks - done);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     SET NEXT DYNAMIC TICK EVENT
+*
+* Description: Program the one-shot tick 'ticks' ticks after OSTickCtr.
+*
+* Arguments  : ticks        Number of ticks from OSTickCtr to the next event of the tick list, 0 if the
+*                           tick list is empty.
+*
+* Returns    : The number of ticks programmed.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled, right after OSTickCtr is brought up to
+*                 date.
+*
+*              2) The base moves by whole ticks, so the tick boundaries never drift from the clock.
+*
+*              3) Without an event, no tick interrupt is raised : the idle task sleeps until a peripheral
+*                 interrupt or, in simulation, the run ends (see 'os_cpu_sim.c  OS_CPU_SimIdle()').
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    CPU_INT64U  time;
+#if (OS_CPU_CFG_SIM_EN == 0u)
+    CPU_INT64U  now;
+    struct  itimerval   tmr;
+#endif
+
+
+    OS_CPU_DynTickStep = ticks;
+    if (OS_CPU_DynTickCnts == 0u) {                             /* OS_CPU_SysTickInit() programs the first event.       */
+        return (ticks);
+    }
+                                                                /* See Note #2.                                         */
+    OS_CPU_DynTickBase    += (CPU_INT64U)(OSTickCtr - OS_CPU_DynTickBaseCtr) * OS_CPU_DynTickCnts;
+    OS_CPU_DynTickBaseCtr  =  OSTickCtr;
+
+    if (ticks == 0u) {                                          /* See Note #3.                                         */
+        time = DEF_INT_64U_MAX_VAL;
+    } else {
+        time = OS_CPU_DynTickBase + ((CPU_INT64U)ticks * OS_CPU_DynTickCnts);
+    }
+
+#if (OS_CPU_CFG_SIM_EN > 0u)
+    OS_CPU_SimTickSet(time);                                    /* One-shot tick on the virtual clock.                  */
+#else
+    memset(&tmr, 0, sizeof(tmr));
+    if (time != DEF_INT_64U_MAX_VAL) {
+        now  = OS_CPU_DynTickCntGet();
+        time = (time > now) ? (time - now) : 1u;                /* A passed event is raised at once.                    */
+        tmr.it_value.tv_sec  = (time_t)     (time / OS_CPU_SYS_TICK_FREQ_HZ);
+        tmr.it_value.tv_usec = (suseconds_t)(time % OS_CPU_SYS_TICK_FREQ_HZ);
+    }
+    setitimer(ITIMER_REAL, &tmr, (struct itimerval *)0);       /* One-shot (or stopped) interval timer.                */
+#endif
+
+    return (ticks);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    INITIALIZE MICROSECOND TIMER
+*
+* Description: Install the microsecond timer interrupt, which times OSTimeDlyUs() & the pend timeouts
+*              given in microseconds.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function MUST be called after OSStart(), before the first microsecond delay.
+*
+*              2) The match is a real-time signal rather than SIGALRM, which belongs to the tick (see
+*                 file Note #8).
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+void  OS_CPU_UsTmrInit (void)
+{
+#if (OS_CPU_CFG_SIM_EN == 0u)
+    struct  sigaction   act;
+    struct  sigevent    evt;
+
+
+    memset(&act, 0, sizeof(act));
+    act.sa_handler = OS_CPU_SigUsTmrHandler;
+    act.sa_flags   = SA_RESTART;
+    sigemptyset(&act.sa_mask);
+    sigaction(SIGRTMIN, &act, (struct sigaction *)0);           /* See Note #2.                                         */
+
+    memset(&evt, 0, sizeof(evt));
+    evt.sigev_notify = SIGEV_SIGNAL;
+    evt.sigev_signo  = SIGRTMIN;
+    timer_create(CLOCK_MONOTONIC, &evt, &OS_CPU_UsTmrId);
+#endif
+
+    CPU_IntSrcHandlerSet(OS_CPU_US_TMR_INT_POS, OS_CPU_UsTmrHandler);
+    CPU_IntSrcEn(OS_CPU_US_TMR_INT_POS);                        /* Enable timer interrupt.                              */
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MICROSECOND TIMER HANDLER
+*
+* Description: Handle the match interrupt of the microsecond timer : the kernel readies the tasks whose
+*              microsecond delay or timeout expired & programs the next match.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is installed at position OS_CPU_US_TMR_INT_POS of the virtual interrupt
+*                 table by OS_CPU_UsTmrInit().
+*********************************************************************************************************
+*/
+
+void  OS_CPU_UsTmrHandler (void)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+    CPU_CRITICAL_EXIT();
+
+    OSTimeUsTick();                                             /* Expire the microsecond delays due                    */
+
+    OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
+}
+
+
+/*
+*********************************************************************************************************
+*                                      READ MICROSECOND TIMER
+*
+* Description: Return the free running 32-bit microsecond count.
+*
+* Arguments  : None.
+*
+* Returns    : The count, in microseconds.  It wraps around every 2^32 microseconds.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  OS_UsTmrGet (void)
+{
+#if (OS_CPU_CFG_SIM_EN > 0u)
+    return ((CPU_INT32U)(OS_CPU_SimTimeGet() / OS_CPU_US_TMR_CNTS));
+#else
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((CPU_INT32U)(((CPU_INT64U)ts.tv_sec  * 1000000u) +
+                         ((CPU_INT64U)ts.tv_nsec / 1000u)));
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                   SET MICROSECOND TIMER MATCH
+*
+* Description: Raise the microsecond timer interrupt once, when the count reaches 'match'.
+*
+* Arguments  : match        Count at which to raise the interrupt.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled.
+*
+*              2) A match already reached (up to half the range of the counter behind) raises the
+*                 interrupt at once, as the kernel requires.
+*********************************************************************************************************
+*/
+
+void  OS_UsTmrSet (CPU_INT32U  match)
+{
+    CPU_INT32S  dly;
+#if (OS_CPU_CFG_SIM_EN > 0u)
+    CPU_INT64U  now;
+#else
+    struct  itimerspec  tmr;
+#endif
+
+
+    dly = (CPU_INT32S)(match - OS_UsTmrGet());
+    if (dly <= 0) {                                             /* See Note #2.                                         */
+        OS_UsTmrStop();
+        CPU_IntSrcPendSet(OS_CPU_US_TMR_INT_POS);
+        return;
+    }
+
+#if (OS_CPU_CFG_SIM_EN > 0u)
+    now = OS_CPU_SimTimeGet() / OS_CPU_US_TMR_CNTS;             /* Virtual time of the microsecond reaching 'match'     */
+    OS_CPU_SimUsTmrSet((now + (CPU_INT64U)dly) * OS_CPU_US_TMR_CNTS);
+#else
+    memset(&tmr, 0, sizeof(tmr));
+    tmr.it_value.tv_sec  = (time_t)((CPU_INT32U)dly / 1000000u);
+    tmr.it_value.tv_nsec = (long)  (((CPU_INT32U)dly % 1000000u) * 1000u);
+    timer_settime(OS_CPU_UsTmrId, 0, &tmr, (struct itimerspec *)0);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                  STOP MICROSECOND TIMER MATCH
+*
+* Description: Cancel the match of the microsecond timer; the count keeps running.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled.
+*********************************************************************************************************
+*/
+
+void  OS_UsTmrStop (void)
+{
+#if (OS_CPU_CFG_SIM_EN > 0u)
+    OS_CPU_SimUsTmrSet(DEF_INT_64U_MAX_VAL);
+#else
+    struct  itimerspec  tmr;
+
+
+    memset(&tmr, 0, sizeof(tmr));
+    timer_settime(OS_CPU_UsTmrId, 0, &tmr, (struct itimerspec *)0);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      START HIGHEST PRIORITY TASK
+*
+* Description: This function is called by OSStart() to start the highest priority task that was created
+*              by your application before calling OSStart().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) OSStartHighRdy() MUST:
+*                 a) Call OSTaskSwHook() then,
+*                 b) Set OSTCBCurPtr = OSTCBHighRdyPtr and OSPrioCur = OSPrioHighRdy,
+*                 c) Switch to the highest priority task.  The calling context (main()) is saved & only
+*                    resumed by OS_CPU_Stop().
+*********************************************************************************************************
+*/
+
+void  OSStartHighRdy (void)
+{
+    CPU_IntDis();
+
+    OSTaskSwHook();
+
+    OSPrioCur        = OSPrioHighRdy;
+    OSTCBCurPtr      = OSTCBHighRdyPtr;
+    OS_CPU_CtxCurPtr = OS_CPU_CtxGet(OSTCBHighRdyPtr);
+
+    swapcontext(&OS_CPU_MainCtx, &OS_CPU_CtxCurPtr->Ctx);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            STOP THE KERNEL
+*
+* Description: End the run : stop the timers & resume main() where it called OSStart(), which returns
+*              OS_ERR_FATAL_RETURN (see 'os_cpu_c.c  Note #6').
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) May be called from any task.  Interrupts stay disabled & the tasks are not resumed;
+*                 main() may only read the results left by the tasks & exit.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_Stop (void)
+{
+#if (OS_CPU_CFG_SIM_EN == 0u)
+    struct  itimerval   tmr;
+#endif
+
+
+    CPU_IntDis();
+
+#if (OS_CPU_CFG_SIM_EN == 0u)
+    memset(&tmr, 0, sizeof(tmr));
+    setitimer(ITIMER_REAL, &tmr, (struct itimerval *)0);       /* Stop the tick.                                       */
+#endif
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    OS_UsTmrStop();                                             /* Stop the microsecond timer.                          */
+#endif
+
+    setcontext(&OS_CPU_MainCtx);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 TASK LEVEL / INTERRUPT LEVEL CONTEXT SWITCH
+*
+* Description: OSCtxSw() is called by OSSched() & OSIntCtxSw() by OSIntExit() to switch to the highest
+*              priority task ready-to-run.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Both are called with interrupts disabled.  On the target they pend PendSV; here the
+*                 switch is made immediately (see 'os_cpu_c.c  Note #2').
+*********************************************************************************************************
+*/
+
+void  OSCtxSw (void)
+{
+    OS_CPU_CtxSw();
+}
+
+
+void  OSIntCtxSw (void)
+{
+    OS_CPU_CtxSw();
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_CtxGet()
+*
+* Description: Return the context record of a task (see 'OSTaskStkInit()  Note #2').
+*
+* Arguments  : p_tcb        Pointer to the task control block.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+static  OS_CPU_CTX  *OS_CPU_CtxGet (OS_TCB  *p_tcb)
+{
+    OS_CPU_CTX  *p_ctx;
+
+
+    (void)memcpy(&p_ctx, p_tcb->StkPtr, sizeof(p_ctx));
+
+    return (p_ctx);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           OS_CPU_CtxSw()
+*
+* Description: Save the context of the current task & restore the context of the highest priority task.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) The TCB of a task that deleted itself no longer points to its stack, so the current
+*                 context is taken from OS_CPU_CtxCurPtr rather than from OSTCBCurPtr.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_CtxSw (void)
+{
+    OS_CPU_CTX  *p_ctx_cur;
+    OS_CPU_CTX  *p_ctx_new;
+
+
+    OSTaskSwHook();
+
+    p_ctx_cur        = OS_CPU_CtxCurPtr;                        /* See Note #1.                                         */
+    p_ctx_new        = OS_CPU_CtxGet(OSTCBHighRdyPtr);
+
+    OSPrioCur        = OSPrioHighRdy;
+    OSTCBCurPtr      = OSTCBHighRdyPtr;
+    OS_CPU_CtxCurPtr = p_ctx_new;
+
+    if (p_ctx_new != p_ctx_cur) {
+        swapcontext(&p_ctx_cur->Ctx, &p_ctx_new->Ctx);
+        OS_CPU_CtxReap();
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_CtxReap()
+*
+* Description: Release the context record of a task that deleted itself.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Called with interrupts disabled, from a task other than the deleted one.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_CtxReap (void)
+{
+    if (OS_CPU_CtxDelPtr != (OS_CPU_CTX *)0) {
+        if (OS_CPU_CtxDelPtr != OS_CPU_CtxCurPtr) {
+            free(OS_CPU_CtxDelPtr);
+            OS_CPU_CtxDelPtr = (OS_CPU_CTX *)0;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         OS_CPU_TaskEntry()
+*
+* Description: First code executed by a task : enable interrupts & call the task's entry point.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Like the LR set up by the target's OSTaskStkInit(), a task that returns lands in
+*                 OS_TaskReturn().
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_TaskEntry (void)
+{
+    OS_CPU_CTX  *p_ctx;
+
+
+    OS_CPU_CtxReap();
+    p_ctx = OS_CPU_CtxCurPtr;
+
+    CPU_IntEn();                                                /* See 'OSTaskStkInit()  Note #1'.                      */
+
+    p_ctx->TaskPtr(p_ctx->ArgPtr);
+
+    OS_TaskReturn();                                            /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                       OS_CPU_SigAlrmHandler()
+*
+* Description: SIGALRM handler : raise the SysTick interrupt (see 'os_cpu_c.c  Note #3').
+*
+* Arguments  : sig          Signal number, not used.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_SIM_EN == 0u)
+static  void  OS_CPU_SigAlrmHandler (int  sig)
+{
+    (void)sig;
+
+    CPU_IntSrcPendSet(CPU_INT_SYSTICK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      OS_CPU_SigUsTmrHandler()
+*
+* Description: Real-time signal handler : raise the microsecond timer interrupt (see 'os_cpu_c.c
+*              Note #8').
+*
+* Arguments  : sig          Signal number, not used.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_SIM_EN == 0u) && (OS_CFG_TIME_DLY_US_EN > 0u)
+static  void  OS_CPU_SigUsTmrHandler (int  sig)
+{
+    (void)sig;
+
+    CPU_IntSrcPendSet(OS_CPU_US_TMR_INT_POS);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       OS_CPU_DynTickCntGet()
+*
+* Description: Read the free running clock of the dynamic tick, in SysTick counts : microseconds of
+*              CLOCK_MONOTONIC or, in simulation, the virtual clock.
+*
+* Arguments  : None.
+*
+* Returns    : The clock, in SysTick counts.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT64U  OS_CPU_DynTickCntGet (void)
+{
+#if (OS_CPU_CFG_SIM_EN > 0u)
+    return (OS_CPU_SimTimeGet());
+#else
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((CPU_INT64U)ts.tv_sec  * OS_CPU_SYS_TICK_FREQ_HZ) +
+            ((CPU_INT64U)ts.tv_nsec / (1000000000u / OS_CPU_SYS_TICK_FREQ_HZ)));
+#endif
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
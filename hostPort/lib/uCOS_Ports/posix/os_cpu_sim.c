@@ -0,0 +1,562 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              POSIX Port
+*                                    VIRTUAL TIME SIMULATION ENGINE
+*
+* File    : os_cpu_sim.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) Built when OS_CPU_CFG_SIM_EN is set.  No signal or host timer is used : the tick & the
+*               simulated peripheral interrupts are events on a virtual clock counting target CPU cycles
+*               (OS_CPU_SYS_TICK_FREQ_HZ), so a run is fully repeatable.
+*
+*           (2) The virtual clock only moves when :
+*
+*               (a) A task consumes CPU time with OS_CPU_SimConsume().  Events that fall due meanwhile
+*                   interrupt the task at their exact time.
+*
+*               (b) Every task is blocked & the idle task calls OS_CPU_SimIdle().  The clock then jumps
+*                   straight to the next event : the next expiry in OSTickList (the timer task waits
+*                   there for its next timer), the next match of the microsecond timer, or the next
+*                   simulated peripheral interrupt.  The ticks skipped over are handed to the tick
+*                   interrupt in one call (see OS_CPU_SimTickAck()).
+*
+*               With the dynamic tick (OS_CFG_DYN_TICK_EN), there is no periodic tick : the next expiry
+*               is the one-shot match programmed by OS_DynTickSet() (see OS_CPU_SimTickSet()).
+*
+*           (3) Code that does not call OS_CPU_SimConsume() runs in zero virtual time.
+*********************************************************************************************************
+*/
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_cpu_sim__c = "$Id: $";
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "os.h"
+
+
+#if (OS_CPU_CFG_SIM_EN > 0u)
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_SIM_TIME_NONE      DEF_INT_64U_MAX_VAL           /* No event scheduled                                   */
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  os_cpu_sim_evt {
+    CPU_INT64U   Time;                                          /* Virtual time at which the interrupt is raised        */
+    CPU_INT08U   Pos;                                           /* Virtual interrupt table position                     */
+} OS_CPU_SIM_EVT;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U      OS_CPU_SimTime;                         /* Virtual clock, in SysTick counts                     */
+
+static  CPU_INT64U      OS_CPU_SimTickPeriod;                   /* SysTick reload value, 0 if not started               */
+static  CPU_INT64U      OS_CPU_SimTickNext;                     /* Virtual time of the next tick                        */
+static  OS_TICK         OS_CPU_SimTickCtr;                      /* Ticks elapsed & not yet handled by the tick ISR      */
+static  CPU_INT64U      OS_CPU_SimTickMatch = OS_CPU_SIM_TIME_NONE; /* Virtual time of the one-shot tick                */
+static  CPU_INT64U      OS_CPU_SimUsMatch   = OS_CPU_SIM_TIME_NONE; /* Virtual time of the microsecond timer match      */
+
+static  OS_CPU_SIM_EVT  OS_CPU_SimEvtTbl[OS_CPU_CFG_SIM_EVT_NBR];   /* Peripheral interrupts, sorted by time        */
+static  CPU_INT08U      OS_CPU_SimEvtNbr;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  OS_CPU_SimEvtNextGet (void);
+static  CPU_INT64U  OS_CPU_SimExpiryGet  (void);
+static  void        OS_CPU_SimAdvance    (CPU_INT64U  time);
+
+
+/*
+*********************************************************************************************************
+*                                        GET THE VIRTUAL TIME
+*
+* Description: Return the virtual clock, in SysTick counts (target CPU cycles).
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+CPU_INT64U  OS_CPU_SimTimeGet (void)
+{
+    CPU_INT64U  time;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    time = OS_CPU_SimTime;
+    CPU_CRITICAL_EXIT();
+
+    return (time);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        CONSUME VIRTUAL TIME
+*
+* Description: Model the calling task executing for 'cnts' cycles.
+*
+* Arguments  : cnts         Number of SysTick counts (target CPU cycles) of execution.
+*
+* Note(s)    : 1) Interrupts that fall due are taken at their exact virtual time & may preempt the task;
+*                 the remaining execution time is consumed once the task is switched back in.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SimConsume (CPU_INT64U  cnts)
+{
+    CPU_INT64U  next;
+    CPU_SR_ALLOC();
+
+
+    while (cnts > 0u) {
+        CPU_CRITICAL_ENTER();
+        next = OS_CPU_SimEvtNextGet();
+        if ((next - OS_CPU_SimTime) > cnts) {
+            OS_CPU_SimTime += cnts;
+            cnts            = 0u;
+        } else {
+            cnts           -= next - OS_CPU_SimTime;
+            OS_CPU_SimAdvance(next);
+        }
+        CPU_CRITICAL_EXIT();                                    /* See Note #1.                                         */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                  SCHEDULE A PERIPHERAL INTERRUPT
+*
+* Description: Raise interrupt 'pos' of the virtual interrupt controller 'dly' counts from now.
+*
+* Arguments  : pos          Virtual interrupt table position (CPU_INT_EXT0 and up).
+*
+*              dly          Delay, in SysTick counts.
+*
+* Returns    : DEF_OK       if the interrupt is scheduled.
+*              DEF_FAIL     if OS_CPU_CFG_SIM_EVT_NBR interrupts are already scheduled.
+*
+* Note(s)    : 1) Interrupts scheduled for the same time are raised in the order they were scheduled.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_CPU_SimIntPend (CPU_INT08U  pos,
+                                CPU_INT64U  dly)
+{
+    CPU_INT64U  time;
+    CPU_INT08U  ix;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (OS_CPU_SimEvtNbr >= OS_CPU_CFG_SIM_EVT_NBR) {
+        CPU_CRITICAL_EXIT();
+        return (DEF_FAIL);
+    }
+
+    time = OS_CPU_SimTime + dly;
+    ix   = OS_CPU_SimEvtNbr;
+    while ((ix > 0u) &&
+           (OS_CPU_SimEvtTbl[ix - 1u].Time > time)) {           /* See Note #1.                                         */
+        OS_CPU_SimEvtTbl[ix] = OS_CPU_SimEvtTbl[ix - 1u];
+        ix--;
+    }
+    OS_CPU_SimEvtTbl[ix].Time = time;
+    OS_CPU_SimEvtTbl[ix].Pos  = pos;
+    OS_CPU_SimEvtNbr++;
+    CPU_CRITICAL_EXIT();
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         IDLE FAST-FORWARD
+*
+* Description: Called by OSIdleTaskHook() : move the virtual clock to the next event.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) The next event is the earliest of the next kernel expiry, the microsecond timer match
+*                 & the next peripheral interrupt.  Ticks in between wake nobody & are not simulated one
+*                 by one.
+*
+*              2) When nothing can ever make a task ready, the simulation is over & OS_CPU_Stop() returns
+*                 to main().
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SimIdle (void)
+{
+    CPU_INT64U  next;
+    CPU_INT64U  expiry;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    next   = (OS_CPU_SimEvtNbr > 0u) ? OS_CPU_SimEvtTbl[0].Time : OS_CPU_SIM_TIME_NONE;
+    expiry = OS_CPU_SimExpiryGet();                             /* See Note #1.                                         */
+    if (expiry < next) {
+        next = expiry;
+    }
+    if (OS_CPU_SimUsMatch < next) {
+        next = OS_CPU_SimUsMatch;
+    }
+
+    if (next == OS_CPU_SIM_TIME_NONE) {
+        CPU_CRITICAL_EXIT();
+        OS_CPU_Stop();                                          /* See Note #2.                                         */
+        return;
+    }
+
+    OS_CPU_SimAdvance(next);
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         START THE VIRTUAL TICK
+*
+* Description: Called by OS_CPU_SysTickInit() to start a tick every 'cnts' virtual counts.
+*
+* Arguments  : cnts         Number of SysTick counts between two OS tick interrupts.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SimTickInit (CPU_INT32U  cnts)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OS_CPU_SimTickPeriod = cnts;
+    OS_CPU_SimTickNext   = OS_CPU_SimTime + cnts;
+    OS_CPU_SimTickCtr    = 0u;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                        SET THE ONE-SHOT TICK
+*
+* Description: Called by OS_DynTickSet() to raise the tick interrupt once, at virtual time 'time'.
+*
+* Arguments  : time         Virtual time of the tick, OS_CPU_SIM_TIME_NONE to cancel it.
+*
+* Note(s)    : 1) Called with interrupts disabled.
+*
+*              2) A time already passed raises the tick interrupt at once.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SimTickSet (CPU_INT64U  time)
+{
+    if (time <= OS_CPU_SimTime) {                               /* See Note #2.                                         */
+        OS_CPU_SimTickMatch = OS_CPU_SIM_TIME_NONE;
+        CPU_IntSrcPendSet(CPU_INT_SYSTICK);
+        return;
+    }
+
+    OS_CPU_SimTickMatch = time;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  SET THE MICROSECOND TIMER MATCH
+*
+* Description: Called by OS_UsTmrSet() & OS_UsTmrStop() to raise the microsecond timer interrupt once, at
+*              virtual time 'time'.
+*
+* Arguments  : time         Virtual time of the match, OS_CPU_SIM_TIME_NONE to cancel it.
+*
+* Note(s)    : 1) Called with interrupts disabled.
+*
+*              2) A time already passed raises the interrupt at once.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SimUsTmrSet (CPU_INT64U  time)
+{
+    if (time <= OS_CPU_SimTime) {                               /* See Note #2.                                         */
+        OS_CPU_SimUsMatch = OS_CPU_SIM_TIME_NONE;
+        CPU_IntSrcPendSet(OS_CPU_US_TMR_INT_POS);
+        return;
+    }
+
+    OS_CPU_SimUsMatch = time;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       ACKNOWLEDGE THE TICK
+*
+* Description: Called by OS_CPU_SysTickHandler() : return & clear the number of ticks elapsed since the
+*              last tick interrupt (more than 1 after an idle fast-forward).
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_CPU_SimTickAck (void)
+{
+    OS_TICK  ticks;
+
+
+    ticks             = OS_CPU_SimTickCtr;
+    OS_CPU_SimTickCtr = 0u;
+
+    return (ticks);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 CPU_TS_TmrInit() / CPU_TS_TmrRd()
+*
+* Description: The CPU timestamp timer of the simulation is the virtual clock, so timestamps & task
+*              profiling are repeatable too.
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+void  CPU_TS_TmrInit (void)
+{
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)OS_CPU_SYS_TICK_FREQ_HZ);
+}
+
+
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    return ((CPU_TS_TMR)OS_CPU_SimTime);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          NEXT EVENT TIME
+*
+* Description: Return the virtual time of the next tick (periodic or one-shot), microsecond timer match
+*              or peripheral interrupt.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  OS_CPU_SimEvtNextGet (void)
+{
+    CPU_INT64U  next;
+
+
+    next = OS_CPU_SIM_TIME_NONE;
+    if (OS_CPU_SimTickPeriod > 0u) {
+        next = OS_CPU_SimTickNext;
+    }
+    if (OS_CPU_SimTickMatch < next) {
+        next = OS_CPU_SimTickMatch;
+    }
+    if (OS_CPU_SimUsMatch < next) {
+        next = OS_CPU_SimUsMatch;
+    }
+    if ((OS_CPU_SimEvtNbr         >  0u) &&
+        (OS_CPU_SimEvtTbl[0].Time < next)) {
+        next = OS_CPU_SimEvtTbl[0].Time;
+    }
+
+    return (next);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NEXT KERNEL EXPIRY
+*
+* Description: Return the virtual time of the tick on which the next delayed/pending task times out or
+*              the next software timer expires.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Called with interrupts disabled.
+*
+*              2) OS_TickListNextGet() returns the ticks to the next tick list event, 0 if there is none.
+*
+*              3) The timer task waits for its next timer wheel event with a timeout, which is in the
+*                 tick list.
+*
+*              4) Without a periodic tick, the next expiry is the one-shot tick programmed by the dynamic
+*                 tick, if any.
+*
+*              5) Hard timers expire from the tick interrupt, not from the tick list : the head of their
+*                 list is an event too.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  OS_CPU_SimExpiryGet (void)
+{
+    OS_TICK  ticks;
+#if (OS_CFG_TMR_EN > 0u) && (OS_CFG_TMR_HARD_EN > 0u)
+    OS_TICK  hard;
+#endif
+
+
+    if (OS_CPU_SimTickPeriod == 0u) {                           /* See Note #4.                                         */
+        return (OS_CPU_SimTickMatch);
+    }
+
+    ticks = OS_TickListNextGet();                               /* See Note #2.                                         */
+
+#if (OS_CFG_TMR_EN > 0u) && (OS_CFG_TMR_HARD_EN > 0u)
+    if (OSTmrHardListPtr != (OS_TMR *)0) {                      /* See Note #5.                                         */
+        hard = OSTmrHardListPtr->Match - OSTickCtr;
+        if ((CPU_INT32S)hard < 1) {
+            hard = 1u;
+        }
+        if ((ticks == 0u) || (hard < ticks)) {
+            ticks = hard;
+        }
+    }
+#endif
+
+    if (ticks == 0u) {
+        return (OS_CPU_SIM_TIME_NONE);
+    }
+
+    return (OS_CPU_SimTickNext + ((CPU_INT64U)(ticks - 1u) * OS_CPU_SimTickPeriod));
+}
+
+
+/*
+*********************************************************************************************************
+*                                       ADVANCE THE VIRTUAL CLOCK
+*
+* Description: Move the virtual clock to 'time' & raise every tick, microsecond timer match & peripheral
+*              interrupt due by then.
+*
+* Arguments  : time         New virtual time, never before the current one.
+*
+* Note(s)    : 1) Called with interrupts disabled : the interrupts raised here are taken, lowest table
+*                 position (the tick) first, when the caller re-enables interrupts.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_SimAdvance (CPU_INT64U  time)
+{
+    CPU_INT64U  ticks;
+    CPU_INT08U  ix;
+    CPU_INT08U  jx;
+
+
+    OS_CPU_SimTime = time;
+
+    if ((OS_CPU_SimTickPeriod >  0u) &&
+        (OS_CPU_SimTickNext   <= time)) {
+        ticks               = ((time - OS_CPU_SimTickNext) / OS_CPU_SimTickPeriod) + 1u;
+        OS_CPU_SimTickNext += ticks * OS_CPU_SimTickPeriod;
+        OS_CPU_SimTickCtr  += (OS_TICK)ticks;
+        CPU_IntSrcPendSet(CPU_INT_SYSTICK);                     /* See Note #1.                                         */
+    }
+
+    if (OS_CPU_SimTickMatch <= time) {                          /* One-shot tick due?                                   */
+        OS_CPU_SimTickMatch = OS_CPU_SIM_TIME_NONE;
+        CPU_IntSrcPendSet(CPU_INT_SYSTICK);
+    }
+
+    if (OS_CPU_SimUsMatch <= time) {                            /* Microsecond timer match due?                         */
+        OS_CPU_SimUsMatch = OS_CPU_SIM_TIME_NONE;
+        CPU_IntSrcPendSet(OS_CPU_US_TMR_INT_POS);
+    }
+
+    ix = 0u;
+    while ((ix                         <  OS_CPU_SimEvtNbr) &&
+           (OS_CPU_SimEvtTbl[ix].Time <= time)) {
+        CPU_IntSrcPendSet(OS_CPU_SimEvtTbl[ix].Pos);
+        ix++;
+    }
+    if (ix > 0u) {                                              /* Remove the raised events from the table              */
+        for (jx = ix; jx < OS_CPU_SimEvtNbr; jx++) {
+            OS_CPU_SimEvtTbl[jx - ix] = OS_CPU_SimEvtTbl[jx];
+        }
+        OS_CPU_SimEvtNbr -= ix;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
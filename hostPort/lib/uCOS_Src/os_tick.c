@@ -0,0 +1,1389 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            TICK MANAGEMENT
+*
+* File    : os_tick.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_tick__c = "$Id: $";
+#endif
+
+#if (OS_CFG_TICK_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void     OS_TickListUpdate   (OS_TICK   ticks);
+static  void     OS_TickListExpire   (OS_TCB   *p_tcb);
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+static  void     OS_TickWheelLink    (OS_TCB   *p_tcb,
+                                      OS_TICK   tick_next);
+static  void     OS_TickWheelUnlink  (OS_TCB   *p_tcb);
+static  void     OS_TickWheelCascade (OS_TICK   tick);
+static  OS_TICK  OS_TickWheelNext    (OS_TICK   tick);
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                      TICK INIT
+*
+* Description: This function initializes the variables related to the tick handler.
+*              The function is internal to uC/OS-III.
+*
+* Arguments  : p_err          is a pointer to a variable that will contain an error code returned by this function.
+*              -----
+*                                 OS_ERR_NONE           the tick variables were initialized successfully
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_TickInit (OS_ERR  *p_err)
+{
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    CPU_INT16U  i;
+#endif
+
+
+    *p_err                = OS_ERR_NONE;
+
+    OSTickCtr             = 0u;                               /* Clear the tick counter                               */
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSTickCtrStep         = 0u;
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    OSTickTS              = 0u;
+#endif
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    for (i = 0u; i < (OS_CFG_TICK_WHEEL_LVL_NBR * OS_TICK_WHEEL_SLOT_NBR); i++) {
+        OSTickList.SlotTbl[i] = (OS_TCB *)0;                  /* All the slots are empty                              */
+    }
+    for (i = 0u; i < OS_CFG_TICK_WHEEL_LVL_NBR; i++) {
+        OSTickList.SlotMap[i] = 0u;
+    }
+#else
+    OSTickList.TCB_Ptr    = (OS_TCB *)0;
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    OSTickList.NbrEntries = 0u;
+    OSTickList.NbrUpdated = 0u;
+#endif
+
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    OSTickMergeCtr        = 0u;
+#endif
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    OSTickUsListPtr       = (OS_TCB *)0;
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                                      TICK UPDATE
+*
+* Description: This function updates the list of task either delayed pending with timeout.
+*              The function is internal to uC/OS-III.
+*
+* Arguments  : ticks          the number of ticks which have elapsed
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) The callbacks of the hard timers run after the tick list is updated, with interrupts enabled.  Hard
+*                 timers & the dynamic tick are exclusive (see os.h), the next tick need not account for them.
+************************************************************************************************************************
+*/
+
+void  OS_TickUpdate (OS_TICK  ticks)
+{
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS  ts_start;
+#endif
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+
+    OSTickCtr += ticks;                                         /* Keep track of the number of ticks                    */
+
+    OS_TRACE_TICK_INCREMENT(OSTickCtr);
+
+#if (OS_CFG_TS_EN > 0u)
+    ts_start   = OS_TS_GET();
+    OSTickTS   = ts_start;                                      /* Time base of the expiries of this tick               */
+    OS_TickListUpdate(ticks);
+    OSTickTime = OS_TS_GET() - ts_start;
+    if (OSTickTimeMax < OSTickTime) {
+        OSTickTimeMax = OSTickTime;
+    }
+#else
+    OS_TickListUpdate(ticks);
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSTickCtrStep = OS_TickListNextGet();
+
+    OS_DynTickSet(OSTickCtrStep);
+#endif
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_TMR_EN > 0u) && (OS_CFG_TMR_HARD_EN > 0u)
+    OS_TmrHardUpdate();                                         /* Run the callbacks of the hard timers which are due   */
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                             ALIGN A DEADLINE WITH SLACK
+*
+* Description: This function picks the tick on which a delay or a timer, allowed to expire up to 'slack' ticks late,
+*              actually expires.
+*
+* Arguments  : match          is the value of OSTickCtr at which the delay or the timer should expire.
+*
+*              slack          is the number of ticks by which the expiry may be extended.
+*
+* Returns    : The tick of [match, match + slack] which is a multiple of the largest power of 2.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Every deadline whose window contains a multiple of 2^n, & no multiple of 2^(n+1), is moved to the same
+*                 tick, whatever its slack, so the tasks & the timers with a slack end up sharing their expiries
+*                 without having to know about each other.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+OS_TICK  OS_TickSlackAlign (OS_TICK  match,
+                            OS_TICK  slack)
+{
+    OS_TICK  last;
+    OS_TICK  aligned;
+    OS_TICK  next;
+
+
+    last    = match + slack;                                    /* Latest acceptable expiry                             */
+    aligned = last;
+    while (aligned != 0u) {
+        next = aligned & (aligned - 1u);                        /* Clear the lowest bit set: next multiple of 2^(n+1)   */
+        if ((last - next) > slack) {                            /* Would expire before 'match'?                         */
+            break;
+        }
+        aligned = next;
+    }
+
+    return (aligned);
+}
+#endif
+
+#if (OS_CFG_TICK_WHEEL_EN == 0u)
+/*
+************************************************************************************************************************
+*                                                      INSERT
+*
+* Description: This task is internal to uC/OS-III and allows the insertion of a task in a tick list.
+*
+* Arguments  : p_tcb       is a pointer to the TCB to insert in the list
+*
+*              elapsed     is the number of elapsed ticks since the last tick interrupt
+*
+*              tick_base   is value of OSTickCtr from which time is offset
+*
+*              time        is the amount of time remaining (in ticks) for the task to become ready
+*
+* Returns    : OS_TRUE     if time is valid for the given tick base
+*
+*              OS_FALSE    if time is invalid (i.e. zero delay)
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function supports both Periodic Tick Mode (PTM) and Dynamic Tick Mode (DTM).
+*
+*              3) PTM should always call this function with elapsed == 0u.
+*
+*              4) A task with a slack (see OSTaskSlackSet()) joins the first expiry of the list which falls within its
+*                 slack.  When there is none, its expiry is aligned by OS_TickSlackAlign() so that the tasks which come
+*                 next can join it.  OSTickMergeCtr counts the expiries which were actually moved.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
+                                OS_TICK   elapsed,
+                                OS_TICK   tick_base,
+                                OS_TICK   time)
+{
+    OS_TCB        *p_tcb1;
+    OS_TCB        *p_tcb2;
+    OS_TICK_LIST  *p_list;
+    OS_TICK        delta;
+    OS_TICK        remain;
+
+
+    delta = (time + tick_base) - (OSTickCtr + elapsed);         /* How many ticks until our delay expires?              */
+
+    if (delta == 0u) {
+        p_tcb->TickRemain = 0u;
+        return (OS_FALSE);
+    }
+
+    p_list = &OSTickList;
+
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    if (p_tcb->TickSlack > 0u) {                                /* See Note #4.                                         */
+        p_tcb2 = p_list->TCB_Ptr;
+        remain = 0u;
+        if (p_tcb2 != (OS_TCB *)0) {
+            remain = p_tcb2->TickRemain - elapsed;
+            while ((remain < delta) &&                          /* Find the first expiry at or after ours               */
+                   (p_tcb2->TickNextPtr != (OS_TCB *)0)) {
+                p_tcb2  = p_tcb2->TickNextPtr;
+                remain += p_tcb2->TickRemain;
+            }
+        }
+        if ((remain           <  delta) ||                      /* Does it fall outside of our slack?                   */
+            ((remain - delta) >  p_tcb->TickSlack)) {
+            remain = OS_TickSlackAlign(time + tick_base, p_tcb->TickSlack) - (OSTickCtr + elapsed);
+        }
+        if (remain != delta) {                                  /* Moved by the slack?                                  */
+            OSTickMergeCtr++;
+            delta = remain;
+        }
+    }
+#endif
+
+    OS_TRACE_TASK_DLY(delta);
+
+    if (p_list->TCB_Ptr == (OS_TCB *)0) {                       /* Is the list empty?                                   */
+        p_tcb->TickRemain   = delta;                            /* Yes, Store time in TCB                               */
+        p_tcb->TickNextPtr  = (OS_TCB *)0;
+        p_tcb->TickPrevPtr  = (OS_TCB *)0;
+        p_list->TCB_Ptr     = p_tcb;                            /* Point to TCB of task to place in the list            */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        if (elapsed != 0u) {
+            OSTickCtr      += elapsed;                          /* Update OSTickCtr before we set a new tick step.      */
+            OS_TRACE_TICK_INCREMENT(OSTickCtr);
+        }
+
+        OSTickCtrStep       = delta;
+        OS_DynTickSet(OSTickCtrStep);
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+        p_list->NbrEntries  = 1u;                               /* List contains 1 entry                                */
+#endif
+        return (OS_TRUE);
+    }
+
+
+#if (OS_CFG_DBG_EN > 0u)
+    p_list->NbrEntries++;                                       /* Update debug counter to reflect the new entry.       */
+#endif
+
+    p_tcb2 = p_list->TCB_Ptr;
+    remain = p_tcb2->TickRemain - elapsed;                      /* How many ticks until the head's delay expires?       */
+
+    if ((delta               <   remain) &&                     /* If our entry is the new head of the tick list    ... */
+        (p_tcb2->TickPrevPtr == (OS_TCB *)0)) {
+        p_tcb->TickRemain    =  delta;                          /* ... the delta is equivalent to the full delay    ... */
+        p_tcb2->TickRemain   =  remain - delta;                 /* ... the previous head's delta is now relative to it. */
+
+        p_tcb->TickPrevPtr   = (OS_TCB *)0;
+        p_tcb->TickNextPtr   =  p_tcb2;
+        p_tcb2->TickPrevPtr  =  p_tcb;
+        p_list->TCB_Ptr      =  p_tcb;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        if (elapsed != 0u) {
+            OSTickCtr       +=  elapsed;                        /* Update OSTickCtr before we set a new tick step.      */
+            OS_TRACE_TICK_INCREMENT(OSTickCtr);
+        }
+                                                                /* In DTM, a new list head must update the tick     ... */
+        OSTickCtrStep        =  delta;                          /* ... timer to interrupt at the new delay value.       */
+        OS_DynTickSet(OSTickCtrStep);
+#endif
+
+        return (OS_TRUE);
+    }
+
+                                                                /* Our entry comes after the current list head.         */
+    delta  -= remain;                                           /* Make delta relative to the head.                     */
+    p_tcb1  = p_tcb2;
+    p_tcb2  = p_tcb1->TickNextPtr;
+
+    while ((p_tcb2 !=        (OS_TCB *)0) &&                    /* Find the appropriate position in the delta list.     */
+           (delta  >= p_tcb2->TickRemain)) {
+        delta  -= p_tcb2->TickRemain;
+        p_tcb1  = p_tcb2;
+        p_tcb2  = p_tcb2->TickNextPtr;
+    }
+
+    if (p_tcb2 != (OS_TCB *)0) {                                /* Our entry is not the last element in the list.       */
+        p_tcb1               = p_tcb2->TickPrevPtr;
+        p_tcb->TickRemain    = delta;                           /* Store remaining time                                 */
+        p_tcb->TickPrevPtr   = p_tcb1;
+        p_tcb->TickNextPtr   = p_tcb2;
+        p_tcb2->TickRemain  -= delta;                           /* Reduce time of next entry in the list                */
+        p_tcb2->TickPrevPtr  = p_tcb;
+        p_tcb1->TickNextPtr  = p_tcb;
+
+    } else {                                                    /* Our entry belongs at the end of the list.            */
+        p_tcb->TickRemain    = delta;
+        p_tcb->TickPrevPtr   = p_tcb1;
+        p_tcb->TickNextPtr   = (OS_TCB *)0;
+        p_tcb1->TickNextPtr  = p_tcb;
+    }
+
+    return (OS_TRUE);
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                            ADD DELAYED TASK TO TICK LIST
+*
+* Description: This function is called to place a task in a list of task waiting for time to expire
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task to add to the tick list
+*              -----
+*
+*              time           represents either the 'match' value of OSTickCtr or a relative time from the current
+*                             system time as specified by the 'opt' argument..
+*
+*                             relative when 'opt' is set to OS_OPT_TIME_DLY
+*                             relative when 'opt' is set to OS_OPT_TIME_TIMEOUT
+*                             match    when 'opt' is set to OS_OPT_TIME_MATCH
+*                             periodic when 'opt' is set to OS_OPT_TIME_PERIODIC
+*
+*              opt            is an option specifying how to calculate time.  The valid values are:
+*              ---
+*                                 OS_OPT_TIME_DLY
+*                                 OS_OPT_TIME_TIMEOUT
+*                                 OS_OPT_TIME_PERIODIC
+*                                 OS_OPT_TIME_MATCH
+*
+*              p_err          is a pointer to a variable that will contain an error code returned by this function.
+*              -----
+*                                 OS_ERR_NONE           the call was successful and the time delay was scheduled.
+*                                 OS_ERR_TIME_ZERO_DLY  if the effective delay is zero
+*
+* Returns    : None
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_TickListInsertDly (OS_TCB   *p_tcb,
+                            OS_TICK   time,
+                            OS_OPT    opt,
+                            OS_ERR   *p_err)
+{
+    OS_TICK      elapsed;
+    OS_TICK      tick_base;
+    OS_TICK      base_offset;
+    CPU_BOOLEAN  valid_dly;
+
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    elapsed  = OS_DynTickGet();
+#else
+    elapsed  = 0u;
+#endif
+
+    if (opt == OS_OPT_TIME_MATCH) {                             /* MATCH to absolute tick ctr value mode                */
+        tick_base = 0u;                                         /* tick_base + time == time                             */
+
+    } else if (opt == OS_OPT_TIME_PERIODIC) {                   /* PERIODIC mode.                                       */
+        if (time == 0u) {
+           *p_err = OS_ERR_TIME_ZERO_DLY;                       /* Infinite frequency is invalid.                       */
+            return;
+        }
+
+        tick_base = p_tcb->TickCtrPrev;
+
+#if (OS_CFG_DYN_TICK_EN > 0u)                                   /* How far is our tick-base from the system time?       */
+        base_offset = OSTickCtr + elapsed - tick_base;
+#else
+        base_offset = OSTickCtr - tick_base;
+#endif
+
+        if (base_offset >= time) {                              /* If our task missed the last period, move         ... */
+            tick_base += time * (base_offset / time);           /* ... tick_base up to the next one.                    */
+            if ((base_offset % time) != 0u) {
+                tick_base += time;                              /* Account for rounding errors with integer division    */
+            }
+
+            p_tcb->TickCtrPrev = tick_base;                     /* Adjust the periodic tick base                        */
+        }
+
+        p_tcb->TickCtrPrev += time;                             /* Update for the next time we perform a periodic dly.  */
+
+    } else {                                                    /* RELATIVE time delay mode                             */
+#if (OS_CFG_DYN_TICK_EN > 0u)                                   /* Our base is always the current system time.          */
+        tick_base = OSTickCtr + elapsed;
+#else
+        tick_base = OSTickCtr;
+#endif
+    }
+
+    valid_dly = OS_TickListInsert(p_tcb, elapsed, tick_base, time);
+
+    if (valid_dly == OS_TRUE) {
+        p_tcb->TaskState = OS_TASK_STATE_DLY;
+       *p_err            = OS_ERR_NONE;
+    } else {
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+    }
+}
+
+#if (OS_CFG_TICK_WHEEL_EN == 0u)
+/*
+************************************************************************************************************************
+*                                         REMOVE A TASK FROM THE TICK LIST
+*
+* Description: This function is called to remove a task from the tick list
+*
+* Arguments  : p_tcb          Is a pointer to the OS_TCB to remove.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) A task delayed by OSTimeDlyUs(), or pending with OS_OPT_PEND_TIMEOUT_US, is in the microsecond list
+*                 instead, so that the callers need not care which list holds the task.
+************************************************************************************************************************
+*/
+
+void  OS_TickListRemove (OS_TCB  *p_tcb)
+{
+    OS_TCB        *p_tcb1;
+    OS_TCB        *p_tcb2;
+    OS_TICK_LIST  *p_list;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK        elapsed;
+#endif
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    if (p_tcb->UsDly == OS_TRUE) {                              /* See Note #3                                          */
+        OS_TickUsListRemove(p_tcb);
+        return;
+    }
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    elapsed = OS_DynTickGet();
+#endif
+
+    p_tcb1 = p_tcb->TickPrevPtr;
+    p_tcb2 = p_tcb->TickNextPtr;
+    p_list = &OSTickList;
+    if (p_tcb1 == (OS_TCB *)0) {
+        if (p_tcb2 == (OS_TCB *)0) {                            /* Remove the ONLY entry in the list?                   */
+            p_list->TCB_Ptr      = (OS_TCB *)0;
+#if (OS_CFG_DBG_EN > 0u)
+            p_list->NbrEntries   =           0u;
+#endif
+            p_tcb->TickRemain    =           0u;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+            if (elapsed != 0u) {
+                OSTickCtr       += elapsed;                     /* Keep track of time.                                  */
+                OS_TRACE_TICK_INCREMENT(OSTickCtr);
+            }
+            OSTickCtrStep        =           0u;
+            OS_DynTickSet(OSTickCtrStep);
+#endif
+        } else {
+            p_tcb2->TickPrevPtr  = (OS_TCB *)0;
+            p_tcb2->TickRemain  += p_tcb->TickRemain;           /* Add back the ticks to the delta                      */
+            p_list->TCB_Ptr      = p_tcb2;
+#if (OS_CFG_DBG_EN > 0u)
+            p_list->NbrEntries--;
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+            if (p_tcb2->TickRemain != p_tcb->TickRemain) {      /* Only set a new tick if tcb2 had a longer delay.      */
+                if (elapsed != 0u) {
+                    OSTickCtr          += elapsed;              /* Keep track of time.                                  */
+                    OS_TRACE_TICK_INCREMENT(OSTickCtr);
+                    p_tcb2->TickRemain -= elapsed;              /* We must account for any time which has passed.       */
+                }
+                OSTickCtrStep           = p_tcb2->TickRemain;
+                OS_DynTickSet(OSTickCtrStep);
+            }
+#endif
+            p_tcb->TickNextPtr          = (OS_TCB *)0;
+            p_tcb->TickRemain           =           0u;
+        }
+    } else {
+        p_tcb1->TickNextPtr = p_tcb2;
+        if (p_tcb2 != (OS_TCB *)0) {
+            p_tcb2->TickPrevPtr  = p_tcb1;
+            p_tcb2->TickRemain  += p_tcb->TickRemain;            /* Add back the ticks to the delta list                 */
+        }
+        p_tcb->TickPrevPtr       = (OS_TCB *)0;
+#if (OS_CFG_DBG_EN > 0u)
+        p_list->NbrEntries--;
+#endif
+        p_tcb->TickNextPtr       = (OS_TCB *)0;
+        p_tcb->TickRemain        =           0u;
+    }
+}
+
+/*
+************************************************************************************************************************
+*                                        GET THE NUMBER OF TICKS TO THE NEXT EVENT
+*
+* Description: This function returns the number of ticks from OSTickCtr to the next tick on which the tick list has
+*              work to do.
+*
+* Arguments  : none
+*
+* Returns    : The number of ticks, 0 if the tick list is empty.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+OS_TICK  OS_TickListNextGet (void)
+{
+    if (OSTickList.TCB_Ptr == (OS_TCB *)0) {
+        return (0u);
+    }
+
+    return (OSTickList.TCB_Ptr->TickRemain);                    /* The head of the delta list expires first             */
+}
+
+/*
+************************************************************************************************************************
+*                                 UPDATE THE LIST OF TASKS DELAYED OR PENDING WITH TIMEOUT
+*
+* Description: This function updates the delta list which contains tasks that are delayed or pending with a timeout.
+*
+* Arguments  : ticks          the number of ticks which have elapsed.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickListUpdate (OS_TICK  ticks)
+{
+    OS_TCB        *p_tcb;
+    OS_TICK_LIST  *p_list;
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY     nbr_updated;
+#endif
+
+
+#if (OS_CFG_DBG_EN > 0u)
+    nbr_updated = 0u;
+#endif
+    p_list      = &OSTickList;
+    p_tcb       = p_list->TCB_Ptr;
+    if (p_tcb != (OS_TCB *)0) {
+        if (p_tcb->TickRemain <= ticks) {
+            ticks              = ticks - p_tcb->TickRemain;
+            p_tcb->TickRemain  = 0u;
+        } else {
+            p_tcb->TickRemain -= ticks;
+        }
+
+        while (p_tcb->TickRemain == 0u) {
+#if (OS_CFG_DBG_EN > 0u)
+            nbr_updated++;
+#endif
+
+            OS_TickListExpire(p_tcb);
+
+            p_list->TCB_Ptr = p_tcb->TickNextPtr;
+            p_tcb           = p_list->TCB_Ptr;                           /* Get 'p_tcb' again for loop                           */
+            if (p_tcb == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                p_list->NbrEntries = 0u;
+#endif
+                break;
+            } else {
+#if (OS_CFG_DBG_EN > 0u)
+                p_list->NbrEntries--;
+#endif
+                p_tcb->TickPrevPtr = (OS_TCB *)0;
+                if (p_tcb->TickRemain <= ticks) {
+                    ticks              = ticks - p_tcb->TickRemain;
+                    p_tcb->TickRemain  = 0u;
+                } else {
+                    p_tcb->TickRemain -= ticks;
+                }
+            }
+        }
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_list->NbrUpdated = nbr_updated;
+#endif
+}
+
+#endif
+
+/*
+************************************************************************************************************************
+*                                             EXPIRE A DELAY OR A TIMEOUT
+*
+* Description: This function is called when the delay or the pend timeout of a task, just removed from the tick list,
+*              expires.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) The time at which the delay taken by OSTaskWaitNextPeriod() expires is the release time of the next job
+*                 of the task.  Any other delay or timeout of the task expires within a job & is not a release.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickListExpire (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_MUTEX_EN > 0u)
+    OS_TCB   *p_tcb_owner;
+    OS_PRIO   prio_new;
+#endif
+
+
+#if (OS_CFG_TASK_PERIOD_EN > 0u) && (OS_CFG_TASK_PROFILE_EN > 0u)
+    if (p_tcb->PeriodWait == OS_TRUE) {                         /* See Note #3.                                         */
+        p_tcb->PeriodReleaseTS = OS_TS_GET();
+    }
+#endif
+
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_DLY:
+             p_tcb->TaskState = OS_TASK_STATE_RDY;
+             OS_RdyListInsert(p_tcb);                           /* Insert the task in the ready list                    */
+             break;
+
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
+             break;
+
+        default:
+#if (OS_CFG_MUTEX_EN > 0u)
+             p_tcb_owner = (OS_TCB *)0;
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
+                 p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
+             }
+#endif
+
+#if (OS_MSG_EN > 0u)
+             p_tcb->MsgPtr  = (void *)0;
+             p_tcb->MsgSize = 0u;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+             p_tcb->TS      = OS_TS_GET();
+#endif
+             OS_PendListRemove(p_tcb);                          /* Remove task from pend list                           */
+
+             switch (p_tcb->TaskState) {
+                 case OS_TASK_STATE_PEND_TIMEOUT:
+                      OS_RdyListInsert(p_tcb);                  /* Insert the task in the ready list                    */
+                      p_tcb->TaskState  = OS_TASK_STATE_RDY;
+                      break;
+
+                 case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+                      p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
+                      break;
+
+                 default:
+                      break;
+             }
+             p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;        /* Indicate pend timed out                              */
+             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;       /* Indicate no longer pending                           */
+
+#if (OS_CFG_MUTEX_EN > 0u)
+             if (p_tcb_owner != (OS_TCB *)0) {
+                 if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
+                     (p_tcb_owner->Prio == p_tcb->Prio)) {      /* Has the owner inherited a priority?                  */
+                     prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                     prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                     if (prio_new != p_tcb_owner->Prio) {
+                         OS_TaskChangePrio(p_tcb_owner, prio_new);
+                         OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+                     }
+                 }
+             }
+#endif
+             break;
+    }
+}
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                    TIMING WHEEL
+*
+* Note(s) : 1) With OS_CFG_TICK_WHEEL_EN, OSTickList is a hierarchical timing wheel instead of a delta list.  Level 'n'
+*              has 32 slots of 32^n ticks each.  A task is filed by the tick on which its delay expires (TickMatch), in
+*              the lowest level whose span covers the delay, so insertion & removal are O(1).
+*
+*           2) When OSTickCtr reaches the start of a level 'n' slot (n > 0), the tasks in that slot are cascaded down to
+*              the lower levels.  The tasks in a level 0 slot all expire on the same tick.  A task is cascaded at most
+*              OS_CFG_TICK_WHEEL_LVL_NBR - 1 times, the cost per tick is amortised O(1).
+*
+*           3) Delays beyond the span of the top level are parked in its farthest slot & filed again when that slot is
+*              cascaded.
+*
+*           4) TickRemain holds the delay when the task was inserted & is cleared when the task leaves the wheel.
+************************************************************************************************************************
+*/
+
+/*
+************************************************************************************************************************
+*                                                      INSERT
+*
+* Description: This task is internal to uC/OS-III and allows the insertion of a task in a tick list.
+*
+* Arguments  : p_tcb       is a pointer to the TCB to insert in the list
+*
+*              elapsed     is the number of elapsed ticks since the last tick interrupt
+*
+*              tick_base   is value of OSTickCtr from which time is offset
+*
+*              time        is the amount of time remaining (in ticks) for the task to become ready
+*
+* Returns    : OS_TRUE     if time is valid for the given tick base
+*
+*              OS_FALSE    if time is invalid (i.e. zero delay)
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function supports both Periodic Tick Mode (PTM) and Dynamic Tick Mode (DTM).
+*
+*              3) PTM should always call this function with elapsed == 0u.
+*
+*              4) In DTM, no task times out & no slot is cascaded before the tick the timer is set for, OSTickCtr can
+*                 catch up with the elapsed ticks without updating the wheel.
+*
+*              5) The expiry of a task with a slack (see OSTaskSlackSet()) is aligned by OS_TickSlackAlign(), so that
+*                 the tasks whose windows overlap share a level 0 slot.  OSTickMergeCtr counts the expiries which were
+*                 actually moved.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
+                                OS_TICK   elapsed,
+                                OS_TICK   tick_base,
+                                OS_TICK   time)
+{
+    OS_TICK  delta;
+    OS_TICK  match;
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    OS_TICK  aligned;
+#endif
+
+
+    match = time + tick_base;
+    delta = match - (OSTickCtr + elapsed);                      /* How many ticks until our delay expires?              */
+
+    if (delta == 0u) {
+        p_tcb->TickRemain = 0u;
+        return (OS_FALSE);
+    }
+
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    if (p_tcb->TickSlack > 0u) {                                /* See Note #5.                                         */
+        aligned = OS_TickSlackAlign(match, p_tcb->TickSlack);
+        if (aligned != match) {                                 /* Moved by the slack?                                  */
+            OSTickMergeCtr++;
+            match = aligned;
+            delta = match - (OSTickCtr + elapsed);
+        }
+    }
+#endif
+
+    OS_TRACE_TASK_DLY(delta);
+
+    p_tcb->TickRemain = delta;
+    p_tcb->TickMatch  = match;
+#if (OS_CFG_DBG_EN > 0u)
+    OSTickList.NbrEntries++;
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if ((OSTickCtrStep == 0u) ||                                /* If our entry is the next event of the tick list  ... */
+        (delta         <  (OSTickCtrStep - elapsed))) {
+        if (elapsed != 0u) {
+            OSTickCtr += elapsed;                               /* Update OSTickCtr before we set a new tick step.      */
+            OS_TRACE_TICK_INCREMENT(OSTickCtr);                 /* See Note #4.                                         */
+        }
+        OS_TickWheelLink(p_tcb, OSTickCtr + 1u);
+                                                                /* ... the tick timer must interrupt at the new delay.  */
+        OSTickCtrStep = delta;
+        OS_DynTickSet(OSTickCtrStep);
+
+        return (OS_TRUE);
+    }
+#endif
+
+    OS_TickWheelLink(p_tcb, OSTickCtr + 1u);
+
+    return (OS_TRUE);
+}
+
+/*
+************************************************************************************************************************
+*                                         REMOVE A TASK FROM THE TICK LIST
+*
+* Description: This function is called to remove a task from the tick list
+*
+* Arguments  : p_tcb          Is a pointer to the OS_TCB to remove.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) A task delayed by OSTimeDlyUs(), or pending with OS_OPT_PEND_TIMEOUT_US, is in the microsecond list
+*                 instead, so that the callers need not care which list holds the task.
+************************************************************************************************************************
+*/
+
+void  OS_TickListRemove (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK  elapsed;
+    OS_TICK  next;
+#endif
+
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    if (p_tcb->UsDly == OS_TRUE) {                              /* See Note #3                                          */
+        OS_TickUsListRemove(p_tcb);
+        return;
+    }
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    elapsed = OS_DynTickGet();
+#endif
+
+    OS_TickWheelUnlink(p_tcb);
+    p_tcb->TickRemain = 0u;
+#if (OS_CFG_DBG_EN > 0u)
+    OSTickList.NbrEntries--;
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if (p_tcb->TickMatch == (OSTickCtr + OSTickCtrStep)) {     /* Was our entry the next event of the tick list?       */
+        next = OS_TickListNextGet();
+        if (next != OSTickCtrStep) {                            /* Only set a new tick if the next event is later.      */
+            if (elapsed != 0u) {
+                OSTickCtr += elapsed;                           /* Keep track of time.                                  */
+                OS_TRACE_TICK_INCREMENT(OSTickCtr);
+            }
+            OSTickCtrStep = (next != 0u) ? (next - elapsed) : 0u;
+            OS_DynTickSet(OSTickCtrStep);
+        }
+    }
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                        GET THE NUMBER OF TICKS TO THE NEXT EVENT
+*
+* Description: This function returns the number of ticks from OSTickCtr to the next tick on which the tick list has
+*              work to do : a task times out or a slot is cascaded.
+*
+* Arguments  : none
+*
+* Returns    : The number of ticks, 0 if the tick list is empty.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+OS_TICK  OS_TickListNextGet (void)
+{
+    return (OS_TickWheelNext(OSTickCtr));
+}
+
+/*
+************************************************************************************************************************
+*                                 UPDATE THE LIST OF TASKS DELAYED OR PENDING WITH TIMEOUT
+*
+* Description: This function processes the ticks which have elapsed : it cascades the slots whose start is reached &
+*              expires the tasks of the level 0 slot of each tick.
+*
+* Arguments  : ticks          the number of ticks which have elapsed.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The ticks on which the wheel has nothing to do are skipped, a multi-tick update (DTM) costs one step
+*                 per event.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickListUpdate (OS_TICK  ticks)
+{
+    OS_TCB      *p_tcb;
+    OS_TCB      *p_tcb_next;
+    OS_TICK      tick;
+    OS_TICK      step;
+    CPU_INT08U   slot;
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY   nbr_updated;
+#endif
+
+
+#if (OS_CFG_DBG_EN > 0u)
+    nbr_updated = 0u;
+#endif
+    tick = OSTickCtr - ticks;                                   /* Last tick processed                                  */
+    while (ticks > 0u) {
+        step = OS_TickWheelNext(tick);                          /* See Note #2.                                         */
+        if ((step == 0u) || (step > ticks)) {
+            break;
+        }
+        tick  += step;
+        ticks -= step;
+
+        OS_TickWheelCascade(tick);
+
+        slot  = (CPU_INT08U)(tick & OS_TICK_WHEEL_SLOT_MSK);
+        p_tcb = OSTickList.SlotTbl[slot];
+        if (p_tcb != (OS_TCB *)0) {                             /* Every task in the level 0 slot expires now           */
+            OSTickList.SlotTbl[slot]  = (OS_TCB *)0;
+            OSTickList.SlotMap[0]    &= ~((CPU_INT32U)1u << slot);
+            while (p_tcb != (OS_TCB *)0) {
+                p_tcb_next         = p_tcb->TickNextPtr;
+                p_tcb->TickNextPtr = (OS_TCB *)0;
+                p_tcb->TickPrevPtr = (OS_TCB *)0;
+                p_tcb->TickRemain  = 0u;
+#if (OS_CFG_DBG_EN > 0u)
+                OSTickList.NbrEntries--;
+                nbr_updated++;
+#endif
+                OS_TickListExpire(p_tcb);
+                p_tcb              = p_tcb_next;
+            }
+        }
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    OSTickList.NbrUpdated = nbr_updated;
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                             FILE A TASK IN THE WHEEL
+*
+* Description: This function places a task in the slot matching its expiry (TickMatch).
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task.
+*              -----
+*
+*              tick_next      is the next tick the wheel will process.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickWheelLink (OS_TCB   *p_tcb,
+                                OS_TICK   tick_next)
+{
+    OS_TCB      **p_slot;
+    OS_TICK       delta;
+    OS_TICK       match;
+    CPU_INT08U    lvl;
+    CPU_INT08U    shift;
+    CPU_INT08U    slot;
+
+
+    match = p_tcb->TickMatch;
+    delta = match - tick_next;
+    lvl   = 0u;
+    shift = 0u;
+    while ((lvl < (OS_CFG_TICK_WHEEL_LVL_NBR - 1u)) &&          /* Find the lowest level whose span covers the delay    */
+           ((delta >> (shift + OS_TICK_WHEEL_SLOT_BITS)) != 0u)) {
+        lvl++;
+        shift += OS_TICK_WHEEL_SLOT_BITS;
+    }
+    if ((delta >> (shift + OS_TICK_WHEEL_SLOT_BITS)) != 0u) {   /* Beyond the top level: park in its farthest slot      */
+        match = tick_next + (((OS_TICK)1u << (shift + OS_TICK_WHEEL_SLOT_BITS)) - 1u);
+    }
+
+    slot            = (CPU_INT08U)((match >> shift) & OS_TICK_WHEEL_SLOT_MSK);
+    p_tcb->TickSlot = (CPU_INT08U)((lvl * OS_TICK_WHEEL_SLOT_NBR) + slot);
+
+    p_slot              = &OSTickList.SlotTbl[p_tcb->TickSlot];
+    p_tcb->TickPrevPtr  = (OS_TCB *)0;
+    p_tcb->TickNextPtr  = *p_slot;
+    if (*p_slot != (OS_TCB *)0) {
+        (*p_slot)->TickPrevPtr = p_tcb;
+    }
+    *p_slot             = p_tcb;
+
+    OSTickList.SlotMap[lvl] |= (CPU_INT32U)1u << slot;
+}
+
+/*
+************************************************************************************************************************
+*                                            REMOVE A TASK FROM ITS SLOT
+*
+* Description: This function unlinks a task from the wheel slot holding it.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickWheelUnlink (OS_TCB  *p_tcb)
+{
+    OS_TCB  *p_tcb1;
+    OS_TCB  *p_tcb2;
+
+
+    p_tcb1 = p_tcb->TickPrevPtr;
+    p_tcb2 = p_tcb->TickNextPtr;
+    if (p_tcb1 == (OS_TCB *)0) {                                /* Head of the slot?                                    */
+        OSTickList.SlotTbl[p_tcb->TickSlot] = p_tcb2;
+        if (p_tcb2 == (OS_TCB *)0) {                            /* Slot is now empty                                    */
+            OSTickList.SlotMap[p_tcb->TickSlot >> OS_TICK_WHEEL_SLOT_BITS] &=
+                ~((CPU_INT32U)1u << (p_tcb->TickSlot & OS_TICK_WHEEL_SLOT_MSK));
+        }
+    } else {
+        p_tcb1->TickNextPtr = p_tcb2;
+    }
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr = p_tcb1;
+    }
+
+    p_tcb->TickPrevPtr = (OS_TCB *)0;
+    p_tcb->TickNextPtr = (OS_TCB *)0;
+}
+
+/*
+************************************************************************************************************************
+*                                                 CASCADE THE WHEEL
+*
+* Description: This function files again, closer to their expiry, the tasks of every slot which starts on 'tick'.
+*
+* Arguments  : tick           is the tick being processed.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The tasks cascaded to level 0 slot of 'tick' expire on this tick.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickWheelCascade (OS_TICK  tick)
+{
+    OS_TCB      *p_tcb;
+    OS_TCB      *p_tcb_next;
+    CPU_INT08U   lvl;
+    CPU_INT08U   shift;
+    CPU_INT08U   slot;
+
+
+    shift = OS_TICK_WHEEL_SLOT_BITS;
+    for (lvl = 1u; lvl < OS_CFG_TICK_WHEEL_LVL_NBR; lvl++) {
+        if ((tick & (((OS_TICK)1u << shift) - 1u)) != 0u) {     /* Does a slot of this level start on this tick?        */
+            break;
+        }
+        slot = (CPU_INT08U)((tick >> shift) & OS_TICK_WHEEL_SLOT_MSK);
+        if ((OSTickList.SlotMap[lvl] & ((CPU_INT32U)1u << slot)) != 0u) {
+            OSTickList.SlotMap[lvl] &= ~((CPU_INT32U)1u << slot);
+            p_tcb = OSTickList.SlotTbl[(lvl * OS_TICK_WHEEL_SLOT_NBR) + slot];
+            OSTickList.SlotTbl[(lvl * OS_TICK_WHEEL_SLOT_NBR) + slot] = (OS_TCB *)0;
+            while (p_tcb != (OS_TCB *)0) {
+                p_tcb_next = p_tcb->TickNextPtr;
+                OS_TickWheelLink(p_tcb, tick);
+                p_tcb      = p_tcb_next;
+            }
+        }
+        shift += OS_TICK_WHEEL_SLOT_BITS;
+    }
+}
+
+/*
+************************************************************************************************************************
+*                                              FIND THE NEXT WHEEL EVENT
+*
+* Description: This function finds the next tick on which a task times out or a non-empty slot is cascaded.
+*
+* Arguments  : tick           is the last tick processed.
+*
+* Returns    : The number of ticks from 'tick' to the event, 0 if the wheel is empty.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Each level is searched from its current slot.  Unless the next tick starts that slot, the current slot
+*                 of a level above 0 was already cascaded & only holds tasks a full turn away.
+************************************************************************************************************************
+*/
+
+static  OS_TICK  OS_TickWheelNext (OS_TICK  tick)
+{
+    OS_TICK      tick_next;
+    OS_TICK      ticks;
+    OS_TICK      step;
+    CPU_INT32U   map;
+    CPU_INT08U   lvl;
+    CPU_INT08U   shift;
+    CPU_INT08U   slot;
+    CPU_DATA     ix;
+
+
+    tick_next = tick + 1u;
+    ticks     = 0u;
+    shift     = 0u;
+    for (lvl = 0u; lvl < OS_CFG_TICK_WHEEL_LVL_NBR; lvl++) {
+        map = OSTickList.SlotMap[lvl];
+        if (map != 0u) {
+            slot = (CPU_INT08U)((tick_next >> shift) & OS_TICK_WHEEL_SLOT_MSK);
+            if (slot != 0u) {                                   /* Rotate the current slot to bit 0                     */
+                map = (map >> slot) | (map << (OS_TICK_WHEEL_SLOT_NBR - slot));
+            }
+            if ((tick_next & (((OS_TICK)1u << shift) - 1u)) != 0u) {
+                if ((map & ~(CPU_INT32U)1u) != 0u) {            /* See Note #2.                                         */
+                    ix = CPU_CntTrailZeros32(map & ~(CPU_INT32U)1u);
+                } else {
+                    ix = OS_TICK_WHEEL_SLOT_NBR;
+                }
+            } else {
+                ix = CPU_CntTrailZeros32(map);
+            }
+            step = ((((tick_next >> shift) + (OS_TICK)ix) << shift) - tick);
+            if ((ticks == 0u) || (step < ticks)) {
+                ticks = step;
+            }
+        }
+        shift += OS_TICK_WHEEL_SLOT_BITS;
+    }
+
+    return (ticks);
+}
+#endif
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+/*
+************************************************************************************************************************
+*                                      INSERT A TASK IN THE MICROSECOND LIST
+*
+* Description: This function is called to place a task in the list of microsecond delays and timeouts.  The list is
+*              sorted by the value of the microsecond timer at which each entry expires, earliest first, and the timer
+*              compare is set to the head of the list.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task to insert.
+*              -----
+*
+*              us             is the delay, in microseconds.  It is limited to OS_TICK_US_MAX (see Note #3).
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) The 32-bit microsecond timer wraps after about 71 minutes.  Entries are compared by the signed
+*                 difference of their match values, which is correct as long as no entry is more than half of the
+*                 timer's range away.
+*
+*              4) The task links through TickNextPtr/TickPrevPtr : a task is never in both lists at once.
+************************************************************************************************************************
+*/
+
+void  OS_TickUsListInsert (OS_TCB      *p_tcb,
+                           CPU_INT32U   us)
+{
+    OS_TCB      *p_tcb1;
+    OS_TCB      *p_tcb2;
+    CPU_INT32U   match;
+
+
+    if (us > OS_TICK_US_MAX) {                                  /* See Note #3                                          */
+        us = OS_TICK_US_MAX;
+    }
+    match          = OS_UsTmrGet() + us;
+    p_tcb->UsMatch = match;
+    p_tcb->UsDly   = OS_TRUE;
+
+    p_tcb1 = (OS_TCB *)0;
+    p_tcb2 = OSTickUsListPtr;
+    while (p_tcb2 != (OS_TCB *)0) {                             /* Insert after the entries expiring at or before match */
+        if ((CPU_INT32S)(p_tcb2->UsMatch - match) > 0) {
+            break;
+        }
+        p_tcb1 = p_tcb2;
+        p_tcb2 = p_tcb2->TickNextPtr;
+    }
+
+    p_tcb->TickPrevPtr = p_tcb1;                                /* See Note #4                                          */
+    p_tcb->TickNextPtr = p_tcb2;
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr = p_tcb;
+    }
+    if (p_tcb1 != (OS_TCB *)0) {
+        p_tcb1->TickNextPtr = p_tcb;
+    } else {
+        OSTickUsListPtr     = p_tcb;                            /* New head, move the compare to it                     */
+        OS_UsTmrSet(match);
+    }
+}
+
+/*
+************************************************************************************************************************
+*                                     REMOVE A TASK FROM THE MICROSECOND LIST
+*
+* Description: This function is called to remove a task from the list of microsecond delays and timeouts.
+*
+* Arguments  : p_tcb          Is a pointer to the OS_TCB to remove.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_TickUsListRemove (OS_TCB  *p_tcb)
+{
+    OS_TCB  *p_tcb1;
+    OS_TCB  *p_tcb2;
+
+
+    p_tcb1 = p_tcb->TickPrevPtr;
+    p_tcb2 = p_tcb->TickNextPtr;
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr = p_tcb1;
+    }
+    if (p_tcb1 != (OS_TCB *)0) {
+        p_tcb1->TickNextPtr = p_tcb2;
+    } else {
+        OSTickUsListPtr     = p_tcb2;                           /* Removing the head, move the compare to the next one  */
+        if (p_tcb2 != (OS_TCB *)0) {
+            OS_UsTmrSet(p_tcb2->UsMatch);
+        } else {
+            OS_UsTmrStop();
+        }
+    }
+    p_tcb->TickPrevPtr = (OS_TCB *)0;
+    p_tcb->TickNextPtr = (OS_TCB *)0;
+    p_tcb->UsDly       = OS_FALSE;
+}
+
+/*
+************************************************************************************************************************
+*                                            MICROSECOND TIMER UPDATE
+*
+* Description: This function expires the microsecond delays and timeouts which are due and sets the timer compare to
+*              the next one.  The function is internal to uC/OS-III.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) OS_UsTmrSet() raises the interrupt if the counter has already passed the match, so an entry falling
+*                 due while the list is processed is not lost.
+************************************************************************************************************************
+*/
+
+void  OS_TickUsUpdate (void)
+{
+    OS_TCB      *p_tcb;
+    CPU_INT32U   now;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    now   = OS_UsTmrGet();
+    p_tcb = OSTickUsListPtr;
+    while (p_tcb != (OS_TCB *)0) {
+        if ((CPU_INT32S)(now - p_tcb->UsMatch) < 0) {           /* Is the earliest entry still in the future?           */
+            break;
+        }
+        OSTickUsListPtr = p_tcb->TickNextPtr;
+        if (OSTickUsListPtr != (OS_TCB *)0) {
+            OSTickUsListPtr->TickPrevPtr = (OS_TCB *)0;
+        }
+        p_tcb->TickNextPtr = (OS_TCB *)0;
+        p_tcb->UsDly       = OS_FALSE;
+        OS_TickListExpire(p_tcb);                               /* Ready the task, as the tick list would               */
+        p_tcb = OSTickUsListPtr;
+    }
+
+    if (p_tcb != (OS_TCB *)0) {                                 /* See Note #2                                          */
+        OS_UsTmrSet(p_tcb->UsMatch);
+    } else {
+        OS_UsTmrStop();
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+#endif                                                                   /* #if OS_CFG_TICK_EN                                   */
+
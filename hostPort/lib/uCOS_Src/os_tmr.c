@@ -0,0 +1,2729 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           TIMER MANAGEMENT
+*
+* File    : os_tmr.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_tmr__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_TMR_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                     LOCAL MACROS
+*
+* Note(s) : 1) The delays, periods & slacks of a hard timer are in ticks, the ones of the other timers are in timer task
+*              ticks (see OSTmrCreate()).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_HARD_EN > 0u)
+#define  OS_TMR_IS_HARD(p_tmr)          (((p_tmr) != (OS_TMR *)0) && ((((p_tmr)->Opt) & OS_OPT_TMR_HARD) != 0u))
+#define  OS_TMR_TO_TICKS_MULT(opt)      ((((opt) & OS_OPT_TMR_HARD) != 0u) ? 1u : OSTmrToTicksMult)
+#else
+#define  OS_TMR_IS_HARD(p_tmr)          (OS_FALSE)
+#define  OS_TMR_TO_TICKS_MULT(opt)      (OSTmrToTicksMult)
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrLock      (void);
+static  void  OS_TmrUnlock    (void);
+
+static  void  OS_TmrCondCreate(void);
+static  void  OS_TmrCondSignal(void);
+static  void  OS_TmrCondWait  (OS_TICK  timeout);
+
+static  void     OS_TmrWheelFile    (OS_TMR   *p_tmr,
+                                     OS_TICK   tick_next);
+static  void     OS_TmrWheelCascade (OS_TICK   tick);
+static  OS_TICK  OS_TmrWheelNext    (OS_TICK   tick);
+
+#if (OS_CFG_TMR_HARD_EN > 0u)
+static  CPU_BOOLEAN  OS_TmrHardStart (OS_TMR  *p_tmr,
+                                      OS_ERR  *p_err);
+static  CPU_BOOLEAN  OS_TmrHardStop  (OS_TMR  *p_tmr,
+                                      OS_OPT   opt,
+                                      void    *p_callback_arg,
+                                      OS_ERR  *p_err);
+#endif
+
+#if (OS_CFG_TMR_LANE_EN > 0u)
+static  void  OS_TmrLanePost   (OS_TMR  *p_tmr);
+static  void  OS_TmrLaneRemove (OS_TMR  *p_tmr);
+static  void  OS_TmrLaneTask   (void    *p_arg);
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   CREATE A TIMER
+*
+* Description: This function is called by your application code to create a timer.
+*
+* Arguments  : p_tmr           Is a pointer to a timer control block
+*
+*              p_name          Is a pointer to an ASCII string that is used to name the timer.  Names are useful for
+*                              debugging.
+*
+*              dly             Initial delay.
+*                              If the timer is configured for ONE-SHOT mode, this is the timeout used
+*                              If the timer is configured for PERIODIC mode, this is the first timeout to wait for
+*                              before the timer starts entering periodic mode
+*
+*              period          The 'period' being repeated for the timer.
+*                              If you specified 'OS_OPT_TMR_PERIODIC' as an option, when the timer expires, it will
+*                              automatically restart with the same period.
+*
+*              opt             Specifies either:
+*
+*                                  OS_OPT_TMR_ONE_SHOT       The timer counts down only once
+*                                  OS_OPT_TMR_PERIODIC       The timer counts down and then reloads itself
+*
+*                              optionally OR'ed with:
+*
+*                                  OS_OPT_TMR_HARD           The callback runs from the tick ISR (see Note #2)
+*
+*              p_callback      Is a pointer to a callback function that will be called when the timer expires.  The
+*                              callback function must be declared as follows:
+*
+*                                  void  MyCallback (OS_TMR *p_tmr, void *p_arg);
+*
+*              p_callback_arg  Is an argument (a pointer) that is passed to the callback function when it is called.
+*
+*              p_err           Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The call succeeded
+*                                 OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the timer after you called
+*                                                                  OSSafetyCriticalStart()
+*                                 OS_ERR_OBJ_PTR_NULL            Is 'p_tmr' is a NULL pointer
+*                                 OS_ERR_OPT_INVALID             You specified an invalid option
+*                                 OS_ERR_TMR_INVALID_CALLBACK    You specified an invalid callback for a periodic timer
+*                                 OS_ERR_TMR_INVALID_DLY         You specified an invalid delay
+*                                 OS_ERR_TMR_INVALID_PERIOD      You specified an invalid period
+*                                 OS_ERR_TMR_ISR                 If the call was made from an ISR
+*                                 OS_ERR_OBJ_CREATED             If the timer was already created
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function only creates the timer.  In other words, the timer is not started when created.  To
+*                 start the timer, call OSTmrStart().
+*
+*              2) The callback of a hard timer (OS_CFG_TMR_HARD_EN) runs from the tick ISR, with interrupts enabled, on
+*                 the tick the timer expires.  It may only call the services allowed from an ISR.  The delay & the
+*                 period of a hard timer are in ticks & OSTmrStart()/OSTmrStop() may be called from an ISR for it.
+*
+*              3) The callback runs in the timer task unless the timer is given a lane (see OSTmrLaneSet()).
+************************************************************************************************************************
+*/
+
+void  OSTmrCreate (OS_TMR               *p_tmr,
+                   CPU_CHAR             *p_name,
+                   OS_TICK               dly,
+                   OS_TICK               period,
+                   OS_OPT                opt,
+                   OS_TMR_CALLBACK_PTR   p_callback,
+                   void                 *p_callback_arg,
+                   OS_ERR               *p_err)
+{
+    OS_TICK  mult;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {                                 /* Validate 'p_tmr'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+
+    switch (OS_OPT_TMR_MODE(opt)) {
+        case OS_OPT_TMR_PERIODIC:
+             if (period == 0u) {
+                *p_err = OS_ERR_TMR_INVALID_PERIOD;
+                 return;
+             }
+
+             if (p_callback == (OS_TMR_CALLBACK_PTR)0) {        /* No point in a periodic timer without a callback      */
+                *p_err = OS_ERR_TMR_INVALID_CALLBACK;
+                 return;
+             }
+             break;
+
+        case OS_OPT_TMR_ONE_SHOT:
+             if (dly == 0u) {
+                *p_err = OS_ERR_TMR_INVALID_DLY;
+                 return;
+             }
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Only lock when the kernel is running                 */
+        OS_TmrLock();
+    }
+
+    p_tmr->State          = OS_TMR_STATE_STOPPED;               /* Initialize the timer fields                          */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    if (p_tmr->Type == OS_OBJ_TYPE_TMR) {
+        if (OSRunning == OS_STATE_OS_RUNNING) {
+            OS_TmrUnlock();
+        }
+        *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+    p_tmr->Type           = OS_OBJ_TYPE_TMR;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_tmr->NamePtr        = p_name;
+#else
+    (void)p_name;
+#endif
+    mult                  =  OS_TMR_TO_TICKS_MULT(opt);
+    p_tmr->Dly            =  dly    * mult;                     /* Convert to Timer Start Delay to ticks                */
+    p_tmr->Remain         =  0u;
+    p_tmr->Match          =  0u;
+    p_tmr->Slot           =  0u;
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    p_tmr->Slack          =  0u;
+#endif
+    p_tmr->Period         =  period * mult;                     /* Convert to Timer Period      to ticks                */
+    p_tmr->Opt            =  opt;
+    p_tmr->CallbackPtr    =  p_callback;
+    p_tmr->CallbackPtrArg =  p_callback_arg;
+    p_tmr->NextPtr        = (OS_TMR *)0;
+    p_tmr->PrevPtr        = (OS_TMR *)0;
+#if (OS_CFG_TMR_LANE_EN > 0u)
+    p_tmr->LanePtr        = (OS_TMR_LANE *)0;
+    p_tmr->LaneNextPtr    = (OS_TMR      *)0;
+    p_tmr->LanePend       =  OS_FALSE;
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_TmrDbgListAdd(p_tmr);
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    OSTmrQty++;                                                 /* Keep track of the number of timers created           */
+#endif
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OS_TmrUnlock();
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   DELETE A TIMER
+*
+* Description: This function is called by your application code to delete a timer.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to stop and delete.
+*
+*              p_err          Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The call succeeded
+*                                 OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the timer after you called
+*                                                                  OSStart()
+*                                 OS_ERR_OBJ_TYPE                If 'p_tmr' is not pointing to a timer
+*                                 OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                 OS_ERR_TMR_INACTIVE            If the timer was not created
+*                                 OS_ERR_TMR_INVALID             If 'p_tmr' is a NULL pointer
+*                                 OS_ERR_TMR_INVALID_STATE       The timer is in an invalid state
+*                                 OS_ERR_TMR_ISR                 If the function was called from an ISR
+*
+* Returns    : OS_TRUE   if the timer was deleted
+*              OS_FALSE  if not or upon an error
+*
+* Note(s)    : 1) A callback of the timer waiting in its lane (see OSTmrLaneSet()) is dropped.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_DEL_EN > 0u)
+CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
+                       OS_ERR  *p_err)
+{
+    CPU_BOOLEAN  success;
+#if (OS_CFG_TMR_HARD_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err  = OS_ERR_TMR_ISR;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (OS_FALSE);
+    }
+#endif
+
+    OS_TmrLock();
+
+#if (OS_CFG_TMR_HARD_EN > 0u)
+    if (OS_TMR_IS_HARD(p_tmr)) {                                /* Take a hard timer away from the tick ISR first       */
+        CPU_CRITICAL_ENTER();
+        if (p_tmr->State == OS_TMR_STATE_RUNNING) {
+            OS_TmrHardUnlink(p_tmr);
+            p_tmr->State = OS_TMR_STATE_STOPPED;
+        }
+        CPU_CRITICAL_EXIT();
+    }
+#endif
+
+#if (OS_CFG_TMR_LANE_EN > 0u)
+    OS_TmrLaneRemove(p_tmr);                                    /* Drop a callback still waiting in the lane            */
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_TmrDbgListRemove(p_tmr);
+#endif
+
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:
+        case OS_TMR_STATE_TIMEOUT:
+             OS_TmrUnlink(p_tmr);                               /* Remove from the wheel                                */
+             OS_TmrClr(p_tmr);
+#if (OS_CFG_DBG_EN > 0u)
+             OSTmrQty--;                                        /* One less timer                                       */
+#endif
+            *p_err   = OS_ERR_NONE;
+             success = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_STOPPED:                              /* Timer has not started or ...                         */
+        case OS_TMR_STATE_COMPLETED:                            /* ... timer has completed the ONE-SHOT time            */
+             OS_TmrClr(p_tmr);                                  /* Clear timer fields                                   */
+#if (OS_CFG_DBG_EN > 0u)
+             OSTmrQty--;                                        /* One less timer                                       */
+#endif
+            *p_err   = OS_ERR_NONE;
+             success = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:                               /* Already deleted                                      */
+            *p_err   = OS_ERR_TMR_INACTIVE;
+             success = OS_FALSE;
+             break;
+
+        default:
+            *p_err   = OS_ERR_TMR_INVALID_STATE;
+             success = OS_FALSE;
+             break;
+    }
+
+    OS_TmrUnlock();
+
+    return (success);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             CREATE A TIMER CALLBACK LANE
+*
+* Description: This function is called by your application code to create a lane: a task which runs the callbacks of
+*              the timers assigned to it (see OSTmrLaneSet()) instead of the timer task.
+*
+* Arguments  : p_lane         Is a pointer to the lane to create.
+*
+*              p_name         Is a name to give the lane & its task.
+*
+*              prio           Is the priority of the task of the lane.
+*
+*              p_stk_base     Is a pointer to the base of the stack of the task of the lane.
+*
+*              stk_size       Is the size of the stack in number of elements.
+*
+*              p_err          Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The call succeeded
+*                                 OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the lane after you called
+*                                                                  OSSafetyCriticalStart()
+*                                 OS_ERR_OBJ_PTR_NULL            Is 'p_lane' is a NULL pointer
+*                                 OS_ERR_TMR_ISR                 If the call was made from an ISR
+*                                 OS_ERR_TMR_PRIO_INVALID        If 'prio' is the priority of the idle task or beyond
+*                                 OS_ERR_TMR_STK_INVALID         If 'p_stk_base' is a NULL pointer
+*                                 OS_ERR_TMR_STK_SIZE_INVALID    If 'stk_size' is smaller than OSCfg_StkSizeMin
+*                                 Any error returned by OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) The timer task only queues the callbacks of the timers of a lane, in order of expiry, & moves on.  A
+*                 slow callback thus only delays the callbacks of its own lane, & a lane with a higher priority than
+*                 the timer task runs its callbacks as soon as the timer task has processed the tick.
+*
+*              2) The callbacks of a lane run WITHOUT the timer mutex held, so they are free to block.
+*
+*              3) The lane measures the latency from the expiry of a timer to its callback ('Latency', 'LatencyMax' &
+*                 'LatencySum' over 'DispatchCtr' callbacks) when OS_CFG_TS_EN is enabled.  'OverrunCtr' counts the
+*                 expiries lost because the previous callback of the same timer was still waiting.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_LANE_EN > 0u)
+void  OSTmrLaneCreate (OS_TMR_LANE   *p_lane,
+                       CPU_CHAR      *p_name,
+                       OS_PRIO        prio,
+                       CPU_STK       *p_stk_base,
+                       CPU_STK_SIZE   stk_size,
+                       OS_ERR        *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lane == (OS_TMR_LANE *)0) {                           /* Validate 'p_lane'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+
+    if (p_stk_base == (CPU_STK *)0) {
+       *p_err = OS_ERR_TMR_STK_INVALID;
+        return;
+    }
+
+    if (stk_size < OSCfg_StkSizeMin) {
+       *p_err = OS_ERR_TMR_STK_SIZE_INVALID;
+        return;
+    }
+
+    if (prio >= (OS_CFG_PRIO_MAX - 1u)) {
+       *p_err = OS_ERR_TMR_PRIO_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_lane->Type        = OS_OBJ_TYPE_TMR_LANE;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_lane->NamePtr     = p_name;
+#endif
+    p_lane->HeadPtr     = (OS_TMR *)0;
+    p_lane->TailPtr     = (OS_TMR *)0;
+    p_lane->DispatchCtr = 0u;
+    p_lane->OverrunCtr  = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    p_lane->Latency     = 0u;
+    p_lane->LatencyMax  = 0u;
+    p_lane->LatencySum  = 0u;
+#endif
+
+    OSTaskCreate(&p_lane->Task,
+                  p_name,
+                  OS_TmrLaneTask,
+                 (void *)p_lane,
+                  prio,
+                  p_stk_base,
+                  stk_size / 10u,
+                  stk_size,
+                  0u,
+                  0u,
+                 (void *)0,
+                 (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
+                  p_err);
+#if (OS_OBJ_TYPE_REQ > 0u)
+    if (*p_err != OS_ERR_NONE) {
+        p_lane->Type    = OS_OBJ_TYPE_NONE;
+    }
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                           ASSIGN A TIMER TO A CALLBACK LANE
+*
+* Description: This function is called by your application code to choose the task which runs the callback of a timer.
+*
+* Arguments  : p_tmr          Is a pointer to the timer.
+*
+*              p_lane         Is a pointer to the lane which will run the callback (see OSTmrLaneCreate()), or a NULL
+*                             pointer for the timer task.
+*
+*              p_err          Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The call succeeded
+*                                 OS_ERR_OBJ_TYPE                If 'p_tmr' is not pointing to a timer or 'p_lane' to a lane
+*                                 OS_ERR_OPT_INVALID             If 'p_tmr' is a hard timer
+*                                 OS_ERR_TMR_INVALID             If 'p_tmr' is a NULL pointer
+*                                 OS_ERR_TMR_INVALID_STATE       If the timer is running or its callback is waiting
+*                                 OS_ERR_TMR_ISR                 If the call was made from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) Hard timers run their callbacks from the tick ISR & have no lane.
+************************************************************************************************************************
+*/
+
+void  OSTmrLaneSet (OS_TMR       *p_tmr,
+                    OS_TMR_LANE  *p_lane,
+                    OS_ERR       *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {                                 /* Validate 'p_tmr'                                     */
+       *p_err = OS_ERR_TMR_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+
+    if ((p_lane       != (OS_TMR_LANE *)0) &&                   /* Make sure the lane was created                       */
+        (p_lane->Type != OS_OBJ_TYPE_TMR_LANE)) {
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (OS_TMR_IS_HARD(p_tmr)) {                                /* See Note #1.                                         */
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Only lock when the kernel is running                 */
+        OS_TmrLock();
+    }
+
+    if ((p_tmr->State    == OS_TMR_STATE_RUNNING) ||
+        (p_tmr->LanePend == OS_TRUE)) {
+       *p_err          = OS_ERR_TMR_INVALID_STATE;
+    } else {
+        p_tmr->LanePtr = p_lane;
+       *p_err          = OS_ERR_NONE;
+    }
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OS_TmrUnlock();
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                    GET HOW MUCH TIME IS LEFT BEFORE A TIMER EXPIRES
+*
+* Description: This function is called to get the number of timer increments before a timer times out.
+*
+* Arguments  : p_tmr    Is a pointer to the timer to obtain the remaining time from.
+*
+*              p_err    Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                           OS_ERR_NONE               The call succeeded
+*                           OS_ERR_OBJ_TYPE           If 'p_tmr' is not pointing to a timer
+*                           OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                           OS_ERR_TMR_INACTIVE       If 'p_tmr' points to a timer that is not active
+*                           OS_ERR_TMR_INVALID        If 'p_tmr' is a NULL pointer
+*                           OS_ERR_TMR_INVALID_STATE  The timer is in an invalid state
+*                           OS_ERR_TMR_ISR            If the call was made from an ISR
+*
+* Returns    : The time remaining for the timer to expire.  The time represents 'timer' increments (typically 1/10 sec),
+*              ticks for a hard timer.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
+                         OS_ERR  *p_err)
+{
+    OS_TICK   remain;
+    OS_TICK   elapsed;
+    OS_TICK   time;
+    OS_TICK   mult;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    OS_TmrLock();
+
+    mult = OS_TMR_TO_TICKS_MULT(p_tmr->Opt);
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:
+             CPU_CRITICAL_ENTER();
+             if (OSTCBCurPtr == &OSTmrTaskTCB) {                /* Callbacks operate on the Tmr Task's tick base.       */
+                 time = OSTmrTaskTickBase;
+             } else {
+#if (OS_CFG_DYN_TICK_EN > 0u)
+                 time = OSTickCtr + OS_DynTickGet();
+#else
+                 time = OSTickCtr;
+#endif
+             }
+             CPU_CRITICAL_EXIT();
+             elapsed = time - (p_tmr->Match - p_tmr->Remain);   /* Time since the timer was started                     */
+             if (elapsed < p_tmr->Remain) {
+                 remain = (p_tmr->Remain - elapsed) / mult;
+             } else {
+                 remain = 0u;                                   /* Expired, the timer task has not processed it yet     */
+             }
+            *p_err   = OS_ERR_NONE;
+             break;
+
+        case OS_TMR_STATE_STOPPED:                              /* It's assumed that the timer has not started yet      */
+             if (OS_OPT_TMR_MODE(p_tmr->Opt) == OS_OPT_TMR_PERIODIC) {
+                 if (p_tmr->Dly == 0u) {
+                     remain = p_tmr->Period / mult;
+                 } else {
+                     remain = p_tmr->Dly / mult;
+                 }
+             } else {
+                 remain = p_tmr->Dly / mult;
+             }
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_TMR_STATE_TIMEOUT:                              /* Within a callback, timers are in the TIMEOUT state   */
+        case OS_TMR_STATE_COMPLETED:                            /* Only ONE-SHOT timers can be in the COMPLETED state   */
+            *p_err  = OS_ERR_NONE;
+             remain = 0u;
+             break;
+
+        case OS_TMR_STATE_UNUSED:
+            *p_err  = OS_ERR_TMR_INACTIVE;
+             remain = 0u;
+             break;
+
+        default:
+            *p_err = OS_ERR_TMR_INVALID_STATE;
+             remain = 0u;
+             break;
+    }
+
+    OS_TmrUnlock();
+
+    return (remain);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    SET A TIMER
+*
+* Description: This function is called by your application code to set a timer.
+*
+* Arguments  : p_tmr           Is a pointer to a timer control block
+*
+*              dly             Initial delay.
+*                              If the timer is configured for ONE-SHOT mode, this is the timeout used
+*                              If the timer is configured for PERIODIC mode, this is the first timeout to wait for
+*                              before the timer starts entering periodic mode
+*
+*              period          The 'period' being repeated for the timer.
+*                              If you specified 'OS_OPT_TMR_PERIODIC' as an option, when the timer expires, it will
+*                              automatically restart with the same period.
+*
+*              p_callback      Is a pointer to a callback function that will be called when the timer expires.  The
+*                              callback function must be declared as follows:
+*
+*                                  void  MyCallback (OS_TMR *p_tmr, void *p_arg);
+*
+*              p_callback_arg  Is an argument (a pointer) that is passed to the callback function when it is called.
+*
+*              p_err           Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The timer was configured as expected
+*                                 OS_ERR_OBJ_TYPE                If the object type is invalid
+*                                 OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                 OS_ERR_TMR_INVALID             If 'p_tmr' is a NULL pointer or invalid option
+*                                 OS_ERR_TMR_INVALID_CALLBACK    you specified an invalid callback for a periodic timer
+*                                 OS_ERR_TMR_INVALID_DLY         You specified an invalid delay
+*                                 OS_ERR_TMR_INVALID_PERIOD      You specified an invalid period
+*                                 OS_ERR_TMR_ISR                 If the call was made from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function can be called on a running timer. The change to the delay and period will only
+*                 take effect after the current period or delay has passed. Change to the callback will take
+*                 effect immediately.
+*
+*              2) The callback of a hard timer is called from the tick ISR, so the callback & its argument are changed
+*                 together, with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OSTmrSet (OS_TMR               *p_tmr,
+                OS_TICK               dly,
+                OS_TICK               period,
+                OS_TMR_CALLBACK_PTR   p_callback,
+                void                 *p_callback_arg,
+                OS_ERR               *p_err)
+{
+    OS_TICK  mult;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {                                 /* Validate 'p_tmr'                                     */
+       *p_err = OS_ERR_TMR_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    switch (OS_OPT_TMR_MODE(p_tmr->Opt)) {
+        case OS_OPT_TMR_PERIODIC:
+             if (period == 0u) {
+                *p_err = OS_ERR_TMR_INVALID_PERIOD;
+                 return;
+             }
+
+             if (p_callback == (OS_TMR_CALLBACK_PTR)0) {        /* No point in a periodic timer without a callback      */
+                *p_err = OS_ERR_TMR_INVALID_CALLBACK;
+                 return;
+             }
+             break;
+
+        case OS_OPT_TMR_ONE_SHOT:
+             if (dly == 0u) {
+                *p_err = OS_ERR_TMR_INVALID_DLY;
+                 return;
+             }
+             break;
+
+        default:
+            *p_err = OS_ERR_TMR_INVALID;
+             return;
+    }
+#endif
+
+    OS_TmrLock();
+
+    mult                  = OS_TMR_TO_TICKS_MULT(p_tmr->Opt);
+    CPU_CRITICAL_ENTER();                                          /* A hard timer may expire meanwhile (See Note #2)   */
+    p_tmr->Dly            = dly    * mult;                         /* Convert Timer Delay  to ticks                     */
+    p_tmr->Period         = period * mult;                         /* Convert Timer Period to ticks                     */
+    p_tmr->CallbackPtr    = p_callback;
+    p_tmr->CallbackPtrArg = p_callback_arg;
+    CPU_CRITICAL_EXIT();
+
+   *p_err                 = OS_ERR_NONE;
+
+    OS_TmrUnlock();
+}
+
+
+/*
+************************************************************************************************************************
+*                                              SET THE SLACK OF A TIMER
+*
+* Description: This function is called by your application code to allow a timer to expire late by up to 'slack'.  The
+*              timer task uses the slack to make several timers expire on the same tick & runs less often.
+*
+* Arguments  : p_tmr           Is a pointer to a timer control block
+*
+*              slack           Is the time, in timer units (see OSTmrCreate()), by which each expiry of the timer may be
+*                              extended.  0 for exact expiries.
+*
+*              p_err           Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The slack was set
+*                                 OS_ERR_OBJ_TYPE                If the object type is invalid
+*                                 OS_ERR_TMR_INVALID             If 'p_tmr' is a NULL pointer
+*                                 OS_ERR_TMR_ISR                 If the call was made from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function can be called before OSStart(), right after OSTmrCreate().
+*
+*              2) The slack applies from the next time the timer is started or, for a PERIODIC timer, reloaded.
+*
+*              3) Hard timers expire on time, their slack is not used.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+void  OSTmrSlackSet (OS_TMR   *p_tmr,
+                     OS_TICK   slack,
+                     OS_ERR   *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {                                 /* Validate 'p_tmr'                                     */
+       *p_err = OS_ERR_TMR_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Only lock when the kernel is running (See Note #1)   */
+        OS_TmrLock();
+    }
+
+    p_tmr->Slack = slack * OSTmrToTicksMult;                    /* Convert Timer Slack to ticks (See Note #2)           */
+
+   *p_err        = OS_ERR_NONE;
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OS_TmrUnlock();
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   START A TIMER
+*
+* Description: This function is called by your application code to start a timer.
+*
+* Arguments  : p_tmr    Is a pointer to an OS_TMR
+*
+*              p_err    Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                           OS_ERR_NONE                The timer was started
+*                           OS_ERR_OBJ_TYPE            If 'p_tmr' is not pointing to a timer
+*                           OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                           OS_ERR_TMR_INACTIVE        If the timer was not created
+*                           OS_ERR_TMR_INVALID         If 'p_tmr' is a NULL pointer
+*                           OS_ERR_TMR_INVALID_STATE   The timer is in an invalid state
+*                           OS_ERR_TMR_ISR             If the call was made from an ISR
+*
+* Returns    : OS_TRUE   is the timer was started
+*              OS_FALSE  if not or upon an error
+*
+* Note(s)    : 1) When starting/restarting a timer, regardless if it is in PERIODIC or ONE-SHOT mode, the timer is
+*                 linked to the timer list with the OS_OPT_LINK_DLY option. This option sets the initial expiration
+*                 time for the timer. For timers in PERIODIC mode, subsequent expiration times are handled by
+*                 the OS_TmrTask().
+*
+*              2) A hard timer (OS_OPT_TMR_HARD) is linked to the hard timer list instead & may be started from an
+*                 ISR.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
+                         OS_ERR  *p_err)
+{
+    CPU_BOOLEAN  success;
+    OS_TICK      time;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if ((OSIntNestingCtr > 0u) &&                               /* See if trying to call from an ISR ...                */
+        (OS_TMR_IS_HARD(p_tmr) == OS_FALSE)) {                  /* ... which is allowed for hard timers (See Note #2)   */
+       *p_err = OS_ERR_TMR_ISR;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_TMR_HARD_EN > 0u)
+    if (OS_TMR_IS_HARD(p_tmr)) {                                /* Hard timers are shared with the tick ISR             */
+        return (OS_TmrHardStart(p_tmr, p_err));
+    }
+#endif
+
+    OS_TmrLock();
+
+    CPU_CRITICAL_ENTER();
+    if (OSTCBCurPtr == &OSTmrTaskTCB) {                         /* Callbacks operate on the Tmr Task's tick base.       */
+        time = OSTmrTaskTickBase;
+    } else {
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        time = OSTickCtr + OS_DynTickGet();
+#else
+        time = OSTickCtr;
+#endif
+    }
+    CPU_CRITICAL_EXIT();
+
+
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:                              /* Restart the timer                                    */
+        case OS_TMR_STATE_TIMEOUT:
+             p_tmr->State = OS_TMR_STATE_RUNNING;
+             OS_TmrUnlink(p_tmr);                               /* Remove from current slot of the wheel                */
+             if (p_tmr->Dly == 0u) {
+                 p_tmr->Remain = p_tmr->Period;
+             } else {
+                 p_tmr->Remain = p_tmr->Dly;
+             }
+             OS_TmrLink(p_tmr, time);                           /* Add timer to the wheel                               */
+            *p_err   = OS_ERR_NONE;
+             success = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_STOPPED:                              /* Start the timer                                      */
+        case OS_TMR_STATE_COMPLETED:
+             p_tmr->State = OS_TMR_STATE_RUNNING;
+             if (p_tmr->Dly == 0u) {
+                 p_tmr->Remain = p_tmr->Period;
+             } else {
+                 p_tmr->Remain = p_tmr->Dly;
+             }
+             OS_TmrLink(p_tmr, time);                           /* Add timer to the wheel                               */
+            *p_err   = OS_ERR_NONE;
+             success = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:                               /* Timer not created                                    */
+            *p_err   = OS_ERR_TMR_INACTIVE;
+             success = OS_FALSE;
+             break;
+
+        default:
+            *p_err   = OS_ERR_TMR_INVALID_STATE;
+             success = OS_FALSE;
+             break;
+    }
+
+    OS_TmrUnlock();
+
+    return (success);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           FIND OUT WHAT STATE A TIMER IS IN
+*
+* Description: This function is called to determine what state the timer is in:
+*
+*                  OS_TMR_STATE_UNUSED     the timer has not been created
+*                  OS_TMR_STATE_STOPPED    the timer has been created but has not been started or has been stopped
+*                  OS_TMR_STATE_COMPLETED  the timer is in ONE-SHOT mode and has completed it's timeout
+*                  OS_TMR_SATE_RUNNING     the timer is currently running
+*
+* Arguments  : p_tmr    Is a pointer to the desired timer
+*
+*              p_err    Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                           OS_ERR_NONE               The return value reflects the state of the timer
+*                           OS_ERR_OBJ_TYPE           If 'p_tmr' is not pointing to a timer
+*                           OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                           OS_ERR_TMR_INVALID        If 'p_tmr' is a NULL pointer
+*                           OS_ERR_TMR_INVALID_STATE  If the timer is not in a valid state
+*                           OS_ERR_TMR_ISR            If the call was made from an ISR
+*
+* Returns    : The current state of the timer (see description).
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+OS_STATE  OSTmrStateGet (OS_TMR  *p_tmr,
+                         OS_ERR  *p_err)
+{
+    OS_STATE  state;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_TMR_STATE_UNUSED);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return (OS_TMR_STATE_UNUSED);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (OS_TMR_STATE_UNUSED);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return (OS_TMR_STATE_UNUSED);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (OS_TMR_STATE_UNUSED);
+    }
+#endif
+
+    OS_TmrLock();
+
+    state = p_tmr->State;
+    switch (state) {
+        case OS_TMR_STATE_UNUSED:
+        case OS_TMR_STATE_STOPPED:
+        case OS_TMR_STATE_COMPLETED:
+        case OS_TMR_STATE_RUNNING:
+        case OS_TMR_STATE_TIMEOUT:
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+            *p_err = OS_ERR_TMR_INVALID_STATE;
+             break;
+    }
+
+    OS_TmrUnlock();
+
+    return (state);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    STOP A TIMER
+*
+* Description: This function is called by your application code to stop a timer.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to stop.
+*
+*              opt            Allows you to specify an option to this functions which can be:
+*
+*                               OS_OPT_TMR_NONE            Do nothing special but stop the timer
+*                               OS_OPT_TMR_CALLBACK        Execute the callback function, pass it the callback argument
+*                                                          specified when the timer was created.
+*                               OS_OPT_TMR_CALLBACK_ARG    Execute the callback function, pass it the callback argument
+*                                                          specified in THIS function call
+*
+*              callback_arg   Is a pointer to a 'new' callback argument that can be passed to the callback function
+*                               instead of the timer's callback argument.  In other words, use 'callback_arg' passed in
+*                               THIS function INSTEAD of p_tmr->OSTmrCallbackArg
+*
+*              p_err          Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                               OS_ERR_NONE                The timer has stopped
+*                               OS_ERR_OBJ_TYPE            If 'p_tmr' is not pointing to a timer
+*                               OS_ERR_OPT_INVALID         If you specified an invalid option for 'opt'
+*                               OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                               OS_ERR_TMR_INACTIVE        If the timer was not created
+*                               OS_ERR_TMR_INVALID         If 'p_tmr' is a NULL pointer
+*                               OS_ERR_TMR_INVALID_STATE   The timer is in an invalid state
+*                               OS_ERR_TMR_ISR             If the function was called from an ISR
+*                               OS_ERR_TMR_NO_CALLBACK     If the timer does not have a callback function defined
+*                               OS_ERR_TMR_STOPPED         If the timer was already stopped
+*
+* Returns    : OS_TRUE   If we stopped the timer (if the timer is already stopped, we also return OS_TRUE)
+*              OS_FALSE  If not
+*
+* Note(s)    : 1) The callback of a hard timer (OS_OPT_TMR_HARD) runs with interrupts enabled, as it would from the tick
+*                 ISR.
+*
+*              2) A hard timer may be stopped from an ISR.
+*
+*              3) A callback of the timer waiting in its lane (see OSTmrLaneSet()) is dropped.  The callback requested
+*                 by 'opt' runs in the calling task.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
+                        OS_OPT   opt,
+                        void    *p_callback_arg,
+                        OS_ERR  *p_err)
+{
+    OS_TMR_CALLBACK_PTR  p_fnct;
+    CPU_BOOLEAN          success;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if ((OSIntNestingCtr > 0u) &&                               /* See if trying to call from an ISR ...                */
+        (OS_TMR_IS_HARD(p_tmr) == OS_FALSE)) {                  /* ... which is allowed for hard timers (See Note #2)   */
+       *p_err = OS_ERR_TMR_ISR;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_TMR_HARD_EN > 0u)
+    if (OS_TMR_IS_HARD(p_tmr)) {                                /* Hard timers are shared with the tick ISR             */
+        return (OS_TmrHardStop(p_tmr, opt, p_callback_arg, p_err));
+    }
+#endif
+
+    OS_TmrLock();
+
+#if (OS_CFG_TMR_LANE_EN > 0u)
+    OS_TmrLaneRemove(p_tmr);                                    /* See Note #3.                                         */
+#endif
+
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:
+        case OS_TMR_STATE_TIMEOUT:
+             p_tmr->State = OS_TMR_STATE_STOPPED;               /* Ensure that any callbacks see the stop state         */
+             switch (opt) {
+                 case OS_OPT_TMR_CALLBACK:
+                      OS_TmrUnlink(p_tmr);                      /* Remove from the timer wheel                          */
+                      p_fnct = p_tmr->CallbackPtr;              /* Execute callback function ...                        */
+                      if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {   /* ... if available                                     */
+                        (*p_fnct)(p_tmr, p_tmr->CallbackPtrArg);/* Use callback arg when timer was created              */
+                      } else {
+                         *p_err = OS_ERR_TMR_NO_CALLBACK;
+                      }
+                      break;
+
+                 case OS_OPT_TMR_CALLBACK_ARG:
+                      OS_TmrUnlink(p_tmr);                      /* Remove from the timer wheel                          */
+                      p_fnct = p_tmr->CallbackPtr;              /* Execute callback function if available ...           */
+                      if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {
+                        (*p_fnct)(p_tmr, p_callback_arg);       /* .. using the 'callback_arg' provided in call         */
+                      } else {
+                         *p_err = OS_ERR_TMR_NO_CALLBACK;
+                      }
+                      break;
+
+                 case OS_OPT_TMR_NONE:
+                      OS_TmrUnlink(p_tmr);                      /* Remove from the timer wheel                          */
+                      break;
+
+                 default:
+                      OS_TmrUnlock();
+                     *p_err = OS_ERR_OPT_INVALID;
+                      return (OS_FALSE);
+             }
+            *p_err        = OS_ERR_NONE;
+             success      = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_COMPLETED:                            /* Timer has already completed the ONE-SHOT or          */
+        case OS_TMR_STATE_STOPPED:                              /* ... timer has not started yet.                       */
+             p_tmr->State = OS_TMR_STATE_STOPPED;
+            *p_err        = OS_ERR_TMR_STOPPED;
+             success      = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:                               /* Timer was not created                                */
+            *p_err        = OS_ERR_TMR_INACTIVE;
+             success      = OS_FALSE;
+             break;
+
+        default:
+            *p_err        = OS_ERR_TMR_INVALID_STATE;
+             success      = OS_FALSE;
+             break;
+    }
+
+    OS_TmrUnlock();
+
+    return (success);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 CLEAR TIMER FIELDS
+*
+* Description: This function is called to clear all timer fields.
+*
+* Argument(s): p_tmr    Is a pointer to the timer to clear
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TmrClr (OS_TMR  *p_tmr)
+{
+    p_tmr->State          = OS_TMR_STATE_UNUSED;                /* Clear timer fields                                   */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_tmr->Type           = OS_OBJ_TYPE_NONE;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_tmr->NamePtr        = (CPU_CHAR *)((void *)"?TMR");
+#endif
+    p_tmr->Dly            =                      0u;
+    p_tmr->Remain         =                      0u;
+    p_tmr->Match          =                      0u;
+    p_tmr->Slot           =                      0u;
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    p_tmr->Slack          =                      0u;
+#endif
+    p_tmr->Period         =                      0u;
+    p_tmr->Opt            =                      0u;
+    p_tmr->CallbackPtr    = (OS_TMR_CALLBACK_PTR)0;
+    p_tmr->CallbackPtrArg = (void              *)0;
+    p_tmr->NextPtr        = (OS_TMR            *)0;
+    p_tmr->PrevPtr        = (OS_TMR            *)0;
+#if (OS_CFG_TMR_LANE_EN > 0u)
+    p_tmr->LanePtr        = (OS_TMR_LANE       *)0;
+    p_tmr->LaneNextPtr    = (OS_TMR            *)0;
+    p_tmr->LanePend       =                OS_FALSE;
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                         ADD/REMOVE TIMER TO/FROM DEBUG TABLE
+*
+* Description: These functions are called by uC/OS-III to add or remove a timer to/from a timer debug table.
+*
+* Arguments  : p_tmr     is a pointer to the timer to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_TmrDbgListAdd (OS_TMR  *p_tmr)
+{
+    p_tmr->DbgPrevPtr               = (OS_TMR *)0;
+    if (OSTmrDbgListPtr == (OS_TMR *)0) {
+        p_tmr->DbgNextPtr           = (OS_TMR *)0;
+    } else {
+        p_tmr->DbgNextPtr           =  OSTmrDbgListPtr;
+        OSTmrDbgListPtr->DbgPrevPtr =  p_tmr;
+    }
+    OSTmrDbgListPtr                 =  p_tmr;
+}
+
+
+
+void  OS_TmrDbgListRemove (OS_TMR  *p_tmr)
+{
+    OS_TMR  *p_tmr_next;
+    OS_TMR  *p_tmr_prev;
+
+
+    p_tmr_prev = p_tmr->DbgPrevPtr;
+    p_tmr_next = p_tmr->DbgNextPtr;
+
+    if (p_tmr_prev == (OS_TMR *)0) {
+        OSTmrDbgListPtr = p_tmr_next;
+        if (p_tmr_next != (OS_TMR *)0) {
+            p_tmr_next->DbgPrevPtr = (OS_TMR *)0;
+        }
+        p_tmr->DbgNextPtr = (OS_TMR *)0;
+
+    } else if (p_tmr_next == (OS_TMR *)0) {
+        p_tmr_prev->DbgNextPtr = (OS_TMR *)0;
+        p_tmr->DbgPrevPtr      = (OS_TMR *)0;
+
+    } else {
+        p_tmr_prev->DbgNextPtr =  p_tmr_next;
+        p_tmr_next->DbgPrevPtr =  p_tmr_prev;
+        p_tmr->DbgNextPtr      = (OS_TMR *)0;
+        p_tmr->DbgPrevPtr      = (OS_TMR *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             INITIALIZE THE TIMER MANAGER
+*
+* Description: This function is called by OSInit() to initialize the timer manager module.
+*
+* Argument(s): p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE
+*                           OS_ERR_TMR_STK_INVALID       if you didn't specify a stack for the timer task
+*                           OS_ERR_TMR_STK_SIZE_INVALID  if you didn't allocate enough space for the timer stack
+*                           OS_ERR_PRIO_INVALID          if you specified the same priority as the idle task
+*                           OS_ERR_xxx                   any error code returned by OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TmrInit (OS_ERR  *p_err)
+{
+    CPU_INT16U  i;
+
+
+#if (OS_CFG_DBG_EN > 0u)
+    OSTmrQty             =           0u;                        /* Keep track of the number of timers created           */
+    OSTmrDbgListPtr      = (OS_TMR *)0;
+#endif
+
+    for (i = 0u; i < ((OS_CFG_TMR_WHEEL_LVL_NBR * OS_TICK_WHEEL_SLOT_NBR) + 1u); i++) {
+        OSTmrWheelTbl[i] = (OS_TMR *)0;                         /* Create an empty timer wheel                          */
+    }
+    for (i = 0u; i < OS_CFG_TMR_WHEEL_LVL_NBR; i++) {
+        OSTmrWheelMap[i] = 0u;
+    }
+    OSTmrWheelTick       =           0u;
+#if (OS_CFG_DBG_EN > 0u)
+    OSTmrListEntries     =           0u;
+#endif
+#if (OS_CFG_TMR_HARD_EN > 0u)
+    OSTmrHardListPtr     = (OS_TMR *)0;
+#endif
+                                                                /* Calculate Timer to Ticks multiplier                  */
+    OSTmrToTicksMult = OSCfg_TickRate_Hz / OSCfg_TmrTaskRate_Hz;
+
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    OSTmrMergeCtr        =           0u;
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    OSTmrTaskTime        =           0u;
+    OSTmrTaskTimeMax     =           0u;
+#endif
+
+    OSMutexCreate(&OSTmrMutex,                                  /* Use a mutex to protect the timers                    */
+#if  (OS_CFG_DBG_EN == 0u)
+                  (CPU_CHAR *)0,
+#else
+                  (CPU_CHAR *)"OS Tmr Mutex",
+#endif
+                  p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OS_TmrCondCreate();
+                                                                /* -------------- CREATE THE TIMER TASK --------------- */
+    if (OSCfg_TmrTaskStkBasePtr == (CPU_STK *)0) {
+       *p_err = OS_ERR_TMR_STK_INVALID;
+        return;
+    }
+
+    if (OSCfg_TmrTaskStkSize < OSCfg_StkSizeMin) {
+       *p_err = OS_ERR_TMR_STK_SIZE_INVALID;
+        return;
+    }
+
+    if (OSCfg_TmrTaskPrio >= (OS_CFG_PRIO_MAX - 1u)) {
+       *p_err = OS_ERR_TMR_PRIO_INVALID;
+        return;
+    }
+
+    OSTaskCreate(&OSTmrTaskTCB,
+#if  (OS_CFG_DBG_EN == 0u)
+                 (CPU_CHAR *)0,
+#else
+                 (CPU_CHAR *)"uC/OS-III Timer Task",
+#endif
+                  OS_TmrTask,
+                 (void     *)0,
+                  OSCfg_TmrTaskPrio,
+                  OSCfg_TmrTaskStkBasePtr,
+                  OSCfg_TmrTaskStkLimit,
+                  OSCfg_TmrTaskStkSize,
+                  0u,
+                  0u,
+                 (void     *)0,
+                 (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
+                  p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                     TIMER WHEEL
+*
+* Note(s) : 1) The running timers are kept in a hierarchical timing wheel, laid out as the one of the tick list
+*              (see os_tick.c).  Level 'n' has 32 slots of 32^n ticks each & a timer is filed by the tick on which it
+*              expires (Match), so starting & stopping a timer is O(1) whatever the number of running timers.
+*
+*           2) OSTmrWheelTick is the last tick processed by the timer task.  The timers which expired up to that tick
+*              are moved to the list of due timers (OSTmrWheelTbl[OS_TMR_WHEEL_DUE_IX]) before their callbacks run.
+*
+*           3) Remain holds the delay loaded when the timer was started, Match - Remain is the start time.
+*
+*           4) A timer with a slack expires on the tick of [Match, Match + Slack] which OS_TickSlackAlign() picks, the
+*              same for all the timers & tasks whose windows contain it.  Remain is extended to keep Note #3 true.
+*              OSTmrMergeCtr counts the timers which were actually moved.
+************************************************************************************************************************
+*/
+
+/*
+************************************************************************************************************************
+*                                         ADD A TIMER TO THE TIMER WHEEL
+*
+* Description: This function is called to add a timer to the timer wheel.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to add.
+*
+*              time           Is the system time when this timer was linked.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The timer task is only signaled when the timer expires before the next event of the wheel.
+************************************************************************************************************************
+*/
+
+void OS_TmrLink (OS_TMR   *p_tmr,
+                 OS_TICK   time)
+{
+    OS_TICK  next;
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    OS_TICK  aligned;
+#endif
+
+
+    next = OS_TmrWheelNext(OSTmrWheelTick);                     /* Next event of the wheel, before adding our timer     */
+    if (next == 0u) {                                           /* Is the wheel empty?                                  */
+        OSTmrWheelTick = time;                                  /* Yes, catch up with the current time                  */
+    }
+
+    p_tmr->Match = time + p_tmr->Remain;
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    if (p_tmr->Slack > 0u) {                                    /* See Timer Wheel Note #4.                             */
+        aligned = OS_TickSlackAlign(p_tmr->Match, p_tmr->Slack);
+        if (aligned != p_tmr->Match) {                          /* Moved by the slack?                                  */
+            OSTmrMergeCtr++;
+            p_tmr->Match  = aligned;
+            p_tmr->Remain = aligned - time;
+        }
+    }
+#endif
+    OS_TmrWheelFile(p_tmr, OSTmrWheelTick + 1u);
+#if (OS_CFG_DBG_EN > 0u)
+    OSTmrListEntries++;
+#endif
+
+    if ((next                           ==   0u) ||             /* See Note #2.                                         */
+        ((p_tmr->Match - OSTmrWheelTick) < next)) {
+        OS_TmrCondSignal();
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                       REMOVE A TIMER FROM THE TIMER WHEEL
+*
+* Description: This function is called to remove the timer from the timer wheel.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to remove.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The timer task is not signaled, at worst it wakes up for an event which no longer exists.
+************************************************************************************************************************
+*/
+
+void  OS_TmrUnlink (OS_TMR  *p_tmr)
+{
+    OS_TMR  *p_tmr1;
+    OS_TMR  *p_tmr2;
+
+
+    p_tmr1 = p_tmr->PrevPtr;
+    p_tmr2 = p_tmr->NextPtr;
+    if (p_tmr1 == (OS_TMR *)0) {                                /* Head of the slot?                                    */
+        OSTmrWheelTbl[p_tmr->Slot] = p_tmr2;
+        if ((p_tmr2      == (OS_TMR *)0) &&                     /* Slot is now empty                                ... */
+            (p_tmr->Slot <  OS_TMR_WHEEL_DUE_IX)) {             /* ... & not the list of due timers                     */
+            OSTmrWheelMap[p_tmr->Slot >> OS_TICK_WHEEL_SLOT_BITS] &=
+                ~((CPU_INT32U)1u << (p_tmr->Slot & OS_TICK_WHEEL_SLOT_MSK));
+        }
+    } else {
+        p_tmr1->NextPtr = p_tmr2;
+    }
+    if (p_tmr2 != (OS_TMR *)0) {
+        p_tmr2->PrevPtr = p_tmr1;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    OSTmrListEntries--;
+#endif
+
+    p_tmr->PrevPtr = (OS_TMR *)0;
+    p_tmr->NextPtr = (OS_TMR *)0;
+    p_tmr->Remain  =           0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                     HARD TIMERS
+*
+* Note(s) : 1) Hard timers (OS_OPT_TMR_HARD) are kept apart from the timer wheel, in a list sorted by Match, & expire
+*              from OS_TickUpdate(), in the tick ISR.  Their callbacks are thus not delayed by the timer task, nor by
+*              the other timers, & see the tick on which they are due.
+*
+*           2) Their delays & periods are expressed in ticks, not in OSCfg_TmrTaskRate_Hz ticks.  Hard timers have no
+*              slack: coalescing them with the tasks would defeat their purpose.
+*
+*           3) The list is shared with the tick ISR & the other ISRs, & is only accessed with interrupts disabled.  The
+*              callbacks run in the tick ISR but with interrupts enabled, so they delay the tick, not the other ISRs.
+*              Keep them short: they can post to tasks & start or stop hard timers but MUST NOT block, nor use soft
+*              timers.
+*
+*           4) Starting a hard timer, or relinking a periodic one when it expires, walks the list to keep it sorted:
+*              the cost, with interrupts disabled, grows with the number of hard timers running.  They are meant for
+*              the few events which cannot wait for the timer task; the other timers belong on the timer wheel, whose
+*              cost does not depend on the number of timers.
+************************************************************************************************************************
+*/
+
+/*
+************************************************************************************************************************
+*                                          ADD A TIMER TO THE HARD TIMER LIST
+*
+* Description: This function is called to insert a hard timer in the hard timer list, sorted by expiry.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to add.
+*
+*              time           Is the value of OSTickCtr from which 'p_tmr->Remain' is counted.
+*              ----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+*
+*              3) The insertion is linear in the number of running hard timers (see HARD TIMERS Note #4).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_HARD_EN > 0u)
+void  OS_TmrHardLink (OS_TMR   *p_tmr,
+                      OS_TICK   time)
+{
+    OS_TMR  *p_tmr1;
+    OS_TMR  *p_tmr2;
+
+
+    p_tmr->Match = time + p_tmr->Remain;
+
+    p_tmr1 = (OS_TMR *)0;
+    p_tmr2 = OSTmrHardListPtr;
+    while (p_tmr2 != (OS_TMR *)0) {                             /* Timers due on the same tick keep their start order   */
+        if ((CPU_INT32S)(p_tmr2->Match - p_tmr->Match) > 0) {
+            break;
+        }
+        p_tmr1 = p_tmr2;
+        p_tmr2 = p_tmr2->NextPtr;
+    }
+
+    p_tmr->PrevPtr = p_tmr1;
+    p_tmr->NextPtr = p_tmr2;
+    if (p_tmr1 == (OS_TMR *)0) {
+        OSTmrHardListPtr = p_tmr;
+    } else {
+        p_tmr1->NextPtr  = p_tmr;
+    }
+    if (p_tmr2 != (OS_TMR *)0) {
+        p_tmr2->PrevPtr  = p_tmr;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                       REMOVE A TIMER FROM THE HARD TIMER LIST
+*
+* Description: This function is called to remove a running hard timer from the hard timer list.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to remove.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_TmrHardUnlink (OS_TMR  *p_tmr)
+{
+    OS_TMR  *p_tmr1;
+    OS_TMR  *p_tmr2;
+
+
+    p_tmr1 = p_tmr->PrevPtr;
+    p_tmr2 = p_tmr->NextPtr;
+    if (p_tmr1 == (OS_TMR *)0) {
+        OSTmrHardListPtr = p_tmr2;
+    } else {
+        p_tmr1->NextPtr  = p_tmr2;
+    }
+    if (p_tmr2 != (OS_TMR *)0) {
+        p_tmr2->PrevPtr  = p_tmr1;
+    }
+
+    p_tmr->PrevPtr = (OS_TMR *)0;
+    p_tmr->NextPtr = (OS_TMR *)0;
+    p_tmr->Remain  =           0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             EXPIRE THE HARD TIMERS
+*
+* Description: This function is called by OS_TickUpdate() to run the callbacks of the hard timers which are due.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called from the tick ISR with interrupts enabled.  It disables them to take each
+*                 timer which is due off the list, & enables them again while the callback runs.
+*
+*              3) A periodic timer is relinked from its previous expiry, not from the current tick, so that it does not
+*                 drift.  If its callback, or another ISR, restarted or stopped it, the new state is kept.
+************************************************************************************************************************
+*/
+
+void  OS_TmrHardUpdate (void)
+{
+    OS_TMR               *p_tmr;
+    OS_TMR_CALLBACK_PTR   p_fnct;
+    void                 *p_arg;
+    OS_TICK               match;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_tmr = OSTmrHardListPtr;
+    while (p_tmr != (OS_TMR *)0) {
+        if ((CPU_INT32S)(OSTickCtr - p_tmr->Match) < 0) {       /* List is sorted, nothing else is due                  */
+            break;
+        }
+        match        = p_tmr->Match;
+        OS_TmrHardUnlink(p_tmr);
+        p_tmr->State = OS_TMR_STATE_TIMEOUT;                    /* Lets the callback restart or stop the timer          */
+        p_fnct       = p_tmr->CallbackPtr;
+        p_arg        = p_tmr->CallbackPtrArg;
+
+        if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {
+            CPU_CRITICAL_EXIT();                                /* See Note #2.                                         */
+            (*p_fnct)(p_tmr, p_arg);
+            CPU_CRITICAL_ENTER();
+        }
+
+        if (p_tmr->State == OS_TMR_STATE_TIMEOUT) {             /* Untouched by the callback?                           */
+            if ((OS_OPT_TMR_MODE(p_tmr->Opt) == OS_OPT_TMR_PERIODIC) &&
+                (p_tmr->Period                >  0u)) {
+                p_tmr->State  = OS_TMR_STATE_RUNNING;           /* See Note #3.                                         */
+                p_tmr->Remain = p_tmr->Period;
+                OS_TmrHardLink(p_tmr, match);
+            } else {
+                p_tmr->State  = OS_TMR_STATE_COMPLETED;
+            }
+        }
+        p_tmr = OSTmrHardListPtr;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                                START A HARD TIMER
+*
+* Description: This function is called by OSTmrStart() to start or restart a hard timer from the current tick.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to start.
+*
+*              p_err          Is a pointer to an error code (see OSTmrStart()).
+*
+* Returns    : OS_TRUE   is the timer was started
+*              OS_FALSE  if not
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_TmrHardStart (OS_TMR  *p_tmr,
+                                      OS_ERR  *p_err)
+{
+    CPU_BOOLEAN  success;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:                              /* Restart the timer                                    */
+        case OS_TMR_STATE_TIMEOUT:
+        case OS_TMR_STATE_STOPPED:                              /* Start the timer                                      */
+        case OS_TMR_STATE_COMPLETED:
+             if (p_tmr->State == OS_TMR_STATE_RUNNING) {        /* A timer in its callback is already unlinked          */
+                 OS_TmrHardUnlink(p_tmr);
+             }
+             p_tmr->State = OS_TMR_STATE_RUNNING;
+             if (p_tmr->Dly == 0u) {
+                 p_tmr->Remain = p_tmr->Period;
+             } else {
+                 p_tmr->Remain = p_tmr->Dly;
+             }
+             OS_TmrHardLink(p_tmr, OSTickCtr);
+            *p_err   = OS_ERR_NONE;
+             success = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:                               /* Timer not created                                    */
+            *p_err   = OS_ERR_TMR_INACTIVE;
+             success = OS_FALSE;
+             break;
+
+        default:
+            *p_err   = OS_ERR_TMR_INVALID_STATE;
+             success = OS_FALSE;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (success);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 STOP A HARD TIMER
+*
+* Description: This function is called by OSTmrStop() to stop a hard timer.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to stop.
+*
+*              opt            Is the option passed to OSTmrStop().
+*
+*              p_callback_arg Is the callback argument passed to OSTmrStop().
+*
+*              p_err          Is a pointer to an error code (see OSTmrStop()).
+*
+* Returns    : OS_TRUE   If we stopped the timer (if the timer is already stopped, we also return OS_TRUE)
+*              OS_FALSE  If not
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The callback runs with interrupts enabled, as it would from the tick ISR.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_TmrHardStop (OS_TMR  *p_tmr,
+                                     OS_OPT   opt,
+                                     void    *p_callback_arg,
+                                     OS_ERR  *p_err)
+{
+    OS_TMR_CALLBACK_PTR  p_fnct;
+    CPU_BOOLEAN          success;
+    CPU_SR_ALLOC();
+
+
+    p_fnct = (OS_TMR_CALLBACK_PTR)0;
+    if ((opt != OS_OPT_TMR_NONE    ) &&
+        (opt != OS_OPT_TMR_CALLBACK) &&
+        (opt != OS_OPT_TMR_CALLBACK_ARG)) {
+       *p_err = OS_ERR_OPT_INVALID;
+        return (OS_FALSE);
+    }
+
+    CPU_CRITICAL_ENTER();
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:
+        case OS_TMR_STATE_TIMEOUT:
+             if (p_tmr->State == OS_TMR_STATE_RUNNING) {        /* A timer in its callback is already unlinked          */
+                 OS_TmrHardUnlink(p_tmr);
+             }
+             p_tmr->State = OS_TMR_STATE_STOPPED;               /* Ensure that any callbacks see the stop state         */
+            *p_err        = OS_ERR_NONE;
+             if (opt != OS_OPT_TMR_NONE) {
+                 if (opt == OS_OPT_TMR_CALLBACK) {              /* Use callback arg when timer was created ...          */
+                     p_callback_arg = p_tmr->CallbackPtrArg;
+                 }                                              /* ... or the 'callback_arg' provided in call           */
+                 p_fnct = p_tmr->CallbackPtr;                   /* Called once the timer is stopped (See Note #2)       */
+                 if (p_fnct == (OS_TMR_CALLBACK_PTR)0) {
+                    *p_err = OS_ERR_TMR_NO_CALLBACK;
+                 }
+             }
+             success      = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_COMPLETED:                            /* Timer has already completed the ONE-SHOT or          */
+        case OS_TMR_STATE_STOPPED:                              /* ... timer has not started yet.                       */
+             p_tmr->State = OS_TMR_STATE_STOPPED;
+            *p_err        = OS_ERR_TMR_STOPPED;
+             success      = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:                               /* Timer was not created                                */
+            *p_err        = OS_ERR_TMR_INACTIVE;
+             success      = OS_FALSE;
+             break;
+
+        default:
+            *p_err        = OS_ERR_TMR_INVALID_STATE;
+             success      = OS_FALSE;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {
+        (*p_fnct)(p_tmr, p_callback_arg);
+    }
+
+    return (success);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          QUEUE A CALLBACK IN THE LANE OF A TIMER
+*
+* Description: This function is called by the timer task to hand the callback of an expired timer to its lane.
+*
+* Arguments  : p_tmr          Is a pointer to the timer which expired.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The task of the lane is signaled without calling the scheduler: it runs once the timer task waits
+*                 again & releases the timer mutex, instead of blocking on it right away.
+*
+*              3) The timer expired on the tick 'Match', which the timer task may process later.  The timestamp of the
+*                 expiry is derived from the timestamp of the last tick, so the lane latency includes the delay of the
+*                 timer task.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_LANE_EN > 0u)
+static  void  OS_TmrLanePost (OS_TMR  *p_tmr)
+{
+    OS_TMR_LANE      *p_lane;
+    OS_ERR            err;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS            ts;
+    OS_TICK           late;
+    CPU_TS_TMR_FREQ   ts_per_tick;
+    CPU_ERR           cpu_err;
+    CPU_SR_ALLOC();
+#endif
+
+
+    p_lane = p_tmr->LanePtr;
+    if (p_tmr->LanePend == OS_TRUE) {                           /* Previous callback still waiting, merge with it       */
+        p_lane->OverrunCtr++;
+        return;
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    ts            = OSTickTS;
+    late          = OSTickCtr - p_tmr->Match;                   /* Ticks since the expiry (See Note #3)                 */
+    CPU_CRITICAL_EXIT();
+    ts_per_tick   = CPU_TS_TmrFreqGet(&cpu_err) / OSCfg_TickRate_Hz;
+    p_tmr->LaneTS = ts - (CPU_TS)((CPU_INT32S)late * (CPU_INT32S)ts_per_tick);
+#endif
+    p_tmr->LanePend    = OS_TRUE;
+    p_tmr->LaneNextPtr = (OS_TMR *)0;
+    if (p_lane->TailPtr == (OS_TMR *)0) {
+        p_lane->HeadPtr              = p_tmr;
+    } else {
+        p_lane->TailPtr->LaneNextPtr = p_tmr;
+    }
+    p_lane->TailPtr    = p_tmr;
+
+    (void)OSTaskSemPost(&p_lane->Task,                          /* See Note #2.                                         */
+                         OS_OPT_POST_NO_SCHED,
+                        &err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                     REMOVE A WAITING CALLBACK FROM THE LANE OF A TIMER
+*
+* Description: This function is called to drop the callback of a timer which is waiting in its lane, if any.
+*
+* Arguments  : p_tmr          Is a pointer to the timer.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with the timer mutex held.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrLaneRemove (OS_TMR  *p_tmr)
+{
+    OS_TMR_LANE  *p_lane;
+    OS_TMR       *p_tmr1;
+    OS_TMR       *p_tmr2;
+
+
+    if (p_tmr->LanePend == OS_FALSE) {
+        return;
+    }
+
+    p_lane = p_tmr->LanePtr;
+    p_tmr1 = (OS_TMR *)0;
+    p_tmr2 = p_lane->HeadPtr;
+    while (p_tmr2 != p_tmr) {                                   /* Lanes are short, a linear search will do             */
+        p_tmr1 = p_tmr2;
+        p_tmr2 = p_tmr2->LaneNextPtr;
+    }
+    if (p_tmr1 == (OS_TMR *)0) {
+        p_lane->HeadPtr      = p_tmr->LaneNextPtr;
+    } else {
+        p_tmr1->LaneNextPtr  = p_tmr->LaneNextPtr;
+    }
+    if (p_lane->TailPtr == p_tmr) {
+        p_lane->TailPtr      = p_tmr1;
+    }
+
+    p_tmr->LaneNextPtr = (OS_TMR *)0;
+    p_tmr->LanePend    = OS_FALSE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  TIMER CALLBACK LANE TASK
+*
+* Description: This task runs the callbacks queued in its lane by the timer task, in order of expiry.
+*
+* Arguments  : p_arg          Is a pointer to the lane (OS_TMR_LANE).
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The timer mutex is released while a callback runs so that a slow callback of this lane does not hold
+*                 up the timer task, nor the other lanes.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrLaneTask (void  *p_arg)
+{
+    OS_TMR_LANE          *p_lane;
+    OS_TMR               *p_tmr;
+    OS_TMR_CALLBACK_PTR   p_fnct;
+    void                 *p_fnct_arg;
+    OS_ERR                err;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS                latency;
+#endif
+
+
+    p_lane = (OS_TMR_LANE *)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u,                                 /* Wait for the timer task to queue a callback          */
+                            OS_OPT_PEND_BLOCKING,
+                            (CPU_TS *)0,
+                           &err);
+
+        OS_TmrLock();
+        p_tmr = p_lane->HeadPtr;
+        while (p_tmr != (OS_TMR *)0) {
+            p_lane->HeadPtr    = p_tmr->LaneNextPtr;            /* Take the oldest callback                             */
+            if (p_lane->HeadPtr == (OS_TMR *)0) {
+                p_lane->TailPtr = (OS_TMR *)0;
+            }
+            p_tmr->LaneNextPtr = (OS_TMR *)0;
+            p_tmr->LanePend    = OS_FALSE;
+            p_fnct             = p_tmr->CallbackPtr;
+            p_fnct_arg         = p_tmr->CallbackPtrArg;
+
+            p_lane->DispatchCtr++;
+#if (OS_CFG_TS_EN > 0u)
+            latency            = OS_TS_GET() - p_tmr->LaneTS;
+            p_lane->Latency    = latency;
+            p_lane->LatencySum += latency;
+            if (p_lane->LatencyMax < latency) {
+                p_lane->LatencyMax = latency;
+            }
+#endif
+            OS_TmrUnlock();                                     /* See Note #2.                                         */
+
+            if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {
+                (*p_fnct)(p_tmr, p_fnct_arg);
+            }
+
+            OS_TmrLock();
+            p_tmr = p_lane->HeadPtr;
+        }
+        OS_TmrUnlock();
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 TIMER MANAGEMENT TASK
+*
+* Description: This task is created by OS_TmrInit().
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The timer wheel is processed in two stages.
+*                   a) Advance the wheel up to the current tick, which moves the expired timers to the list of due timers.
+*                   b) Process each of the due timers by invoking its callback (if any) and removing it.
+*                 This method allows timer callbacks to Start/Stop timers, including the due ones.
+*
+*              3) Timer callbacks are allowed to make calls to the Timer APIs.
+*
+*              4) The task wakes up on the next event of the wheel, which may be a cascade without any timer expiring.
+************************************************************************************************************************
+*/
+
+void  OS_TmrTask (void  *p_arg)
+{
+    OS_TMR_CALLBACK_PTR   p_fnct;
+    OS_TMR               *p_tmr;
+    OS_TMR               *p_tmr_tail;
+    OS_TICK               next;
+    OS_TICK               elapsed;
+    OS_TICK               time;
+    CPU_INT08U            slot;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS                ts_start;
+#endif
+    CPU_SR_ALLOC();
+
+
+    (void)p_arg;                                                /* Not using 'p_arg', prevent compiler warning          */
+
+    OS_TmrLock();
+
+    for (;;) {
+        next                       = OS_TmrWheelNext(OSTmrWheelTick);
+        CPU_CRITICAL_ENTER();
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        time                       = OSTickCtr + OS_DynTickGet();
+#else
+        time                       = OSTickCtr;
+#endif
+        CPU_CRITICAL_EXIT();
+        elapsed                    = time - OSTmrWheelTick;
+
+        if (next == 0u) {                                       /* Is the wheel empty?                                  */
+            OS_TmrCondWait(0u);                                 /* Yes, wait until a timer is started.                  */
+        } else if (next > elapsed) {                            /* Suspend the timer task until it needs to process ... */
+            OS_TmrCondWait(next - elapsed);                     /* ... the timer wheel again. Also release the mutex... */
+        }                                                       /* ... so that application tasks can add/remove timers. */
+
+#if (OS_CFG_TS_EN > 0u)
+        ts_start = OS_TS_GET();
+#endif
+
+        CPU_CRITICAL_ENTER();
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        time                       = OSTickCtr + OS_DynTickGet();
+#else
+        time                       = OSTickCtr;
+#endif
+        CPU_CRITICAL_EXIT();
+        OSTmrTaskTickBase          = time;
+
+                                                                /* Advance the wheel, collect the expired timers.       */
+        p_tmr_tail                 = (OS_TMR *)0;
+        while (OSTmrWheelTick != time) {
+            next                   = OS_TmrWheelNext(OSTmrWheelTick);
+            if ((next == 0u) || (next > (time - OSTmrWheelTick))) {
+                OSTmrWheelTick     = time;                      /* Nothing else to do up to the current tick            */
+            } else {
+                OSTmrWheelTick    += next;
+                OS_TmrWheelCascade(OSTmrWheelTick);
+
+                slot               = (CPU_INT08U)(OSTmrWheelTick & OS_TICK_WHEEL_SLOT_MSK);
+                p_tmr              = OSTmrWheelTbl[slot];
+                if (p_tmr != (OS_TMR *)0) {                     /* Move the level 0 slot to the list of due timers      */
+                    OSTmrWheelTbl[slot]  = (OS_TMR *)0;
+                    OSTmrWheelMap[0]    &= ~((CPU_INT32U)1u << slot);
+                    if (p_tmr_tail == (OS_TMR *)0) {
+                        OSTmrWheelTbl[OS_TMR_WHEEL_DUE_IX] = p_tmr;
+                    } else {
+                        p_tmr_tail->NextPtr = p_tmr;
+                        p_tmr->PrevPtr      = p_tmr_tail;
+                    }
+                    while (p_tmr != (OS_TMR *)0) {
+                        p_tmr->Slot = OS_TMR_WHEEL_DUE_IX;
+                        p_tmr_tail  = p_tmr;
+                        p_tmr       = p_tmr->NextPtr;
+                    }
+                }
+            }
+        }
+
+                                                                /* Process timers that have expired.                    */
+        p_tmr                      = OSTmrWheelTbl[OS_TMR_WHEEL_DUE_IX];
+
+        while (p_tmr != (OS_TMR *)0) {
+            p_tmr->State           = OS_TMR_STATE_TIMEOUT;
+                                                                /* Execute callback function if available               */
+            p_fnct                 = p_tmr->CallbackPtr;
+#if (OS_CFG_TMR_LANE_EN > 0u)
+            if (p_tmr->LanePtr != (OS_TMR_LANE *)0) {           /* Only queue the callback in the lane of the timer     */
+                OS_TmrLanePost(p_tmr);
+                p_fnct             = (OS_TMR_CALLBACK_PTR)0;
+            }
+#endif
+            if (p_fnct != (OS_TMR_CALLBACK_PTR)0u) {
+                (*p_fnct)(p_tmr, p_tmr->CallbackPtrArg);
+            }
+
+            if (p_tmr->State == OS_TMR_STATE_TIMEOUT) {
+                OS_TmrUnlink(p_tmr);
+
+                if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {
+                    p_tmr->State   = OS_TMR_STATE_RUNNING;
+                    p_tmr->Remain  = p_tmr->Period;
+                    OS_TmrLink(p_tmr, OSTmrTaskTickBase);
+                } else {
+                    p_tmr->State   = OS_TMR_STATE_COMPLETED;
+                }
+            }
+
+            p_tmr                  = OSTmrWheelTbl[OS_TMR_WHEEL_DUE_IX];
+        }
+
+#if (OS_CFG_TS_EN > 0u)
+        OSTmrTaskTime = OS_TS_GET() - ts_start;                 /* Measure execution time of timer task                 */
+        if (OSTmrTaskTimeMax < OSTmrTaskTime) {
+            OSTmrTaskTimeMax       = OSTmrTaskTime;
+        }
+#endif
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                          TIMER MANAGEMENT LOCKING MECHANISM
+*
+* Description: These functions are used to handle timer critical sections.  The method uses a mutex
+*              to protect access to the global timer list.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrLock (void)
+{
+    OS_ERR  err;
+
+
+    OSMutexPend(&OSTmrMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+}
+
+
+static  void  OS_TmrUnlock (void)
+{
+    OS_ERR  err;
+
+
+    OSMutexPost(&OSTmrMutex, OS_OPT_POST_NONE, &err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                         CREATE TIMER TASK CONDITION VARIABLE
+*
+* Description: Initializes a condition variable for INTERNAL use ONLY.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrCondCreate (void)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OSTmrCond.Type  = OS_OBJ_TYPE_COND;                         /* Mark the data structure as a condition variable.     */
+#endif
+    OSTmrCond.Mutex = &OSTmrMutex;                              /* Bind the timer mutex to the condition variable.      */
+    OS_PendListInit(&OSTmrCond.PendList);                       /* Initialize the waiting list                          */
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                         WAIT ON TIMER TASK CONDITION VARIABLE
+*
+* Description: Allows the timer task to release the global mutex and pend atomically. This ensures that
+*              timers are only added/removed after the timer task has processed the current list and pended
+*              for the next timeout. The timer task will always acquire the mutex before returning from this function.
+*
+* Arguments  : timeout                   The number of ticks before the timer task will wake up.
+*                                        A value of zero signifies an indefinite pend.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrCondWait (OS_TICK  timeout)
+{
+    OS_TCB        *p_tcb;
+    OS_PEND_LIST  *p_pend_list;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_TS_EN > 0u)
+    ts             = OS_TS_GET();                               /* Get timestamp                                        */
+    OSTmrMutex.TS  = ts;
+#else
+    ts             = 0u;
+#endif
+                                                                /* Release mutex to other tasks.                        */
+    OS_MutexGrpRemove(&OSTmrTaskTCB, &OSTmrMutex);
+    p_pend_list                    = &OSTmrMutex.PendList;
+
+    if (OSTmrTaskTCB.Prio != OSTmrTaskTCB.BasePrio) {           /* Restore our original prio.                           */
+        OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(&OSTmrTaskTCB, OSTmrTaskTCB.Prio);
+        OSTmrTaskTCB.Prio          = OSTmrTaskTCB.BasePrio;
+        OSPrioCur                  = OSTmrTaskTCB.BasePrio;
+    }
+
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
+        OSTmrMutex.OwnerTCBPtr     = (OS_TCB *)0;               /* No                                                   */
+        OSTmrMutex.OwnerNestingCtr =           0u;
+    } else {
+        p_tcb                      = p_pend_list->HeadPtr;      /* Yes, give mutex to new owner                         */
+        OSTmrMutex.OwnerTCBPtr     = p_tcb;
+        OSTmrMutex.OwnerNestingCtr =           1u;
+        OS_MutexGrpAdd(p_tcb, &OSTmrMutex);
+                                                                /* Post to mutex                                        */
+        OS_Post((OS_PEND_OBJ *)((void *)&OSTmrMutex),
+                                         p_tcb,
+                                (void *) 0,
+                                         0u,
+                                         ts);
+    }
+
+    OS_Pend((OS_PEND_OBJ *)((void *)&OSTmrCond),                /* Pend on the condition variable.                      */
+                                   &OSTmrTaskTCB,
+                                    OS_TASK_PEND_ON_COND,
+                                    timeout,
+                                    OS_OPT_PEND_BLOCKING);
+    CPU_CRITICAL_EXIT();
+
+    OSSched();
+
+    CPU_CRITICAL_ENTER();                                       /* Either we timed out, or were signaled.               */
+
+    if (OSTmrMutex.OwnerTCBPtr == (OS_TCB *)0) {                /* Can we grab the mutex?                               */
+        OS_MutexGrpAdd(&OSTmrTaskTCB, &OSTmrMutex);             /* Yes, no-one else pending.                            */
+        OSTmrMutex.OwnerTCBPtr     = &OSTmrTaskTCB;
+        OSTmrMutex.OwnerNestingCtr = 1u;
+        CPU_CRITICAL_EXIT();
+    } else {
+        p_tcb = OSTmrMutex.OwnerTCBPtr;                         /* No, we need to wait for it.                          */
+        if (p_tcb->Prio > OSTmrTaskTCB.Prio) {                  /* See if mutex owner has a lower priority than TmrTask.*/
+            OS_TaskChangePrio(p_tcb, OSTmrTaskTCB.Prio);
+        }
+
+        OS_Pend((OS_PEND_OBJ *)((void *)&OSTmrMutex),           /* Block TmrTask until it gets the Mutex.               */
+                                        &OSTmrTaskTCB,
+                                         OS_TASK_PEND_ON_MUTEX,
+                                         0u,
+                                         OS_OPT_PEND_BLOCKING);
+        CPU_CRITICAL_EXIT();
+
+        OSSched();
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                       SIGNAL THE TIMER TASK CONDITION VARIABLE
+*
+* Description: Used to signal the timer task when a timer is added/removed which requires the task to reload
+*              its timeout. We ensure that this function is always called with the timer mutex locked.
+*
+* Arguments  : none.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrCondSignal (void)
+{
+    OS_PEND_LIST  *p_pend_list;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_TS_EN > 0u)
+    ts             = OS_TS_GET();                               /* Get timestamp                                        */
+    OSTmrMutex.TS  = ts;
+#else
+    ts             = 0u;
+#endif
+
+    p_pend_list    = &OSTmrCond.PendList;
+
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Timer task waiting on cond?                          */
+        CPU_CRITICAL_EXIT();
+        return;                                                 /* No, nothing to signal.                               */
+    } else {
+                                                                /* Yes, signal the timer task.                          */
+        OS_Post((OS_PEND_OBJ *)((void *)&OSTmrCond),
+                                        &OSTmrTaskTCB,
+                                (void *) 0,
+                                         0u,
+                                         ts);
+    }
+
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                            FILE A TIMER IN THE WHEEL
+*
+* Description: This function places a timer in the slot matching its expiry (Match).
+*
+* Arguments  : p_tmr          Is a pointer to the timer.
+*              -----
+*
+*              tick_next      Is the next tick the wheel will process.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Delays beyond the span of the top level are parked in its farthest slot & filed again when that slot
+*                 is cascaded.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrWheelFile (OS_TMR   *p_tmr,
+                               OS_TICK   tick_next)
+{
+    OS_TMR      **p_slot;
+    OS_TICK       delta;
+    OS_TICK       match;
+    CPU_INT08U    lvl;
+    CPU_INT08U    shift;
+    CPU_INT08U    slot;
+
+
+    match = p_tmr->Match;
+    delta = match - tick_next;
+    lvl   = 0u;
+    shift = 0u;
+    while ((lvl < (OS_CFG_TMR_WHEEL_LVL_NBR - 1u)) &&           /* Find the lowest level whose span covers the delay    */
+           ((delta >> (shift + OS_TICK_WHEEL_SLOT_BITS)) != 0u)) {
+        lvl++;
+        shift += OS_TICK_WHEEL_SLOT_BITS;
+    }
+    if ((delta >> (shift + OS_TICK_WHEEL_SLOT_BITS)) != 0u) {   /* See Note #2.                                         */
+        match = tick_next + (((OS_TICK)1u << (shift + OS_TICK_WHEEL_SLOT_BITS)) - 1u);
+    }
+
+    slot           = (CPU_INT08U)((match >> shift) & OS_TICK_WHEEL_SLOT_MSK);
+    p_tmr->Slot    = (CPU_INT08U)((lvl * OS_TICK_WHEEL_SLOT_NBR) + slot);
+
+    p_slot         = &OSTmrWheelTbl[p_tmr->Slot];
+    p_tmr->PrevPtr = (OS_TMR *)0;
+    p_tmr->NextPtr = *p_slot;
+    if (*p_slot != (OS_TMR *)0) {
+        (*p_slot)->PrevPtr = p_tmr;
+    }
+    *p_slot        = p_tmr;
+
+    OSTmrWheelMap[lvl] |= (CPU_INT32U)1u << slot;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             CASCADE THE TIMER WHEEL
+*
+* Description: This function files again, closer to their expiry, the timers of every slot which starts on 'tick'.
+*
+* Arguments  : tick           Is the tick being processed.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The timers cascaded to the level 0 slot of 'tick' expire on this tick.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrWheelCascade (OS_TICK  tick)
+{
+    OS_TMR      *p_tmr;
+    OS_TMR      *p_tmr_next;
+    CPU_INT08U   lvl;
+    CPU_INT08U   shift;
+    CPU_INT08U   slot;
+
+
+    shift = OS_TICK_WHEEL_SLOT_BITS;
+    for (lvl = 1u; lvl < OS_CFG_TMR_WHEEL_LVL_NBR; lvl++) {
+        if ((tick & (((OS_TICK)1u << shift) - 1u)) != 0u) {     /* Does a slot of this level start on this tick?        */
+            break;
+        }
+        slot = (CPU_INT08U)((tick >> shift) & OS_TICK_WHEEL_SLOT_MSK);
+        if ((OSTmrWheelMap[lvl] & ((CPU_INT32U)1u << slot)) != 0u) {
+            OSTmrWheelMap[lvl] &= ~((CPU_INT32U)1u << slot);
+            p_tmr = OSTmrWheelTbl[(lvl * OS_TICK_WHEEL_SLOT_NBR) + slot];
+            OSTmrWheelTbl[(lvl * OS_TICK_WHEEL_SLOT_NBR) + slot] = (OS_TMR *)0;
+            while (p_tmr != (OS_TMR *)0) {
+                p_tmr_next = p_tmr->NextPtr;
+                OS_TmrWheelFile(p_tmr, tick);
+                p_tmr      = p_tmr_next;
+            }
+        }
+        shift += OS_TICK_WHEEL_SLOT_BITS;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                           FIND THE NEXT TIMER WHEEL EVENT
+*
+* Description: This function finds the next tick on which a timer expires or a non-empty slot is cascaded.
+*
+* Arguments  : tick           Is the last tick processed.
+*
+* Returns    : The number of ticks from 'tick' to the event, 0 if the wheel is empty.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Each level is searched from its current slot.  Unless the next tick starts that slot, the current slot
+*                 of a level above 0 was already cascaded & only holds timers a full turn away.
+************************************************************************************************************************
+*/
+
+static  OS_TICK  OS_TmrWheelNext (OS_TICK  tick)
+{
+    OS_TICK      tick_next;
+    OS_TICK      ticks;
+    OS_TICK      step;
+    CPU_INT32U   map;
+    CPU_INT08U   lvl;
+    CPU_INT08U   shift;
+    CPU_INT08U   slot;
+    CPU_DATA     ix;
+
+
+    tick_next = tick + 1u;
+    ticks     = 0u;
+    shift     = 0u;
+    for (lvl = 0u; lvl < OS_CFG_TMR_WHEEL_LVL_NBR; lvl++) {
+        map = OSTmrWheelMap[lvl];
+        if (map != 0u) {
+            slot = (CPU_INT08U)((tick_next >> shift) & OS_TICK_WHEEL_SLOT_MSK);
+            if (slot != 0u) {                                   /* Rotate the current slot to bit 0                     */
+                map = (map >> slot) | (map << (OS_TICK_WHEEL_SLOT_NBR - slot));
+            }
+            if ((tick_next & (((OS_TICK)1u << shift) - 1u)) != 0u) {
+                if ((map & ~(CPU_INT32U)1u) != 0u) {            /* See Note #2.                                         */
+                    ix = CPU_CntTrailZeros32(map & ~(CPU_INT32U)1u);
+                } else {
+                    ix = OS_TICK_WHEEL_SLOT_NBR;
+                }
+            } else {
+                ix = CPU_CntTrailZeros32(map);
+            }
+            step = ((((tick_next >> shift) + (OS_TICK)ix) << shift) - tick);
+            if ((ticks == 0u) || (step < ticks)) {
+                ticks = step;
+            }
+        }
+        shift += OS_TICK_WHEEL_SLOT_BITS;
+    }
+
+    return (ticks);
+}
+#endif
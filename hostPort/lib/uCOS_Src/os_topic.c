@@ -0,0 +1,622 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                     PUBLISH/SUBSCRIBE TOPIC MANAGEMENT
+*
+* File    : os_topic.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) A topic fans a buffer out to the message queues of all its subscribers.  The buffer is
+*               posted by reference, once per subscriber, & is never copied.
+*
+*           (2) Buffers are blocks of a memory partition given to the topic at creation.  Each block counts
+*               its holders (See 'os.h  PUBLISH/SUBSCRIBE TOPICS  Note #2') & goes back to the partition when
+*               the last subscriber releases it, so the publisher never reuses a buffer still being read.
+*
+*           (3) A subscriber receives the buffers with OSQPend() (or OSQPendN(), OSPendMulti()) on its own
+*               queue & MUST call OSTopicBufRelease() once done with each of them.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_topic__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_TOPIC_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                   CREATE A TOPIC
+*
+* Description: This function is called by your application to create a topic.  Topics MUST be created before they can be
+*              used.
+*
+* Arguments  : p_topic     is a pointer to the topic
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the topic
+*
+*              p_mem       is a pointer to the memory partition the buffers of the topic are taken from.  Each block
+*                          holds an OS_TOPIC_BUF header followed by 'p_mem->BlkSize - sizeof(OS_TOPIC_BUF)' bytes of
+*                          data.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the topic after you called
+*                                                               OSSafetyCriticalStart()
+*                              OS_ERR_MEM_INVALID_P_MEM       If you passed a NULL pointer for 'p_mem'
+*                              OS_ERR_MEM_INVALID_SIZE        If the blocks of 'p_mem' can't hold any data
+*                              OS_ERR_OBJ_CREATED             If the topic was already created
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_topic'
+*                              OS_ERR_OBJ_TYPE                If 'p_mem' is not pointing at a memory partition
+*
+* Returns    : none
+*
+* Note(s)    : 1) Several topics may share a partition.
+************************************************************************************************************************
+*/
+
+void  OSTopicCreate (OS_TOPIC  *p_topic,
+                     CPU_CHAR  *p_name,
+                     OS_MEM    *p_mem,
+                     OS_ERR    *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_topic == (OS_TOPIC *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_mem == (OS_MEM *)0) {
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_mem->BlkSize <= sizeof(OS_TOPIC_BUF)) {               /* Blocks must have room past the header                */
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the memory partition was created           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    if (p_topic->Type == OS_OBJ_TYPE_TOPIC) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+    p_topic->Type       = OS_OBJ_TYPE_TOPIC;                    /* Mark the data structure as a topic                   */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_topic->NamePtr    = p_name;
+#else
+    (void)p_name;
+#endif
+    p_topic->MemPtr     = p_mem;
+    p_topic->SubListPtr = (OS_TOPIC_SUB *)0;                    /* No subscribers yet                                   */
+    p_topic->SubNbr     = 0u;
+    p_topic->DropCtr    = 0u;
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_TopicDbgListAdd(p_topic);
+    OSTopicQty++;                                               /* One more topic created                               */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 GET A TOPIC BUFFER
+*
+* Description: This function takes a buffer from the memory partition of a topic, to be filled & published.
+*
+* Arguments  : p_topic   is a pointer to the topic
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                 A buffer was returned
+*                            OS_ERR_MEM_NO_FREE_BLKS     If all the buffers are in use
+*                            OS_ERR_OBJ_PTR_NULL         If you passed a NULL pointer for 'p_topic'
+*                            OS_ERR_OBJ_TYPE             If the topic was not created
+*
+* Returns    : A pointer to the data area of the buffer, 'p_topic->MemPtr->BlkSize - sizeof(OS_TOPIC_BUF)' bytes long
+*              A pointer to NULL if an error is detected
+*
+* Note(s)    : 1) The caller holds the buffer until it passes it to OSTopicPublish().  A buffer that won't be published
+*                 is given back with OSTopicBufRelease().
+************************************************************************************************************************
+*/
+
+void  *OSTopicBufGet (OS_TOPIC  *p_topic,
+                      OS_ERR    *p_err)
+{
+    OS_TOPIC_BUF  *p_hdr;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_topic == (OS_TOPIC *)0) {                             /* Validate 'p_topic'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_topic->Type != OS_OBJ_TYPE_TOPIC) {                   /* Make sure the topic was created                      */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    p_hdr = (OS_TOPIC_BUF *)OSMemGet(p_topic->MemPtr, p_err);
+    if (p_hdr == (OS_TOPIC_BUF *)0) {
+        return ((void *)0);                                     /* No free block, '*p_err' set by OSMemGet()            */
+    }
+    p_hdr->MemPtr = p_topic->MemPtr;                            /* The block is ours until published, no other holder   */
+    p_hdr->RefCtr = 1u;
+    return ((void *)(p_hdr + 1u));                              /* Data follows the header                              */
+}
+
+
+/*
+************************************************************************************************************************
+*                                               RELEASE A TOPIC BUFFER
+*
+* Description: This function is called by a subscriber once done with a buffer it received, or by a publisher to give
+*              back a buffer it won't publish.  The buffer returns to its memory partition when its last holder
+*              releases it.
+*
+* Arguments  : p_buf     is a pointer to the data area of the buffer, as returned by OSTopicBufGet() or received from
+*                        the subscriber queue
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                 The buffer was released
+*                            OS_ERR_PTR_INVALID          If you passed a NULL pointer for 'p_buf' or a buffer that was
+*                                                        already released by all its holders
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSTopicBufRelease (void    *p_buf,
+                         OS_ERR  *p_err)
+{
+    OS_TOPIC_BUF  *p_hdr;
+    OS_OBJ_QTY     ref_ctr;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (void *)0) {                                   /* Validate 'p_buf'                                     */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    p_hdr = (OS_TOPIC_BUF *)p_buf - 1u;                         /* Header precedes the data                             */
+
+    CPU_CRITICAL_ENTER();
+    if (p_hdr->RefCtr == 0u) {                                  /* Released more times than it was held?                */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    p_hdr->RefCtr--;
+    ref_ctr = p_hdr->RefCtr;
+    CPU_CRITICAL_EXIT();
+
+    if (ref_ctr == 0u) {                                        /* Last holder, return the block to its partition       */
+        OSMemPut(p_hdr->MemPtr, (void *)p_hdr, p_err);
+        return;
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             PUBLISH A BUFFER ON A TOPIC
+*
+* Description: This function posts a buffer to the message queue of every subscriber of a topic.
+*
+* Arguments  : p_topic   is a pointer to the topic
+*
+*              p_buf     is a pointer to a buffer returned by OSTopicBufGet() for this topic
+*
+*              msg_size  is the number of bytes of data in the buffer, passed on to the subscribers
+*
+*              opt       determines the type of POST performed:
+*
+*                            OS_OPT_POST_NONE            Call the scheduler once all subscribers have the buffer
+*                            OS_OPT_POST_NO_SCHED        Do not call the scheduler
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                 The buffer was delivered to every subscriber
+*                            OS_ERR_MSG_POOL_EMPTY       If a subscriber queue ran out of OS_MSGs, it was skipped
+*                            OS_ERR_OBJ_PTR_NULL         If you passed a NULL pointer for 'p_topic'
+*                            OS_ERR_OBJ_TYPE             If the topic was not created, or a subscriber queue was deleted
+*                                                        (it was skipped)
+*                            OS_ERR_OPT_INVALID          You specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING       If uC/OS-III is not running yet
+*                            OS_ERR_PTR_INVALID          If 'p_buf' is NULL or is not a buffer of this topic held by
+*                                                        the caller
+*                            OS_ERR_Q_MAX                If a subscriber queue was full, it was skipped
+*
+* Returns    : The number of subscribers the buffer was delivered to
+*
+* Note(s)    : 1) The publisher gives up the buffer, it must not access it once this function returns.  A buffer no
+*                 subscriber received goes straight back to the partition.
+*
+*              2) Subscribers are not retried, a delivery that fails is counted in 'p_topic->DropCtr'.
+*
+*              3) All subscribers receive the buffer within one critical section, which lasts in proportion to their
+*                 number, as for a post with OS_OPT_POST_ALL.  The holders are counted before interrupts are
+*                 enabled again, so a subscriber can't release the buffer before all others have received it.
+*
+*              4) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSTopicPublish (OS_TOPIC     *p_topic,
+                            void         *p_buf,
+                            OS_MSG_SIZE   msg_size,
+                            OS_OPT        opt,
+                            OS_ERR       *p_err)
+{
+    OS_TOPIC_BUF  *p_hdr;
+    OS_TOPIC_SUB  *p_sub;
+    OS_Q          *p_q;
+    OS_TCB        *p_tcb;
+    OS_OBJ_QTY     nbr;
+    OS_OBJ_QTY     ref_ctr;
+    OS_ERR         err;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_topic == (OS_TOPIC *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_buf == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_topic->Type != OS_OBJ_TYPE_TOPIC) {                   /* Make sure the topic was created                      */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    p_hdr = (OS_TOPIC_BUF *)p_buf - 1u;                         /* Header precedes the data                             */
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_hdr->MemPtr != p_topic->MemPtr) ||                   /* Must be a buffer of this topic ...                   */
+        (p_hdr->RefCtr == 0u)) {                                /* ... still held by the caller                         */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+   *p_err = OS_ERR_NONE;
+    nbr   = 0u;
+    CPU_CRITICAL_ENTER();
+    p_sub = p_topic->SubListPtr;
+    while (p_sub != (OS_TOPIC_SUB *)0) {                        /* Deliver to every subscriber (See Note #3)            */
+        p_q = p_sub->QPtr;
+        p_sub = p_sub->NextPtr;
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+        if (p_q->Type != OS_OBJ_TYPE_Q) {                       /* Subscriber queue deleted?                            */
+            p_topic->DropCtr++;
+           *p_err = OS_ERR_OBJ_TYPE;
+            continue;
+        }
+#endif
+        p_tcb = OS_PEND_LIST_HEAD(p_q);
+        if (p_tcb == (OS_TCB *)0) {                             /* Any task waiting on the subscriber queue?            */
+            OS_MsgQPut(&p_q->MsgQ,                              /* No, place the buffer in the queue                    */
+                       p_buf,
+                       msg_size,
+                       OS_OPT_POST_FIFO,
+                       ts,
+                       &err);
+            if (err != OS_ERR_NONE) {                           /* See Note #2                                          */
+                p_topic->DropCtr++;
+               *p_err = err;
+                continue;
+            }
+        } else {
+            OS_Post((OS_PEND_OBJ *)((void *)p_q),               /* Yes, hand the buffer to the task                     */
+                    p_tcb,
+                    p_buf,
+                    msg_size,
+                    ts);
+        }
+        nbr++;
+    }
+    p_hdr->RefCtr = (p_hdr->RefCtr + nbr) - 1u;                 /* Subscribers now hold the buffer, publisher doesn't   */
+    ref_ctr       =  p_hdr->RefCtr;
+    CPU_CRITICAL_EXIT();
+
+    if (ref_ctr == 0u) {                                        /* Nobody received it, see Note #1                      */
+        OSMemPut(p_hdr->MemPtr, (void *)p_hdr, &err);
+    }
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+    return (nbr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                SUBSCRIBE TO A TOPIC
+*
+* Description: This function adds a subscriber to a topic.  Buffers published from then on are posted to 'p_q'.
+*
+* Arguments  : p_topic   is a pointer to the topic
+*
+*              p_sub     is a pointer to a subscriber entry, it must remain allocated & untouched until the queue
+*                        unsubscribes
+*
+*              p_q       is a pointer to the message queue the buffers will be posted to
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                 The queue subscribed to the topic
+*                            OS_ERR_OBJ_PTR_NULL         If you passed a NULL pointer for 'p_topic' or 'p_q'
+*                            OS_ERR_OBJ_TYPE             If the topic or the queue was not created
+*                            OS_ERR_PTR_INVALID          If you passed a NULL pointer for 'p_sub'
+*
+* Returns    : none
+*
+* Note(s)    : 1) A queue subscribed to several topics receives the buffers of all of them.
+************************************************************************************************************************
+*/
+
+void  OSTopicSubscribe (OS_TOPIC      *p_topic,
+                        OS_TOPIC_SUB  *p_sub,
+                        OS_Q          *p_q,
+                        OS_ERR        *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_topic == (OS_TOPIC *)0) ||                           /* Validate arguments                                   */
+        (p_q     == (OS_Q     *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_sub == (OS_TOPIC_SUB *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if ((p_topic->Type != OS_OBJ_TYPE_TOPIC) ||                 /* Make sure the topic & the queue were created         */
+        (p_q->Type     != OS_OBJ_TYPE_Q)) {
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_sub->QPtr         = p_q;
+    p_sub->NextPtr      = p_topic->SubListPtr;                  /* Insert at the head of the subscriber list            */
+    p_topic->SubListPtr = p_sub;
+    p_topic->SubNbr++;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              UNSUBSCRIBE FROM A TOPIC
+*
+* Description: This function removes a subscriber from a topic.
+*
+* Arguments  : p_topic   is a pointer to the topic
+*
+*              p_sub     is a pointer to the subscriber entry given to OSTopicSubscribe()
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                 The subscriber was removed
+*                            OS_ERR_OBJ_PTR_NULL         If you passed a NULL pointer for 'p_topic'
+*                            OS_ERR_OBJ_TYPE             If the topic was not created
+*                            OS_ERR_PTR_INVALID          If 'p_sub' is not a subscriber of the topic
+*
+* Returns    : none
+*
+* Note(s)    : 1) Buffers already delivered stay in the subscriber queue.  They must still be received & released, a
+*                 queue flushed or deleted with buffers in it never returns them to their partition.
+************************************************************************************************************************
+*/
+
+void  OSTopicUnsubscribe (OS_TOPIC      *p_topic,
+                          OS_TOPIC_SUB  *p_sub,
+                          OS_ERR        *p_err)
+{
+    OS_TOPIC_SUB  **pp_sub;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_topic == (OS_TOPIC *)0) {                             /* Validate 'p_topic'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_topic->Type != OS_OBJ_TYPE_TOPIC) {                   /* Make sure the topic was created                      */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    pp_sub = &p_topic->SubListPtr;
+    while ((*pp_sub != (OS_TOPIC_SUB *)0) &&                    /* Find the link to 'p_sub'                             */
+           (*pp_sub != p_sub)) {
+        pp_sub = &(*pp_sub)->NextPtr;
+    }
+    if (*pp_sub == (OS_TOPIC_SUB *)0) {                         /* Not a subscriber of this topic                       */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+   *pp_sub         = p_sub->NextPtr;                            /* Unlink it                                            */
+    p_sub->NextPtr = (OS_TOPIC_SUB *)0;
+    p_topic->SubNbr--;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                               ADD TOPIC TO DEBUG LIST
+*
+* Description: This function is called by OSTopicCreate() to add the topic to the debug list.
+*
+* Arguments  : p_topic  is a pointer to the topic to add
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_TopicDbgListAdd (OS_TOPIC  *p_topic)
+{
+    p_topic->DbgPrevPtr               = (OS_TOPIC *)0;
+    if (OSTopicDbgListPtr == (OS_TOPIC *)0) {
+        p_topic->DbgNextPtr           = (OS_TOPIC *)0;
+    } else {
+        p_topic->DbgNextPtr           =  OSTopicDbgListPtr;
+        OSTopicDbgListPtr->DbgPrevPtr =  p_topic;
+    }
+    OSTopicDbgListPtr                 =  p_topic;
+}
+#endif
+#endif
@@ -0,0 +1,106 @@
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "os.h"
+#include "bench.h"
+#include "wcet.h"
+#include "tmrbench.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/* Task Stack Size */
+#define APP_TASK_START_STK_SIZE 256u
+
+/* Task Priority */
+#define APP_TASK_START_PRIO 1u
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/* Task Control Block */
+static OS_TCB AppTaskStartTCB;
+
+/* Task Stack */
+static CPU_STK AppTaskStartStk[APP_TASK_START_STK_SIZE];
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void AppTaskStart(void *p_arg);
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int main(void)
+{
+    OS_ERR err;
+
+    CPU_Init();     //Calibrates the timestamp timer, see CPU_TS_TmrInit()
+
+    OSInit(&err);
+
+    OSTaskCreate((OS_TCB *)&AppTaskStartTCB,
+                 (CPU_CHAR *)"App Task Start",
+                 (OS_TASK_PTR)AppTaskStart,
+                 (void *)0,
+                 (OS_PRIO)APP_TASK_START_PRIO,
+                 (CPU_STK *)&AppTaskStartStk[0],
+                 (CPU_STK_SIZE)APP_TASK_START_STK_SIZE / 10,
+                 (CPU_STK_SIZE)APP_TASK_START_STK_SIZE,
+                 (OS_MSG_QTY)5u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+
+    OSStart(&err);      //Returns once AppTaskStart calls OS_CPU_Stop()
+
+    return 0;
+}
+
+/*
+*********************************************************************************************************
+*                                              STARTUP TASK
+*********************************************************************************************************
+*/
+
+static void AppTaskStart(void *p_arg)
+{
+    OS_CPU_SysTickInitFreq(OS_CPU_SYS_TICK_FREQ_HZ);
+
+    CPU_IntSrcHandlerSet(CPU_INT_EXT0, BenchIntHandler);
+    CPU_IntSrcEn(CPU_INT_EXT0);
+
+    BenchRun();
+    WcetRun();
+    TmrBenchRun();
+
+    OS_CPU_Stop();
+}
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BenchIntTrig(void)
+{
+    CPU_IntSrcPendSet(CPU_INT_EXT0);        //Taken at once, interrupts are enabled
+}
@@ -0,0 +1,117 @@
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <stdio.h>
+#include "tmrbench.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define TMR_BENCH_NBR_MIN 10u
+
+#define TMR_BENCH_TS_GET() ((CPU_INT32U)CPU_TS_TmrRd())
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/* OS Kernal Objects */
+static OS_TMR TmrBenchTmr[TMR_BENCH_NBR_MAX];
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void TmrBenchPoint(CPU_INT32U n);
+
+/*
+*********************************************************************************************************
+*                                             RUN THE SWEEP
+*********************************************************************************************************
+*/
+
+void TmrBenchRun(void)
+{
+    CPU_INT32U n;
+
+    printf("\nTimer scaling, mean counts per call (%u calls) with n timers running\n\n",
+           (unsigned)TMR_BENCH_SAMPLE_NBR);
+    printf("%6s %10s %10s %10s %10s\n", "n", "Start", "Restart", "Stop", "RemainGet");
+
+    for (n = TMR_BENCH_NBR_MIN; n <= TMR_BENCH_NBR_MAX; n *= 10u)
+    {
+        TmrBenchPoint(n);
+    }
+    printf("\nStart: stopped timer, Restart: running timer\n");
+    fflush(stdout);
+}
+
+/* Start n timers spread over the wheel, then time the API on a sample of them */
+static void TmrBenchPoint(CPU_INT32U n)
+{
+    OS_ERR err;
+    CPU_INT32U start = 0u;
+    CPU_INT32U restart = 0u;
+    CPU_INT32U stop = 0u;
+    CPU_INT32U remain = 0u;
+    CPU_INT32U ts;
+    CPU_INT32U ix;
+    CPU_INT32U i;
+
+    for (i = 0; i < n; i++)
+    {
+        OSTmrCreate(&TmrBenchTmr[i],
+                    (CPU_CHAR *)"Tmr Bench",
+                    (OS_TICK)(TMR_BENCH_DLY + ((i * 7919u) % TMR_BENCH_DLY_SPAN)),
+                    (OS_TICK)0,
+                    OS_OPT_TMR_ONE_SHOT,
+                    (OS_TMR_CALLBACK_PTR)0,
+                    (void *)0,
+                    &err);
+        (void)OSTmrStart(&TmrBenchTmr[i], &err);
+    }
+
+    for (i = 0; i < TMR_BENCH_SAMPLE_NBR; i++)
+    {
+        ix = (i * n) / TMR_BENCH_SAMPLE_NBR;        //Samples spread over all the delays
+
+        ts = TMR_BENCH_TS_GET();
+        (void)OSTmrStop(&TmrBenchTmr[ix], OS_OPT_TMR_NONE, (void *)0, &err);
+        stop += TMR_BENCH_TS_GET() - ts;
+
+        ts = TMR_BENCH_TS_GET();
+        (void)OSTmrStart(&TmrBenchTmr[ix], &err);
+        start += TMR_BENCH_TS_GET() - ts;
+
+        ts = TMR_BENCH_TS_GET();
+        (void)OSTmrStart(&TmrBenchTmr[ix], &err);
+        restart += TMR_BENCH_TS_GET() - ts;
+
+        ts = TMR_BENCH_TS_GET();
+        (void)OSTmrRemainGet(&TmrBenchTmr[ix], &err);
+        remain += TMR_BENCH_TS_GET() - ts;
+    }
+
+    printf("%6lu %10lu %10lu %10lu %10lu\n",
+           (unsigned long)n,
+           (unsigned long)(start / TMR_BENCH_SAMPLE_NBR),
+           (unsigned long)(restart / TMR_BENCH_SAMPLE_NBR),
+           (unsigned long)(stop / TMR_BENCH_SAMPLE_NBR),
+           (unsigned long)(remain / TMR_BENCH_SAMPLE_NBR));
+    fflush(stdout);
+
+    for (i = 0; i < n; i++)
+    {
+        (void)OSTmrDel(&TmrBenchTmr[i], &err);
+    }
+}
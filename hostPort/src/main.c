@@ -0,0 +1,196 @@
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <stdio.h>
+#include "os.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/* Task Stack Size */
+#define APP_TASK_START_STK_SIZE 128u
+#define LED3_TASK_STK_SIZE 128u
+#define LED4_TASK_STK_SIZE 128u
+
+/* Task Priority */
+#define APP_TASK_START_PRIO 1u
+#define LED3_TASK_PRIO 2u
+#define LED4_TASK_PRIO 3u
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/* Task Control Block */
+static OS_TCB AppTaskStartTCB;
+static OS_TCB LED3TaskTCB;
+static OS_TCB LED4TaskTCB;
+
+/* Task Stack */
+static CPU_STK AppTaskStartStk[APP_TASK_START_STK_SIZE];
+static CPU_STK LED3TaskStk[LED3_TASK_STK_SIZE];
+static CPU_STK LED4TaskStk[LED4_TASK_STK_SIZE];
+
+/* Serializes stdio between tasks (see os_cpu.h Note 2) */
+static OS_MUTEX AppPrintMutex;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void AppTaskStart(void *p_arg);
+static void LED3Task(void *p_arg);
+static void LED4Task(void *p_arg);
+static void AppPrint(const CPU_CHAR *p_str);
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int main(void)
+{
+	OS_ERR err;
+
+	CPU_Init();
+
+	OSInit(&err);
+
+	OSMutexCreate((OS_MUTEX *)&AppPrintMutex,
+				  (CPU_CHAR *)"App Print Mutex",
+				  (OS_ERR *)&err);
+
+	OSTaskCreate((OS_TCB *)&AppTaskStartTCB,
+				 (CPU_CHAR *)"App Task Start",
+				 (OS_TASK_PTR)AppTaskStart,
+				 (void *)0,
+				 (OS_PRIO)APP_TASK_START_PRIO,
+				 (CPU_STK *)&AppTaskStartStk[0],
+				 (CPU_STK_SIZE)APP_TASK_START_STK_SIZE / 10,
+				 (CPU_STK_SIZE)APP_TASK_START_STK_SIZE,
+				 (OS_MSG_QTY)5u,
+				 (OS_TICK)0u,
+				 (void *)0,
+				 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+				 (OS_ERR *)&err);
+
+	OSStart(&err);
+
+	return 0;
+}
+
+/*
+*********************************************************************************************************
+*                                              STARTUP TASK
+*********************************************************************************************************
+*/
+
+static void AppTaskStart(void *p_arg)
+{
+	OS_ERR err;
+
+	OS_CPU_SysTickInitFreq(OS_CPU_SYS_TICK_FREQ_HZ);
+
+	OSTaskCreate((OS_TCB *)&LED3TaskTCB,
+				 (CPU_CHAR *)"LED3 TASK",
+				 (OS_TASK_PTR)LED3Task,
+				 (void *)0,
+				 (OS_PRIO)LED3_TASK_PRIO,
+				 (CPU_STK *)&LED3TaskStk[0],
+				 (CPU_STK_SIZE)LED3_TASK_STK_SIZE / 10,
+				 (CPU_STK_SIZE)LED3_TASK_STK_SIZE,
+				 (OS_MSG_QTY)5u,
+				 (OS_TICK)0u,
+				 (void *)0,
+				 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+				 (OS_ERR *)&err);
+
+	OSTaskCreate((OS_TCB *)&LED4TaskTCB,
+				 (CPU_CHAR *)"LED4 TASK",
+				 (OS_TASK_PTR)LED4Task,
+				 (void *)0,
+				 (OS_PRIO)LED4_TASK_PRIO,
+				 (CPU_STK *)&LED4TaskStk[0],
+				 (CPU_STK_SIZE)LED4_TASK_STK_SIZE / 10,
+				 (CPU_STK_SIZE)LED4_TASK_STK_SIZE,
+				 (OS_MSG_QTY)5u,
+				 (OS_TICK)0u,
+				 (void *)0,
+				 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+				 (OS_ERR *)&err);
+}
+
+/*
+*********************************************************************************************************
+*                                                  TASKS
+*********************************************************************************************************
+*/
+
+static void LED3Task(void *p_arg)
+{
+	OS_ERR err;
+
+	while (DEF_TRUE)
+	{
+		AppPrint("LED3 toggle");
+
+		OSTimeDlyHMSM((CPU_INT16U)0,
+					  (CPU_INT16U)0,
+					  (CPU_INT16U)1u,
+					  (CPU_INT32U)0,
+					  (OS_OPT)OS_OPT_TIME_HMSM_STRICT,
+					  (OS_ERR *)&err);
+	}
+}
+
+static void LED4Task(void *p_arg)
+{
+	OS_ERR err;
+
+	while (DEF_TRUE)
+	{
+		AppPrint("LED4 toggle");
+
+		OSTimeDlyHMSM((CPU_INT16U)0,
+					  (CPU_INT16U)0,
+					  (CPU_INT16U)1u,
+					  (CPU_INT32U)0,
+					  (OS_OPT)OS_OPT_TIME_HMSM_STRICT,
+					  (OS_ERR *)&err);
+	}
+}
+
+/*
+*********************************************************************************************************
+*                                            LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static void AppPrint(const CPU_CHAR *p_str)
+{
+	OS_ERR err;
+
+	OSMutexPend((OS_MUTEX *)&AppPrintMutex,
+				(OS_TICK)0u,
+				(OS_OPT)OS_OPT_PEND_BLOCKING,
+				(CPU_TS *)0,
+				(OS_ERR *)&err);
+
+	printf("%10lu  %s\n", (unsigned long)OSTimeGet(&err), p_str);
+	fflush(stdout);
+
+	OSMutexPost((OS_MUTEX *)&AppPrintMutex,
+				(OS_OPT)OS_OPT_POST_NONE,
+				(OS_ERR *)&err);
+}
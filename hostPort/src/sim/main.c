@@ -0,0 +1,305 @@
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <stdio.h>
+#include "os.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/* Task Stack Size */
+#define APP_TASK_START_STK_SIZE 256u
+#define UART_TASK_STK_SIZE 256u
+
+/* Task Priority */
+#define APP_TASK_START_PRIO 1u
+#define UART_RECEIVE_TASK_PRIO 12u
+#define UART_TRANSMIT_TASK_PRIO 22u
+
+/* UART and LCD Display (same workload as serialSyn_display) */
+#define FILE_SIZE 1047u
+#define MAX_COLUMNS 14u
+#define MAX_ROWS 12
+
+/* Simulated hardware, in STM32F429 core cycles (OS_CPU_SYS_TICK_FREQ_HZ) */
+#define UART_BAUD_RATE 115200u
+#define UART_RX_CYCLES ((CPU_INT64U)FILE_SIZE * 10u * OS_CPU_SYS_TICK_FREQ_HZ / UART_BAUD_RATE) //8N1: 10 bits per byte
+#define UART_IRQ_CYCLES 400u            //HAL_UART_IRQHandler() and receive complete callback
+#define LCD_CLEAR_CYCLES 1500000u       //Fill the 240x320 frame buffer
+#define LCD_LINE_CYCLES 60000u          //Draw one line of text
+
+/* Length of the run */
+#define SIM_FILE_NBR 200u               //About 4 hours of virtual time
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/* Task Control Block */
+static OS_TCB AppTaskStartTCB;
+static OS_TCB UartTransmitTaskTCB;
+static OS_TCB UartReceiveTaskTCB;
+
+/* Task Stack */
+static CPU_STK AppTaskStartStk[APP_TASK_START_STK_SIZE];
+static CPU_STK UartTransmitTaskStk[UART_TASK_STK_SIZE];
+static CPU_STK UartReceiveTaskStk[UART_TASK_STK_SIZE];
+
+/* OS Kernal Objects */
+OS_SEM rxSem;
+
+/* UART */
+CPU_INT08U rxData[FILE_SIZE + MAX_COLUMNS];       //Room for the last, partial, line
+
+/* Results, printed by main() once the run is over */
+static CPU_INT64U rxIrqTime;            //Virtual time of the last receive interrupt
+static CPU_INT64U rxLatencyMax;         //Max receive interrupt to receive task latency
+static CPU_INT32U filesRx;
+static CPU_INT32U linesDisplayed;
+static CPU_INT32U displaySum;           //Checksum of all the characters displayed
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+/* Task Prototypes */
+static void AppTaskStart(void *p_arg);
+static void UartTransmitTask(void *p_arg);
+static void UartReceiveTask(void *p_arg);
+
+/* Simulated Hardware Prototypes */
+static void UartRxIrqHandler(void);
+static void UartReceiveIT(void);
+static void LCD_DisplayStringAtLine(CPU_INT08U line, const CPU_INT08U *p_str);
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int main(void)
+{
+    OS_ERR err;
+
+    CPU_Init();
+
+    OSInit(&err);
+
+    OSSemCreate((OS_SEM *)&rxSem,
+                (CPU_CHAR *)"Synchronization Semaphore",
+                (OS_SEM_CTR)0,
+                (OS_ERR *)&err);
+
+    OSTaskCreate((OS_TCB *)&AppTaskStartTCB,
+                 (CPU_CHAR *)"App Task Start",
+                 (OS_TASK_PTR)AppTaskStart,
+                 (void *)0,
+                 (OS_PRIO)APP_TASK_START_PRIO,
+                 (CPU_STK *)&AppTaskStartStk[0],
+                 (CPU_STK_SIZE)APP_TASK_START_STK_SIZE / 10,
+                 (CPU_STK_SIZE)APP_TASK_START_STK_SIZE,
+                 (OS_MSG_QTY)5u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+
+    OSStart(&err);      //Returns once UartReceiveTask calls OS_CPU_Stop()
+
+    printf("Virtual time      : %llu cycles (%llu s)\n",
+           (unsigned long long)OS_CPU_SimTimeGet(),
+           (unsigned long long)(OS_CPU_SimTimeGet() / OS_CPU_SYS_TICK_FREQ_HZ));
+    printf("OS ticks          : %lu\n", (unsigned long)OSTimeGet(&err));
+    printf("Files received    : %lu\n", (unsigned long)filesRx);
+    printf("Lines displayed   : %lu\n", (unsigned long)linesDisplayed);
+    printf("Display checksum  : 0x%08lx\n", (unsigned long)displaySum);
+    printf("Max Rx latency    : %llu cycles\n", (unsigned long long)rxLatencyMax);
+
+    return 0;
+}
+
+/*
+*********************************************************************************************************
+*                                              STARTUP TASK
+*********************************************************************************************************
+*/
+
+static void AppTaskStart(void *p_arg)
+{
+    OS_ERR err;
+
+    OS_CPU_SysTickInitFreq(OS_CPU_SYS_TICK_FREQ_HZ);
+
+    CPU_IntSrcHandlerSet(CPU_INT_EXT0, UartRxIrqHandler);       //UART interrupt Init
+    CPU_IntSrcEn(CPU_INT_EXT0);
+    UartReceiveIT();
+
+    OSTaskCreate((OS_TCB *)&UartReceiveTaskTCB,
+                 (CPU_CHAR *)"Uart Receive Task",
+                 (OS_TASK_PTR)UartReceiveTask,
+                 (void *)0,
+                 (OS_PRIO)UART_RECEIVE_TASK_PRIO,
+                 (CPU_STK *)&UartReceiveTaskStk[0],
+                 (CPU_STK_SIZE)UART_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)UART_TASK_STK_SIZE,
+                 (OS_MSG_QTY)5u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+
+    OSTaskCreate((OS_TCB *)&UartTransmitTaskTCB,
+                 (CPU_CHAR *)"Uart Transmit Task",
+                 (OS_TASK_PTR)UartTransmitTask,
+                 (void *)0,
+                 (OS_PRIO)UART_TRANSMIT_TASK_PRIO,
+                 (CPU_STK *)&UartTransmitTaskStk[0],
+                 (CPU_STK_SIZE)UART_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)UART_TASK_STK_SIZE,
+                 (OS_MSG_QTY)5u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+}
+
+/*
+*********************************************************************************************************
+*                                                  TASKS
+*********************************************************************************************************
+*/
+
+static void UartReceiveTask(void *p_arg)
+{
+    OS_ERR err;
+    CPU_TS ts;
+    CPU_INT64U latency;
+
+    while (DEF_TRUE)
+    {
+        OSSemPend((OS_SEM *)&rxSem,     //Wait for a semaphore sent by UART interrupt
+                  (OS_TICK)0,
+                  (OS_OPT)OS_OPT_PEND_BLOCKING,
+                  (CPU_TS *)&ts,
+                  (OS_ERR *)&err);
+
+        latency = OS_CPU_SimTimeGet() - rxIrqTime;
+        if (latency > rxLatencyMax)
+        {
+            rxLatencyMax = latency;
+        }
+
+        for (CPU_INT32U length = 0; length < FILE_SIZE; length += MAX_COLUMNS)      //Slice whole received data into message queues
+        {
+            OSTaskQPost((OS_TCB *)&UartTransmitTaskTCB,     //Send a message to transmit task
+                        (void *)&rxData[length],
+                        (OS_MSG_SIZE)14,
+                        (OS_OPT)OS_OPT_POST_FIFO,
+                        (OS_ERR *)&err);
+
+            OSTaskSemPend((OS_TICK)0,       //Wait for a notification to send next message
+                          (OS_OPT)OS_OPT_PEND_BLOCKING,
+                          (CPU_TS *)&ts,
+                          (OS_ERR *)&err);
+        }
+
+        if (++filesRx >= SIM_FILE_NBR)
+        {
+            OS_CPU_Stop();      //End of the run, back to main()
+        }
+        UartReceiveIT();        //Activate UART interrupt again
+    }
+}
+
+static void UartTransmitTask(void *p_arg)
+{
+    OS_ERR err;
+    CPU_INT08U *txData;
+    OS_MSG_SIZE msg_size;
+    CPU_TS ts;
+    CPU_INT08U line = 0;
+
+    while (DEF_TRUE)
+    {
+        txData = OSTaskQPend((OS_TICK)0,        //Wait for a message from receive task
+                             (OS_OPT)OS_OPT_PEND_BLOCKING,
+                             (OS_MSG_SIZE *)&msg_size,
+                             (CPU_TS *)&ts,
+                             (OS_ERR *)&err);
+
+        if (++line > MAX_ROWS)      //Decide which line to display
+        {
+            OS_CPU_SimConsume(LCD_CLEAR_CYCLES);
+            line = 1;
+        }
+
+        LCD_DisplayStringAtLine(line, txData);      //Display the message
+
+        OSTimeDlyHMSM((CPU_INT16U)0,
+                      (CPU_INT16U)0,
+                      (CPU_INT16U)1u,
+                      (CPU_INT32U)0,
+                      (OS_OPT)OS_OPT_TIME_HMSM_STRICT,
+                      (OS_ERR *)&err);
+
+        OSTaskSemPost((OS_TCB *)&UartReceiveTaskTCB,        //Notify receive task to send next message
+                      (OS_OPT)OS_OPT_POST_NONE,
+                      (OS_ERR *)&err);
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                      SIMULATED HARDWARE
+*********************************************************************************************************
+*/
+
+static void UartRxIrqHandler(void)      //Receive completed
+{
+    OS_ERR err;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();
+    CPU_CRITICAL_EXIT();
+
+    rxIrqTime = OS_CPU_SimTimeGet();
+    OS_CPU_SimConsume(UART_IRQ_CYCLES);
+    for (CPU_INT32U i = 0; i < FILE_SIZE; i++)      //Bytes of the file, different for every file
+    {
+        rxData[i] = (CPU_INT08U)(' ' + ((i + filesRx) % 95u));
+    }
+
+    OSSemPost((OS_SEM *)&rxSem,
+              (OS_OPT)OS_OPT_POST_1,
+              (OS_ERR *)&err);
+
+    OSIntExit();
+}
+
+static void UartReceiveIT(void)     //Receive FILE_SIZE bytes at UART_BAUD_RATE
+{
+    OS_CPU_SimIntPend(CPU_INT_EXT0, UART_RX_CYCLES);
+}
+
+static void LCD_DisplayStringAtLine(CPU_INT08U line, const CPU_INT08U *p_str)
+{
+    for (CPU_INT32U i = 0; i < MAX_COLUMNS; i++)
+    {
+        displaySum = (displaySum * 31u) + (CPU_INT32U)line + p_str[i];
+    }
+    linesDisplayed++;
+
+    OS_CPU_SimConsume(LCD_LINE_CYCLES);
+}
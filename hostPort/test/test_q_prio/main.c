@@ -0,0 +1,459 @@
+/*
+*********************************************************************************************************
+*                                    PRIORITY MESSAGE QUEUE CHECK
+*
+* Argument checks, ordering across levels and with OSQPost() FIFO/LIFO mixed in, direct hand-off to a
+* waiting task, blocking posts parked on a full queue, and a long random run of OSQPostPrio()/OSQPend()/OSQPendN() against a reference model
+* (one FIFO per priority level).  Runs on virtual time: pio test -e sim
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <stdio.h>
+#include <unity.h>
+#include "os.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/* Task Stack Size */
+#define CHK_TASK_STK_SIZE 1024u
+
+/* Task Priority */
+#define CHK_WAIT_TASK_PRIO 1u
+#define CHK_START_TASK_PRIO 2u
+
+/* Queue */
+#define CHK_Q_SIZE 16u
+#define CHK_PRIO_NBR 32u
+#define CHK_MODEL_STEPS 2000000u
+
+#define CHK_MSG(prio, i) ((void *)(CPU_ADDR)((prio) * 1000u + (i)))
+
+#define CHK(cond)                                                      \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("%s:%d: %s\n", __FILE__, __LINE__, #cond);          \
+            chkErrs++;                                                 \
+        }                                                              \
+    } while (0)
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/* Task Control Block */
+static OS_TCB ChkStartTaskTCB;
+static OS_TCB ChkWaitTaskTCB;
+
+/* Task Stack */
+static CPU_STK ChkStartTaskStk[CHK_TASK_STK_SIZE];
+static CPU_STK ChkWaitTaskStk[CHK_TASK_STK_SIZE];
+
+/* OS Kernel Objects */
+static OS_Q chkQ;
+static OS_MSG *chkQTails[CHK_PRIO_NBR];
+
+/* Reference model, one FIFO per priority level */
+static CPU_INT32U chkRef[CHK_PRIO_NBR][CHK_Q_SIZE];
+static CPU_INT32U chkRefHead[CHK_PRIO_NBR];
+static CPU_INT32U chkRefTail[CHK_PRIO_NBR];
+static CPU_INT32U chkRefNbr;
+
+/* Results */
+static CPU_INT32U chkErrs;
+static CPU_INT32U chkWaitGot;
+static void *chkWaitMsg;
+static OS_ERR chkPostErr;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void ChkStartTask(void *p_arg);
+static void ChkWaitTask(void *p_arg);
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+static void ChkPostTask(void *p_arg);
+#endif
+static void ChkArgs(void);
+static void ChkOrder(void);
+static void ChkHandOff(void);
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+static void ChkPostBlocking(void);
+#endif
+static void ChkModel(void);
+static CPU_INT32U ChkModelGet(void);
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void test_q_prio(void)
+{
+    OS_ERR err;
+
+    CPU_Init();
+
+    OSInit(&err);
+    TEST_ASSERT_EQUAL_UINT32(OS_ERR_NONE, err);
+
+    OSTaskCreate((OS_TCB *)&ChkStartTaskTCB,
+                 (CPU_CHAR *)"Check Start Task",
+                 (OS_TASK_PTR)ChkStartTask,
+                 (void *)0,
+                 (OS_PRIO)CHK_START_TASK_PRIO,
+                 (CPU_STK *)&ChkStartTaskStk[0],
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+
+    OSStart(&err);      //Returns once ChkStartTask calls OS_CPU_Stop()
+
+    TEST_ASSERT_EQUAL_UINT32(0u, chkErrs);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_q_prio);
+    return UNITY_END();
+}
+
+/*
+*********************************************************************************************************
+*                                                  TASKS
+*********************************************************************************************************
+*/
+
+static void ChkStartTask(void *p_arg)
+{
+    OS_ERR err;
+
+    OS_CPU_SysTickInitFreq(OS_CPU_SYS_TICK_FREQ_HZ);
+
+    OSQCreate(&chkQ, (CPU_CHAR *)"Check Queue", CHK_Q_SIZE, &err);
+    CHK(err == OS_ERR_NONE);
+
+    ChkArgs();
+    ChkOrder();
+    ChkHandOff();
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+    ChkPostBlocking();
+#endif
+    ChkModel();
+
+    OSQDel(&chkQ, OS_OPT_DEL_ALWAYS, &err);
+    CHK((chkQ.MsgQ.PrioTailTbl == (OS_MSG **)0) && (OSMsgPool.NbrFree == OS_CFG_MSG_POOL_SIZE));
+
+    OS_CPU_Stop();      //End of the run, back to test_q_prio()
+}
+
+static void ChkWaitTask(void *p_arg)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+
+    while (DEF_TRUE)
+    {
+        chkWaitMsg = OSQPend(&chkQ, 0u, OS_OPT_PEND_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        chkWaitGot++;
+    }
+}
+
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+static void ChkPostTask(void *p_arg)
+{
+    OS_ERR err;
+
+    OSQPost(&chkQ, CHK_MSG(0u, 7u), 0u, (OS_OPT)(CPU_ADDR)p_arg | OS_OPT_POST_BLOCKING, &chkPostErr);
+    OSTaskDel((OS_TCB *)0, &err);
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                               CHECKS
+*********************************************************************************************************
+*/
+
+static void ChkArgs(void)
+{
+    OS_ERR err;
+
+    OSQPostPrio(&chkQ, CHK_MSG(0u, 0u), 0u, 0u, OS_OPT_POST_NONE, &err);        //Not a priority queue yet
+    CHK(err == OS_ERR_PRIO_INVALID);
+    OSQPrioSet(&chkQ, chkQTails, 0u, &err);
+    CHK(err == OS_ERR_PRIO_INVALID);
+    OSQPrioSet(&chkQ, chkQTails, CHK_PRIO_NBR + 1u, &err);
+    CHK(err == OS_ERR_PRIO_INVALID);
+    OSQPrioSet((OS_Q *)0, chkQTails, 4u, &err);
+    CHK(err == OS_ERR_OBJ_PTR_NULL);
+
+    OSQPost(&chkQ, CHK_MSG(0u, 0u), 0u, OS_OPT_POST_FIFO, &err);
+    OSQPrioSet(&chkQ, chkQTails, 4u, &err);                                     //Only on an empty queue
+    CHK(err == OS_ERR_Q_NOT_EMPTY);
+    OSQFlush(&chkQ, &err);
+
+    OSQPrioSet(&chkQ, chkQTails, 4u, &err);
+    CHK(err == OS_ERR_NONE);
+    OSQPostPrio(&chkQ, CHK_MSG(0u, 0u), 0u, 4u, OS_OPT_POST_NONE, &err);
+    CHK(err == OS_ERR_PRIO_INVALID);
+    OSQPostPrio(&chkQ, CHK_MSG(0u, 0u), 0u, 0u, OS_OPT_POST_LIFO, &err);
+    CHK(err == OS_ERR_OPT_INVALID);
+}
+
+static void ChkOrder(void)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+    OS_MSG_SIZE msg_size_tbl[8];
+    OS_MSG_QTY msg_nbr;
+    void *p_msg;
+    void *p_msg_tbl[8];
+    CPU_INT32U i;
+
+    OSQPostPrio(&chkQ, CHK_MSG(2u, 0u), 2u, 2u, OS_OPT_POST_NONE, &err);
+    CHK(err == OS_ERR_NONE);
+    OSQPostPrio(&chkQ, CHK_MSG(3u, 0u), 3u, 3u, OS_OPT_POST_NONE, &err);
+    OSQPostPrio(&chkQ, CHK_MSG(1u, 0u), 1u, 1u, OS_OPT_POST_NONE, &err);
+    OSQPostPrio(&chkQ, CHK_MSG(2u, 1u), 2u, 2u, OS_OPT_POST_NONE, &err);
+    OSQPost(&chkQ, CHK_MSG(3u, 1u), 3u, OS_OPT_POST_FIFO, &err);                //FIFO goes to the lowest level
+    OSQPost(&chkQ, CHK_MSG(0u, 0u), 0u, OS_OPT_POST_LIFO, &err);                //LIFO goes to level 0
+    OSQPost(&chkQ, CHK_MSG(0u, 1u), 0u, OS_OPT_POST_LIFO, &err);
+    OSQPostPrio(&chkQ, CHK_MSG(1u, 1u), 1u, 1u, OS_OPT_POST_NONE, &err);
+
+    p_msg = OSQPend(&chkQ, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+    CHK((p_msg == CHK_MSG(0u, 0u)) && (msg_size == 0u));
+    p_msg = OSQPend(&chkQ, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+    CHK(p_msg == CHK_MSG(0u, 1u));
+
+    OSQPostPrio(&chkQ, CHK_MSG(1u, 2u), 1u, 1u, OS_OPT_POST_NONE, &err);        //Into a partly drained queue
+    OSQPostPrio(&chkQ, CHK_MSG(0u, 2u), 0u, 0u, OS_OPT_POST_NONE, &err);
+    msg_nbr = OSQPendN(&chkQ, p_msg_tbl, msg_size_tbl, 3u, 0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+    CHK((msg_nbr == 3u) &&
+        (p_msg_tbl[0] == CHK_MSG(0u, 2u)) &&
+        (p_msg_tbl[1] == CHK_MSG(1u, 0u)) &&
+        (p_msg_tbl[2] == CHK_MSG(1u, 1u)));
+
+    OSQPostPrio(&chkQ, CHK_MSG(3u, 2u), 3u, 3u, OS_OPT_POST_NONE, &err);
+    OSQPostPrio(&chkQ, CHK_MSG(2u, 2u), 2u, 2u, OS_OPT_POST_NONE, &err);
+    msg_nbr = OSQPendN(&chkQ, p_msg_tbl, msg_size_tbl, 8u, 0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+    CHK((msg_nbr == 7u) &&
+        (p_msg_tbl[0] == CHK_MSG(1u, 2u)) &&
+        (p_msg_tbl[1] == CHK_MSG(2u, 0u)) &&
+        (p_msg_tbl[2] == CHK_MSG(2u, 1u)) &&
+        (p_msg_tbl[3] == CHK_MSG(2u, 2u)) &&
+        (p_msg_tbl[4] == CHK_MSG(3u, 0u)) &&
+        (p_msg_tbl[5] == CHK_MSG(3u, 1u)) &&
+        (p_msg_tbl[6] == CHK_MSG(3u, 2u)));
+    CHK((chkQ.MsgQ.NbrEntries == 0u) && (chkQ.MsgQ.PrioMap == 0u));
+    CHK((chkQ.MsgQ.OutPtr == (OS_MSG *)0) && (chkQ.MsgQ.InPtr == (OS_MSG *)0));
+
+    OSQPostPrio(&chkQ, CHK_MSG(1u, 0u), 0u, 1u, OS_OPT_POST_NONE, &err);
+    OSQPostPrio(&chkQ, CHK_MSG(3u, 0u), 0u, 3u, OS_OPT_POST_NONE, &err);
+    OSQPostPrio(&chkQ, CHK_MSG(2u, 0u), 0u, 2u, OS_OPT_POST_NONE, &err);
+    CHK(chkQ.MsgQ.InPtr->MsgPtr == CHK_MSG(3u, 0u));                            //InPtr stays on the last entry
+
+    for (i = 3u; i < CHK_Q_SIZE; i++)
+    {
+        OSQPostPrio(&chkQ, CHK_MSG(3u, 9u), 0u, 3u, OS_OPT_POST_NONE, &err);
+    }
+    CHK(err == OS_ERR_NONE);
+    OSQPostPrio(&chkQ, CHK_MSG(0u, 9u), 0u, 0u, OS_OPT_POST_NONE, &err);
+    CHK(err == OS_ERR_Q_MAX);
+    CHK((OSQFlush(&chkQ, &err) == CHK_Q_SIZE) && (chkQ.MsgQ.PrioMap == 0u));
+}
+
+static void ChkHandOff(void)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+    void *p_msg;
+
+    OSTaskCreate((OS_TCB *)&ChkWaitTaskTCB,
+                 (CPU_CHAR *)"Check Wait Task",
+                 (OS_TASK_PTR)ChkWaitTask,
+                 (void *)0,
+                 (OS_PRIO)CHK_WAIT_TASK_PRIO,
+                 (CPU_STK *)&ChkWaitTaskStk[0],
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+
+    OSQPostPrio(&chkQ, CHK_MSG(2u, 5u), 0u, 2u, OS_OPT_POST_NONE, &err);        //Straight to the waiting task
+    CHK((err == OS_ERR_NONE) && (chkWaitGot == 1u) && (chkWaitMsg == CHK_MSG(2u, 5u)));
+    CHK(chkQ.MsgQ.NbrEntries == 0u);
+    OSTaskDel(&ChkWaitTaskTCB, &err);
+
+    OSQPrioSet(&chkQ, (OS_MSG **)0, 0u, &err);                                  //Back to a plain queue
+    CHK(err == OS_ERR_NONE);
+    OSQPost(&chkQ, CHK_MSG(0u, 1u), 0u, OS_OPT_POST_FIFO, &err);
+    OSQPost(&chkQ, CHK_MSG(0u, 2u), 0u, OS_OPT_POST_LIFO, &err);
+    p_msg = OSQPend(&chkQ, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+    CHK(p_msg == CHK_MSG(0u, 2u));
+    OSQFlush(&chkQ, &err);
+}
+
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+static void ChkPostBlocking(void)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+    OS_MSG_QTY i;
+    void *p_msg;
+    void *p_msg_last;
+
+    OSQPrioSet(&chkQ, chkQTails, CHK_PRIO_NBR, &err);
+    CHK(err == OS_ERR_NONE);
+    for (i = 0u; i < CHK_Q_SIZE; i++)
+    {
+        OSQPostPrio(&chkQ, CHK_MSG(1u, i), 0u, 1u, OS_OPT_POST_NONE, &err);
+    }
+
+    chkPostErr = OS_ERR_STATUS_INVALID;                                         //A LIFO post keeps priority 0
+    OSTaskCreate((OS_TCB *)&ChkWaitTaskTCB,
+                 (CPU_CHAR *)"Check Post Task",
+                 (OS_TASK_PTR)ChkPostTask,
+                 (void *)(CPU_ADDR)OS_OPT_POST_LIFO,
+                 (OS_PRIO)CHK_WAIT_TASK_PRIO,
+                 (CPU_STK *)&ChkWaitTaskStk[0],
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+    CHK(ChkWaitTaskTCB.PendOn == OS_TASK_PEND_ON_Q_POST);
+    p_msg = OSQPend(&chkQ, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+    CHK((p_msg == CHK_MSG(1u, 0u)) && (chkPostErr == OS_ERR_NONE));
+    p_msg = OSQPend(&chkQ, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+    CHK(p_msg == CHK_MSG(0u, 7u));
+
+    OSQPostPrio(&chkQ, CHK_MSG(0u, 8u), 0u, 0u, OS_OPT_POST_NONE, &err);         //A FIFO post goes to the lowest priority
+    CHK(chkQ.MsgQ.NbrEntries == CHK_Q_SIZE);
+    chkPostErr = OS_ERR_STATUS_INVALID;
+    OSTaskCreate((OS_TCB *)&ChkWaitTaskTCB,
+                 (CPU_CHAR *)"Check Post Task",
+                 (OS_TASK_PTR)ChkPostTask,
+                 (void *)(CPU_ADDR)OS_OPT_POST_FIFO,
+                 (OS_PRIO)CHK_WAIT_TASK_PRIO,
+                 (CPU_STK *)&ChkWaitTaskStk[0],
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+    p_msg = OSQPend(&chkQ, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+    CHK((p_msg == CHK_MSG(0u, 8u)) && (chkPostErr == OS_ERR_NONE));
+    p_msg_last = (void *)0;
+    while (chkQ.MsgQ.NbrEntries > 0u)
+    {
+        p_msg_last = OSQPend(&chkQ, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+    }
+    CHK(p_msg_last == CHK_MSG(0u, 7u));
+
+    OSQPrioSet(&chkQ, (OS_MSG **)0, 0u, &err);
+    CHK(err == OS_ERR_NONE);
+}
+#endif
+
+static void ChkModel(void)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+    OS_MSG_SIZE msg_size_tbl[8];
+    OS_MSG_QTY msg_nbr;
+    OS_MSG_QTY i;
+    OS_PRIO prio;
+    void *p_msg;
+    void *p_msg_tbl[8];
+    CPU_INT32U step;
+    CPU_INT32U seed = 1u;
+
+    OSQPrioSet(&chkQ, chkQTails, CHK_PRIO_NBR, &err);
+    CHK(err == OS_ERR_NONE);
+
+    for (step = 0u; (step < CHK_MODEL_STEPS) && (chkErrs == 0u); step++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        if ((((seed >> 16) % 3u) != 0u) && (chkRefNbr < CHK_Q_SIZE))
+        {
+            if (((seed >> 20) & 7u) == 0u)
+            {
+                prio = CHK_PRIO_NBR - 1u;
+                OSQPost(&chkQ, (void *)(CPU_ADDR)step, 0u, OS_OPT_POST_FIFO, &err);
+            }
+            else
+            {
+                prio = (OS_PRIO)((seed >> 8) % CHK_PRIO_NBR);
+                OSQPostPrio(&chkQ, (void *)(CPU_ADDR)step, 0u, prio, OS_OPT_POST_NO_SCHED, &err);
+            }
+            CHK(err == OS_ERR_NONE);
+            chkRef[prio][chkRefTail[prio]++ % CHK_Q_SIZE] = step;
+            chkRefNbr++;
+        }
+        else if ((((seed >> 24) & 1u) != 0u) && (chkRefNbr > 0u))
+        {
+            msg_nbr = OSQPendN(&chkQ, p_msg_tbl, msg_size_tbl, (OS_MSG_QTY)(1u + (seed >> 12) % 8u),
+                               0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+            for (i = 0u; i < msg_nbr; i++)
+            {
+                CHK((CPU_INT32U)(CPU_ADDR)p_msg_tbl[i] == ChkModelGet());
+            }
+        }
+        else if (chkRefNbr > 0u)
+        {
+            p_msg = OSQPend(&chkQ, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+            CHK((err == OS_ERR_NONE) && ((CPU_INT32U)(CPU_ADDR)p_msg == ChkModelGet()));
+        }
+        CHK(chkQ.MsgQ.NbrEntries == chkRefNbr);
+    }
+}
+
+static CPU_INT32U ChkModelGet(void)     //Oldest message of the highest non-empty level
+{
+    OS_PRIO prio;
+
+    for (prio = 0u; prio < CHK_PRIO_NBR; prio++)
+    {
+        if (chkRefHead[prio] != chkRefTail[prio])
+        {
+            chkRefNbr--;
+            return chkRef[prio][chkRefHead[prio]++ % CHK_Q_SIZE];
+        }
+    }
+    return 0xFFFFFFFFu;
+}
@@ -0,0 +1,374 @@
+/*
+*********************************************************************************************************
+*                                    TIMER WHEEL RANDOMIZED CHECK
+*
+* Control tasks, and the timer callbacks themselves, start, stop, delete, re-create and query one-shot
+* and periodic timers at random.  Every callback must run on the exact tick its timer was due, and
+* OSTmrRemainGet() must agree with the expected expiry.  Runs on virtual time: pio test -e sim
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <stdio.h>
+#include <unity.h>
+#include "os.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/* Task Stack Size */
+#define CHK_TASK_STK_SIZE 1024u
+
+/* Task Priority */
+#define CHK_START_TASK_PRIO 5u
+#define CHK_CTL_TASK_PRIO 10u           //Control tasks use CHK_CTL_TASK_PRIO .. + CHK_CTL_TASK_NBR - 1
+
+/* Workload */
+#define CHK_TMR_NBR 400u
+#define CHK_CTL_TASK_NBR 4u
+#define CHK_RUN_TICKS 5000000u
+#define CHK_TICKS_PER_TMR_TICK (OS_CFG_TICK_RATE_HZ / OS_CFG_TMR_TASK_RATE_HZ)
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/* Task Control Block */
+static OS_TCB ChkStartTaskTCB;
+static OS_TCB ChkCtlTaskTCB[CHK_CTL_TASK_NBR];
+
+/* Task Stack */
+static CPU_STK ChkStartTaskStk[CHK_TASK_STK_SIZE];
+static CPU_STK ChkCtlTaskStk[CHK_CTL_TASK_NBR][CHK_TASK_STK_SIZE];
+
+/* Timers and what the check expects of them */
+static OS_TMR chkTmr[CHK_TMR_NBR];
+static OS_TICK chkTmrDly[CHK_TMR_NBR];
+static OS_TICK chkTmrPeriod[CHK_TMR_NBR];
+static OS_TICK chkTmrExpire[CHK_TMR_NBR];         //Tick the next callback is due on
+static CPU_BOOLEAN chkTmrCreated[CHK_TMR_NBR];
+static CPU_BOOLEAN chkTmrRunning[CHK_TMR_NBR];
+
+/* Results */
+static CPU_INT32U chkErrs;
+static CPU_INT32U chkFires;
+static CPU_INT32U chkStarts;
+static CPU_INT32U chkStops;
+static CPU_INT32U chkRemainGets;
+static CPU_INT32U chkCallbackSeed = 99u;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void ChkStartTask(void *p_arg);
+static void ChkCtlTask(void *p_arg);
+static void ChkTmrCallback(void *p_tmr, void *p_arg);
+static void ChkAction(CPU_INT32U *p_seed);
+static void ChkTmrCreate(CPU_INT32U ix, CPU_INT32U *p_seed);
+static void ChkTmrStart(CPU_INT32U ix);
+static OS_TICK ChkNow(void);
+static CPU_INT32U ChkRand(CPU_INT32U *p_seed);
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void test_tmr_wheel(void)
+{
+    OS_ERR err;
+
+    CPU_Init();
+
+    OSInit(&err);
+    TEST_ASSERT_EQUAL_UINT32(OS_ERR_NONE, err);
+
+    OSTaskCreate((OS_TCB *)&ChkStartTaskTCB,
+                 (CPU_CHAR *)"Check Start Task",
+                 (OS_TASK_PTR)ChkStartTask,
+                 (void *)0,
+                 (OS_PRIO)CHK_START_TASK_PRIO,
+                 (CPU_STK *)&ChkStartTaskStk[0],
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+
+    OSStart(&err);      //Returns once ChkStartTask calls OS_CPU_Stop()
+
+    printf("fires %lu starts %lu stops %lu remain %lu\n",
+           (unsigned long)chkFires,
+           (unsigned long)chkStarts,
+           (unsigned long)chkStops,
+           (unsigned long)chkRemainGets);
+
+    TEST_ASSERT_EQUAL_UINT32(0u, chkErrs);
+    TEST_ASSERT_TRUE(chkFires > 0u);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_tmr_wheel);
+    return UNITY_END();
+}
+
+/*
+*********************************************************************************************************
+*                                                  TASKS
+*********************************************************************************************************
+*/
+
+static void ChkStartTask(void *p_arg)
+{
+    OS_ERR err;
+    CPU_INT32U i;
+
+    OS_CPU_SysTickInitFreq(OS_CPU_SYS_TICK_FREQ_HZ);
+
+    for (i = 0; i < CHK_CTL_TASK_NBR; i++)
+    {
+        OSTaskCreate((OS_TCB *)&ChkCtlTaskTCB[i],
+                     (CPU_CHAR *)"Check Control Task",
+                     (OS_TASK_PTR)ChkCtlTask,
+                     (void *)(CPU_ADDR)i,
+                     (OS_PRIO)(CHK_CTL_TASK_PRIO + i),
+                     (CPU_STK *)&ChkCtlTaskStk[i][0],
+                     (CPU_STK_SIZE)CHK_TASK_STK_SIZE / 10,
+                     (CPU_STK_SIZE)CHK_TASK_STK_SIZE,
+                     (OS_MSG_QTY)0u,
+                     (OS_TICK)0u,
+                     (void *)0,
+                     (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                     (OS_ERR *)&err);
+    }
+
+    OSTimeDly((OS_TICK)(CHK_RUN_TICKS + 10u),
+              (OS_OPT)OS_OPT_TIME_DLY,
+              (OS_ERR *)&err);
+
+    OS_CPU_Stop();      //End of the run, back to test_tmr_wheel()
+}
+
+static void ChkCtlTask(void *p_arg)
+{
+    OS_ERR err;
+    CPU_INT32U seed = 1u + (CPU_INT32U)(CPU_ADDR)p_arg * 7919u;
+
+    while (OSTickCtr < CHK_RUN_TICKS)
+    {
+        OSTimeDly((OS_TICK)(1u + ChkRand(&seed) % 150u),
+                  (OS_OPT)OS_OPT_TIME_DLY,
+                  (OS_ERR *)&err);
+        ChkAction(&seed);
+    }
+
+    OSTaskSuspend((OS_TCB *)0, &err);
+}
+
+/*
+*********************************************************************************************************
+*                                            TIMER CALLBACK
+*********************************************************************************************************
+*/
+
+static void ChkTmrCallback(void *p_tmr, void *p_arg)
+{
+    CPU_INT32U ix = (CPU_INT32U)(CPU_ADDR)p_arg;
+
+    (void)p_tmr;
+
+    if ((chkTmrRunning[ix] == DEF_FALSE) ||
+        (OSTmrTaskTickBase != chkTmrExpire[ix]))
+    {
+        printf("timer %lu fired at %lu, due %lu\n",
+               (unsigned long)ix,
+               (unsigned long)OSTmrTaskTickBase,
+               (unsigned long)chkTmrExpire[ix]);
+        chkErrs++;
+    }
+    chkFires++;
+
+    if (chkTmrPeriod[ix] != 0u)
+    {
+        chkTmrExpire[ix] = OSTmrTaskTickBase + chkTmrPeriod[ix] * CHK_TICKS_PER_TMR_TICK;
+    }
+    else
+    {
+        chkTmrRunning[ix] = DEF_FALSE;
+    }
+
+    if ((ChkRand(&chkCallbackSeed) % 4u) == 0u)     //Timer API calls from inside a callback
+    {
+        ChkAction(&chkCallbackSeed);
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                           RANDOM ACTIONS
+*********************************************************************************************************
+*/
+
+static void ChkAction(CPU_INT32U *p_seed)
+{
+    OS_ERR err;
+    OS_TICK remain;
+    OS_TICK expect;
+    OS_STATE state;
+    CPU_INT32U ix = ChkRand(p_seed) % CHK_TMR_NBR;
+    CPU_INT32U action = ChkRand(p_seed) % 10u;
+
+    if (chkTmrCreated[ix] == DEF_FALSE)
+    {
+        ChkTmrCreate(ix, p_seed);
+        return;
+    }
+
+    if (action < 4u)
+    {
+        ChkTmrStart(ix);
+    }
+    else if (action < 6u)
+    {
+        OSTmrStop(&chkTmr[ix], OS_OPT_TMR_NONE, (void *)0, &err);
+        chkTmrRunning[ix] = DEF_FALSE;
+        chkStops++;
+    }
+    else if (action < 7u)
+    {
+        OSTmrDel(&chkTmr[ix], &err);
+        chkTmrCreated[ix] = DEF_FALSE;
+        chkTmrRunning[ix] = DEF_FALSE;
+    }
+    else
+    {
+        remain = OSTmrRemainGet(&chkTmr[ix], &err);
+        state = OSTmrStateGet(&chkTmr[ix], &err);
+        if ((chkTmrRunning[ix] == DEF_TRUE) && (state == OS_TMR_STATE_RUNNING))
+        {
+            expect = (chkTmrExpire[ix] > ChkNow()) ? (chkTmrExpire[ix] - ChkNow()) / CHK_TICKS_PER_TMR_TICK : 0u;
+            if (remain != expect)
+            {
+                printf("timer %lu remain %lu, expected %lu\n",
+                       (unsigned long)ix,
+                       (unsigned long)remain,
+                       (unsigned long)expect);
+                chkErrs++;
+            }
+        }
+        chkRemainGets++;
+    }
+}
+
+static void ChkTmrCreate(CPU_INT32U ix, CPU_INT32U *p_seed)
+{
+    OS_ERR err;
+    OS_TICK dly;
+    CPU_INT32U r = ChkRand(p_seed);
+
+    switch (r % 5u)                     //Delays on every level of the wheel, and past its span
+    {
+        case 0u:
+             dly = 1u + ChkRand(p_seed) % 3u;
+             break;
+
+        case 1u:
+             dly = 1u + ChkRand(p_seed) % 60u;
+             break;
+
+        case 2u:
+             dly = 1u + ChkRand(p_seed) % 3000u;
+             break;
+
+        case 3u:
+             dly = 10000u + ChkRand(p_seed) % 30000u;
+             break;
+
+        default:
+             dly = 1u + ChkRand(p_seed) % 400u;
+             break;
+    }
+
+    if ((r & 0x100u) != 0u)
+    {
+        chkTmrDly[ix] = ((r & 0x200u) != 0u) ? 0u : dly;
+        chkTmrPeriod[ix] = 1u + ChkRand(p_seed) % 50u;
+        OSTmrCreate(&chkTmr[ix], (CPU_CHAR *)"Check Timer", chkTmrDly[ix], chkTmrPeriod[ix],
+                    OS_OPT_TMR_PERIODIC, (OS_TMR_CALLBACK_PTR)ChkTmrCallback, (void *)(CPU_ADDR)ix, &err);
+    }
+    else
+    {
+        chkTmrDly[ix] = dly;
+        chkTmrPeriod[ix] = 0u;
+        OSTmrCreate(&chkTmr[ix], (CPU_CHAR *)"Check Timer", chkTmrDly[ix], 0u,
+                    OS_OPT_TMR_ONE_SHOT, (OS_TMR_CALLBACK_PTR)ChkTmrCallback, (void *)(CPU_ADDR)ix, &err);
+    }
+    if (err != OS_ERR_NONE)
+    {
+        printf("timer %lu create err %u\n", (unsigned long)ix, (unsigned)err);
+        chkErrs++;
+    }
+
+    chkTmrCreated[ix] = DEF_TRUE;
+    chkTmrRunning[ix] = DEF_FALSE;
+}
+
+static void ChkTmrStart(CPU_INT32U ix)
+{
+    OS_ERR err;
+    OS_TICK first = (chkTmrDly[ix] != 0u) ? chkTmrDly[ix] : chkTmrPeriod[ix];
+
+    OSTmrStart(&chkTmr[ix], &err);
+    if (err != OS_ERR_NONE)
+    {
+        printf("timer %lu start err %u\n", (unsigned long)ix, (unsigned)err);
+        chkErrs++;
+    }
+
+    chkTmrExpire[ix] = ChkNow() + first * CHK_TICKS_PER_TMR_TICK;
+    chkTmrRunning[ix] = DEF_TRUE;
+    chkStarts++;
+}
+
+/*
+*********************************************************************************************************
+*                                               HELPERS
+*********************************************************************************************************
+*/
+
+static OS_TICK ChkNow(void)     //Timer time base, as seen by the caller
+{
+    return (OSTCBCurPtr == &OSTmrTaskTCB) ? OSTmrTaskTickBase : OSTickCtr;
+}
+
+static CPU_INT32U ChkRand(CPU_INT32U *p_seed)
+{
+    *p_seed = *p_seed * 1103515245u + 12345u;
+    return (*p_seed >> 8);
+}
@@ -0,0 +1,397 @@
+/*
+*********************************************************************************************************
+*                                     PUBLISH/SUBSCRIBE TOPIC CHECK
+*
+* Argument checks, reference counting of a buffer fanned out to several queues, a full subscriber queue
+* being skipped, publishing from an ISR, then a fan-out stress run: a producer publishes 100000 buffers
+* to three subscriber tasks at mixed priorities.  Every buffer must reach its subscribers intact and in
+* order, and every block must be back in the partition at the end.  Runs on virtual time: pio test -e sim
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <stdio.h>
+#include <unity.h>
+#include "os.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/* Task Stack Size */
+#define CHK_TASK_STK_SIZE 1024u
+
+/* Task Priority */
+#define CHK_START_TASK_PRIO 2u
+#define CHK_SUB_TASK_PRIO 4u            //Subscribers use 4, 6, 8, around the producer
+#define CHK_PUB_TASK_PRIO 5u
+
+/* Workload */
+#define CHK_SUB_NBR 3u
+#define CHK_SUB_Q_SIZE 4u
+#define CHK_BUF_NBR 8u
+#define CHK_BUF_SIZE 64u
+#define CHK_PUB_NBR 100000u
+#define CHK_MSG_SIZE (2u * sizeof(CPU_INT32U))
+
+#define CHK(cond)                                                      \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("%s:%d: %s\n", __FILE__, __LINE__, #cond);          \
+            chkErrs++;                                                 \
+        }                                                              \
+    } while (0)
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+/* Task Control Block */
+static OS_TCB ChkStartTaskTCB;
+static OS_TCB ChkSubTaskTCB[CHK_SUB_NBR];
+static OS_TCB ChkPubTaskTCB;
+
+/* Task Stack */
+static CPU_STK ChkStartTaskStk[CHK_TASK_STK_SIZE];
+static CPU_STK ChkSubTaskStk[CHK_SUB_NBR][CHK_TASK_STK_SIZE];
+static CPU_STK ChkPubTaskStk[CHK_TASK_STK_SIZE];
+
+/* OS Kernel Objects */
+static OS_TOPIC chkTopic;
+static OS_TOPIC chkTopic2;                      //Shares the partition of chkTopic
+static OS_TOPIC_SUB chkSub[CHK_SUB_NBR];
+static OS_TOPIC_SUB chkSubSmall;
+static OS_Q chkSubQ[CHK_SUB_NBR];
+static OS_Q chkSmallQ;                          //One entry deep, fills up
+static OS_MEM chkMem;
+static CPU_INT64U chkMemStorage[CHK_BUF_NBR][CHK_BUF_SIZE / sizeof(CPU_INT64U)];
+
+/* Results */
+static CPU_INT32U chkErrs;
+static CPU_INT32U chkPublished;
+static CPU_INT32U chkDelivered;
+static CPU_INT32U chkGot[CHK_SUB_NBR];
+static CPU_BOOLEAN chkPubDone;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void ChkStartTask(void *p_arg);
+static void ChkSubTask(void *p_arg);
+static void ChkPubTask(void *p_arg);
+static void ChkArgs(void);
+static void ChkFanOut(void);
+static void ChkStress(void);
+static void ChkDrain(OS_Q *p_q, void *p_buf_expect);
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void test_topic(void)
+{
+    OS_ERR err;
+
+    CPU_Init();
+
+    OSInit(&err);
+    TEST_ASSERT_EQUAL_UINT32(OS_ERR_NONE, err);
+
+    OSTaskCreate((OS_TCB *)&ChkStartTaskTCB,
+                 (CPU_CHAR *)"Check Start Task",
+                 (OS_TASK_PTR)ChkStartTask,
+                 (void *)0,
+                 (OS_PRIO)CHK_START_TASK_PRIO,
+                 (CPU_STK *)&ChkStartTaskStk[0],
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+
+    OSStart(&err);      //Returns once ChkStartTask calls OS_CPU_Stop()
+
+    printf("published %lu got %lu %lu %lu dropped %lu\n",
+           (unsigned long)chkPublished,
+           (unsigned long)chkGot[0],
+           (unsigned long)chkGot[1],
+           (unsigned long)chkGot[2],
+           (unsigned long)chkTopic.DropCtr);
+
+    TEST_ASSERT_EQUAL_UINT32(0u, chkErrs);
+    TEST_ASSERT_EQUAL_UINT32(CHK_PUB_NBR, chkPublished);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_topic);
+    return UNITY_END();
+}
+
+/*
+*********************************************************************************************************
+*                                                  TASKS
+*********************************************************************************************************
+*/
+
+static void ChkStartTask(void *p_arg)
+{
+    OS_ERR err;
+    CPU_INT32U i;
+
+    OS_CPU_SysTickInitFreq(OS_CPU_SYS_TICK_FREQ_HZ);
+
+    OSMemCreate(&chkMem, (CPU_CHAR *)"Check Partition", &chkMemStorage[0][0],
+                CHK_BUF_NBR, CHK_BUF_SIZE, &err);
+    CHK(err == OS_ERR_NONE);
+    for (i = 0u; i < CHK_SUB_NBR; i++)
+    {
+        OSQCreate(&chkSubQ[i], (CPU_CHAR *)"Check Subscriber Queue", CHK_SUB_Q_SIZE, &err);
+    }
+    OSQCreate(&chkSmallQ, (CPU_CHAR *)"Check Small Queue", 1u, &err);
+
+    ChkArgs();
+    ChkFanOut();
+    ChkStress();
+
+    OS_CPU_Stop();      //End of the run, back to test_topic()
+}
+
+static void ChkSubTask(void *p_arg)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+    CPU_INT32U ix = (CPU_INT32U)(CPU_ADDR)p_arg;
+    CPU_INT32U expect = 0u;
+    CPU_INT32U *p_buf;
+
+    while (DEF_TRUE)
+    {
+        p_buf = (CPU_INT32U *)OSQPend(&chkSubQ[ix], 0u, OS_OPT_PEND_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        CHK((err == OS_ERR_NONE) && (msg_size == CHK_MSG_SIZE) && (p_buf[1] == ~p_buf[0]));
+        CHK(p_buf[0] >= expect);                            //Drops leave gaps, never reorder
+        expect = p_buf[0] + 1u;
+        chkGot[ix]++;
+
+        if (((chkGot[ix] + ix) % 7u) == 0u)                 //Fall behind now and then
+        {
+            OSTimeDly(1u, OS_OPT_TIME_DLY, &err);
+        }
+
+        OSTopicBufRelease(p_buf, &err);
+        CHK(err == OS_ERR_NONE);
+    }
+}
+
+static void ChkPubTask(void *p_arg)
+{
+    OS_ERR err;
+    CPU_INT32U *p_buf;
+
+    while (chkPublished < CHK_PUB_NBR)
+    {
+        p_buf = (CPU_INT32U *)OSTopicBufGet(&chkTopic, &err);
+        if (p_buf == (CPU_INT32U *)0)                       //All buffers held by the subscribers
+        {
+            CHK(err == OS_ERR_MEM_NO_FREE_BLKS);
+            OSTimeDly(1u, OS_OPT_TIME_DLY, &err);
+            continue;
+        }
+
+        p_buf[0] = chkPublished;
+        p_buf[1] = ~chkPublished;
+        chkDelivered += OSTopicPublish(&chkTopic, p_buf, CHK_MSG_SIZE,
+                                       ((chkPublished & 1u) != 0u) ? OS_OPT_POST_NONE : OS_OPT_POST_NO_SCHED,
+                                       &err);
+        chkPublished++;
+    }
+
+    chkPubDone = DEF_TRUE;
+    OSTaskSuspend((OS_TCB *)0, &err);
+}
+
+/*
+*********************************************************************************************************
+*                                               CHECKS
+*********************************************************************************************************
+*/
+
+static void ChkArgs(void)
+{
+    OS_ERR err;
+    void *p_buf;
+
+    OSTopicCreate(&chkTopic, (CPU_CHAR *)"Check Topic", (OS_MEM *)0, &err);
+    CHK(err == OS_ERR_MEM_INVALID_P_MEM);
+    OSTopicCreate((OS_TOPIC *)0, (CPU_CHAR *)"Check Topic", &chkMem, &err);
+    CHK(err == OS_ERR_OBJ_PTR_NULL);
+    OSTopicCreate(&chkTopic, (CPU_CHAR *)"Check Topic", &chkMem, &err);
+    CHK(err == OS_ERR_NONE);
+    OSTopicCreate(&chkTopic, (CPU_CHAR *)"Check Topic", &chkMem, &err);
+    CHK(err == OS_ERR_OBJ_CREATED);
+    OSTopicCreate(&chkTopic2, (CPU_CHAR *)"Check Topic 2", &chkMem, &err);
+    CHK(err == OS_ERR_NONE);
+
+    p_buf = OSTopicBufGet(&chkTopic, &err);                 //Header sits in front of the payload
+    CHK((err == OS_ERR_NONE) && (chkMem.NbrFree == CHK_BUF_NBR - 1u));
+    CHK((((CPU_INT08U *)p_buf - (CPU_INT08U *)&chkMemStorage[0][0]) % CHK_BUF_SIZE) == sizeof(OS_TOPIC_BUF));
+    CHK(OSTopicPublish(&chkTopic, p_buf, 4u, OS_OPT_POST_NONE, &err) == 0u);   //No subscriber, freed at once
+    CHK((err == OS_ERR_NONE) && (chkMem.NbrFree == CHK_BUF_NBR));
+
+    p_buf = OSTopicBufGet(&chkTopic, &err);                 //Released without being published
+    OSTopicBufRelease(p_buf, &err);
+    CHK((err == OS_ERR_NONE) && (chkMem.NbrFree == CHK_BUF_NBR));
+    OSTopicBufRelease(p_buf, &err);                         //Released twice
+    CHK((err == OS_ERR_PTR_INVALID) && (chkMem.NbrFree == CHK_BUF_NBR));
+    OSTopicBufRelease((void *)0, &err);
+    CHK(err == OS_ERR_PTR_INVALID);
+
+    OSTopicSubscribe(&chkTopic, (OS_TOPIC_SUB *)0, &chkSubQ[0], &err);
+    CHK(err == OS_ERR_PTR_INVALID);
+    OSTopicSubscribe(&chkTopic, &chkSubSmall, (OS_Q *)&chkMem, &err);          //Not a queue
+    CHK(err == OS_ERR_OBJ_TYPE);
+
+    p_buf = OSTopicBufGet(&chkTopic, &err);
+    OSTopicPublish(&chkTopic, p_buf, 5u, OS_OPT_POST_LIFO, &err);
+    CHK(err == OS_ERR_OPT_INVALID);
+    OSTopicPublish(&chkTopic2, p_buf, 5u, OS_OPT_POST_NONE, &err);              //Any topic of the partition
+    CHK((err == OS_ERR_NONE) && (chkMem.NbrFree == CHK_BUF_NBR));
+}
+
+static void ChkFanOut(void)
+{
+    OS_ERR err;
+    CPU_INT32U i;
+    void *p_buf;
+    void *p_buf2;
+
+    OSTopicSubscribe(&chkTopic, &chkSub[0], &chkSubQ[0], &err);
+    CHK(err == OS_ERR_NONE);
+    OSTopicSubscribe(&chkTopic, &chkSub[1], &chkSubQ[1], &err);
+    CHK((err == OS_ERR_NONE) && (chkTopic.SubNbr == 2u));
+
+    p_buf = OSTopicBufGet(&chkTopic, &err);                 //One buffer, two holders
+    CHK(OSTopicPublish(&chkTopic, p_buf, 5u, OS_OPT_POST_NONE, &err) == 2u);
+    CHK((err == OS_ERR_NONE) && (((OS_TOPIC_BUF *)p_buf)[-1].RefCtr == 2u));
+    ChkDrain(&chkSubQ[0], p_buf);
+    CHK(chkMem.NbrFree == CHK_BUF_NBR - 1u);
+    ChkDrain(&chkSubQ[1], p_buf);
+    CHK(chkMem.NbrFree == CHK_BUF_NBR);
+
+    OSTopicSubscribe(&chkTopic, &chkSubSmall, &chkSmallQ, &err);               //A full queue is skipped
+    p_buf = OSTopicBufGet(&chkTopic, &err);
+    CHK(OSTopicPublish(&chkTopic, p_buf, 1u, OS_OPT_POST_NONE, &err) == 3u);
+    CHK(err == OS_ERR_NONE);
+    p_buf2 = OSTopicBufGet(&chkTopic, &err);
+    CHK(OSTopicPublish(&chkTopic, p_buf2, 1u, OS_OPT_POST_NONE, &err) == 2u);
+    CHK((err == OS_ERR_Q_MAX) && (chkTopic.DropCtr == 1u));
+    OSTopicUnsubscribe(&chkTopic, &chkSubSmall, &err);
+    CHK((err == OS_ERR_NONE) && (chkTopic.SubNbr == 2u));
+    OSTopicUnsubscribe(&chkTopic, &chkSubSmall, &err);
+    CHK(err == OS_ERR_PTR_INVALID);
+
+    ChkDrain(&chkSmallQ, p_buf);
+    for (i = 0u; i < 2u; i++)
+    {
+        ChkDrain(&chkSubQ[i], p_buf);
+        ChkDrain(&chkSubQ[i], p_buf2);
+    }
+    CHK(chkMem.NbrFree == CHK_BUF_NBR);
+
+    OSIntNestingCtr = 1u;                                   //Publish from an ISR
+    p_buf = OSTopicBufGet(&chkTopic, &err);
+    CHK(OSTopicPublish(&chkTopic, p_buf, 1u, OS_OPT_POST_NONE, &err) == 2u);
+    CHK(err == OS_ERR_NONE);
+    OSIntNestingCtr = 0u;
+    ChkDrain(&chkSubQ[0], p_buf);
+    ChkDrain(&chkSubQ[1], p_buf);
+    CHK(chkMem.NbrFree == CHK_BUF_NBR);
+}
+
+static void ChkStress(void)
+{
+    OS_ERR err;
+    CPU_INT32U i;
+
+    OSTopicSubscribe(&chkTopic, &chkSub[2], &chkSubQ[2], &err);
+    CHK(err == OS_ERR_NONE);
+
+    for (i = 0u; i < CHK_SUB_NBR; i++)
+    {
+        OSTaskCreate((OS_TCB *)&ChkSubTaskTCB[i],
+                     (CPU_CHAR *)"Check Subscriber Task",
+                     (OS_TASK_PTR)ChkSubTask,
+                     (void *)(CPU_ADDR)i,
+                     (OS_PRIO)(CHK_SUB_TASK_PRIO + 2u * i),
+                     (CPU_STK *)&ChkSubTaskStk[i][0],
+                     (CPU_STK_SIZE)CHK_TASK_STK_SIZE / 10,
+                     (CPU_STK_SIZE)CHK_TASK_STK_SIZE,
+                     (OS_MSG_QTY)0u,
+                     (OS_TICK)0u,
+                     (void *)0,
+                     (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                     (OS_ERR *)&err);
+    }
+
+    OSTaskCreate((OS_TCB *)&ChkPubTaskTCB,
+                 (CPU_CHAR *)"Check Publisher Task",
+                 (OS_TASK_PTR)ChkPubTask,
+                 (void *)0,
+                 (OS_PRIO)CHK_PUB_TASK_PRIO,
+                 (CPU_STK *)&ChkPubTaskStk[0],
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)CHK_TASK_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+
+    for (i = 0u; (i < 1000000u) && (chkPubDone == DEF_FALSE); i++)
+    {
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err);
+    }
+    OSTimeDly(50u, OS_OPT_TIME_DLY, &err);                  //Let the subscribers catch up
+
+    CHK(chkPubDone == DEF_TRUE);
+    CHK(chkMem.NbrFree == CHK_BUF_NBR);
+    CHK(chkDelivered == chkGot[0] + chkGot[1] + chkGot[2]);
+    CHK(chkDelivered + (chkTopic.DropCtr - 1u) == chkPublished * CHK_SUB_NBR);   //One drop in ChkFanOut()
+}
+
+static void ChkDrain(OS_Q *p_q, void *p_buf_expect)
+{
+    OS_ERR err;
+    OS_MSG_SIZE msg_size;
+    void *p_buf;
+
+    p_buf = OSQPend(p_q, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+    CHK((err == OS_ERR_NONE) && (p_buf == p_buf_expect));
+    OSTopicBufRelease(p_buf, &err);
+    CHK(err == OS_ERR_NONE);
+}
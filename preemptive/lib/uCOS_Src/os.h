@@ -116,10 +116,26 @@ extern "C" {
 #endif
 
 #define  OS_PRIO_TBL_SIZE          (((OS_CFG_PRIO_MAX - 1u) / ((CPU_CFG_DATA_SIZE * 8u))) + 1u)
+                                                                /* Two level bitmap above 2 words of priorities         */
+#define  OS_PRIO_GRP_EN            (((OS_PRIO_TBL_SIZE > 2u) && (OS_PRIO_TBL_SIZE <= (CPU_CFG_DATA_SIZE * 8u))) ? 1u : 0u)
 
 #define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN > 0u) || (OS_CFG_Q_EN > 0u)) ? 1u : 0u)
+                                                                /* Several messages posted or received per call         */
+#define  OS_MSG_N_EN               ((((OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_N_EN > 0u)) || \
+                                     ((OS_CFG_Q_EN      > 0u) && (OS_CFG_Q_N_EN      > 0u))) ? 1u : 0u)
 
-#define  OS_OBJ_TYPE_REQ           (((OS_CFG_DBG_EN > 0u) || (OS_CFG_OBJ_TYPE_CHK_EN > 0u)) ? 1u : 0u)
+                                                                /* Timing wheel tick list, 32 slots per level           */
+#define  OS_TICK_WHEEL_SLOT_BITS   5u
+#define  OS_TICK_WHEEL_SLOT_NBR    (1u << OS_TICK_WHEEL_SLOT_BITS)
+#define  OS_TICK_WHEEL_SLOT_MSK    (OS_TICK_WHEEL_SLOT_NBR - 1u)
+                                                                /* Timer wheel, due timers are listed after the slots   */
+#define  OS_TMR_WHEEL_DUE_IX       (OS_CFG_TMR_WHEEL_LVL_NBR * OS_TICK_WHEEL_SLOT_NBR)
+                                                                /* Longest microsecond delay or timeout                 */
+#define  OS_TICK_US_MAX            0x7FFFFFFFu
+                                                                /* Bins of the periodic task histograms, powers of 4    */
+#define  OS_TASK_PERIOD_HIST_NBR   16u
+
+#define  OS_OBJ_TYPE_REQ           (((OS_CFG_DBG_EN > 0u) || (OS_CFG_OBJ_TYPE_CHK_EN > 0u) || (OS_CFG_PEND_MULTI_EN > 0u)) ? 1u : 0u)
 
 
 /*
@@ -171,6 +187,10 @@ extern "C" {
 #define  OS_TASK_PEND_ON_Q                    (OS_STATE)(  5u)  /* Pending on queue                                   */
 #define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
 #define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
+#define  OS_TASK_PEND_ON_RING                 (OS_STATE)(  8u)  /* Pending on ring buffer message queue               */
+#define  OS_TASK_PEND_ON_STREAM               (OS_STATE)(  9u)  /* Pending on stream buffer                           */
+#define  OS_TASK_PEND_ON_Q_POST               (OS_STATE)( 10u)  /* Pending on room in a queue to post a message       */
+#define  OS_TASK_PEND_ON_MULTI                (OS_STATE)( 11u)  /* Pending on several objects (OSPendMulti())         */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -200,8 +220,12 @@ extern "C" {
 #define  OS_OBJ_TYPE_MUTEX                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'U', 'T', 'X')
 #define  OS_OBJ_TYPE_COND                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('C', 'O', 'N', 'D')
 #define  OS_OBJ_TYPE_Q                       (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'U', 'E', 'U')
+#define  OS_OBJ_TYPE_RING                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'I', 'N', 'G')
 #define  OS_OBJ_TYPE_SEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'M', 'A')
+#define  OS_OBJ_TYPE_STREAM                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'T', 'R', 'M')
 #define  OS_OBJ_TYPE_TMR                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'R', ' ')
+#define  OS_OBJ_TYPE_TMR_LANE                (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'L', 'A', 'N')
+#define  OS_OBJ_TYPE_TOPIC                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'O', 'P', 'C')
 
 /*
 ========================================================================================================================
@@ -245,6 +269,14 @@ extern "C" {
 #define  OS_OPT_PEND_BLOCKING                (OS_OPT)(0x0000u)
 #define  OS_OPT_PEND_NON_BLOCKING            (OS_OPT)(0x8000u)
 
+#define  OS_OPT_PEND_TIMEOUT_US              (OS_OPT)(0x4000u)  /* The timeout is in microseconds, not in ticks       */
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)                                /* Options of a pend, less the unit of its timeout      */
+#define  OS_OPT_PEND_OPT(opt)                (OS_OPT)((opt) & (OS_OPT)~OS_OPT_PEND_TIMEOUT_US)
+#else
+#define  OS_OPT_PEND_OPT(opt)                (opt)
+#endif
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                  PEND ABORT OPTIONS
@@ -273,6 +305,8 @@ extern "C" {
 
 #define  OS_OPT_POST_NO_SCHED                (OS_OPT)(0x8000u)  /* Do not call the scheduler if this is selected      */
 
+#define  OS_OPT_POST_BLOCKING                (OS_OPT)(0x0400u)  /* Wait for room if the queue is full (OSQPost())     */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TASK OPTIONS
@@ -324,6 +358,14 @@ extern "C" {
 #define  OS_OPT_TMR_CALLBACK                      (OS_OPT)(3u)  /* OSTmrStop() option to call 'callback' w/ timer arg */
 #define  OS_OPT_TMR_CALLBACK_ARG                  (OS_OPT)(4u)  /* OSTmrStop() option to call 'callback' w/ new   arg */
 
+#define  OS_OPT_TMR_HARD                     (OS_OPT)(0x0100u)  /* Callback runs from the tick ISR, delays in ticks   */
+
+#if (OS_CFG_TMR_HARD_EN > 0u)                                   /* Mode of a timer, less its hard timer option          */
+#define  OS_OPT_TMR_MODE(opt)                (OS_OPT)((opt) & (OS_OPT)~OS_OPT_TMR_HARD)
+#else
+#define  OS_OPT_TMR_MODE(opt)                (opt)
+#endif
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TIMER STATES
@@ -470,6 +512,7 @@ typedef  enum  os_err {
     OS_ERR_Q_EMPTY                   = 26002u,
     OS_ERR_Q_MAX                     = 26003u,
     OS_ERR_Q_SIZE                    = 26004u,
+    OS_ERR_Q_NOT_EMPTY               = 26005u,
 
     OS_ERR_R                         = 27000u,
     OS_ERR_REG_ID_INVALID            = 27001u,
@@ -522,6 +565,8 @@ typedef  enum  os_err {
     OS_ERR_TASK_SUSPEND_PRIO         = 29022u,
     OS_ERR_TASK_WAITING              = 29023u,
     OS_ERR_TASK_SUSPEND_CTR_OVF      = 29024u,
+    OS_ERR_TASK_PERIOD_OVERRUN       = 29025u,
+    OS_ERR_TASK_NOT_PERIODIC         = 29026u,
 
     OS_ERR_TCB_INVALID               = 29101u,
 
@@ -602,12 +647,22 @@ typedef  struct  os_cond             OS_COND;
 
 typedef  struct  os_q                OS_Q;
 
+typedef  struct  os_ring             OS_RING;
+
 typedef  struct  os_sem              OS_SEM;
 
+typedef  struct  os_stream           OS_STREAM;
+
+typedef  struct  os_topic            OS_TOPIC;
+typedef  struct  os_topic_buf        OS_TOPIC_BUF;
+typedef  struct  os_topic_sub        OS_TOPIC_SUB;
+
 typedef  void                      (*OS_TASK_PTR)(void *p_arg);
 
 typedef  struct  os_tcb              OS_TCB;
 
+typedef  struct  os_task_period_stat OS_TASK_PERIOD_STAT;
+
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
 typedef  void                       *OS_TLS;
 
@@ -624,9 +679,11 @@ typedef  struct  os_tick_list        OS_TICK_LIST;
 
 typedef  void                      (*OS_TMR_CALLBACK_PTR)(void *p_tmr, void *p_arg);
 typedef  struct  os_tmr              OS_TMR;
+typedef  struct  os_tmr_lane         OS_TMR_LANE;
 
 typedef  struct  os_pend_list        OS_PEND_LIST;
 typedef  struct  os_pend_obj         OS_PEND_OBJ;
+typedef  struct  os_pend_data        OS_PEND_DATA;
 
 #if (OS_CFG_APP_HOOKS_EN > 0u)
 typedef  void                      (*OS_APP_HOOK_VOID)(void);
@@ -703,6 +760,41 @@ struct  os_pend_obj {
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      PEND DATA
+*
+* Note(s) : (1) A task calling OSPendMulti() passes a table of 'os_pend_data', one entry per object to wait on.  While
+*               the task waits each entry is linked, in priority order, in the list of the object it designates
+*               ('PendMultiPtr' of a semaphore, queue or event flag group) since the task can't be in several pend
+*               lists at once.
+*
+*           (2) The caller fills 'PendObjPtr' and, for an event flag group, 'FlagsPend' & 'FlagsOpt'.  The kernel fills
+*               the remaining members.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_pend_data {
+    OS_PEND_DATA        *PrevPtr;                           /* Previous entry waiting on the object                   */
+    OS_PEND_DATA        *NextPtr;                           /* Next     entry waiting on the object                   */
+    OS_TCB              *TCBPtr;                            /* Task waiting                                           */
+    OS_PEND_OBJ         *PendObjPtr;                        /* Semaphore, queue or event flag group to wait on        */
+#if (OS_CFG_FLAG_EN > 0u)
+    OS_FLAGS             FlagsPend;                         /* Event flag(s) to wait on                               */
+    OS_OPT               FlagsOpt;                          /* OS_OPT_PEND_FLAG_xxx, may include ..._CONSUME          */
+    OS_FLAGS             RdyFlags;                          /* Event flags that made the entry ready                  */
+#endif
+    OS_PEND_OBJ         *RdyObjPtr;                         /* 'PendObjPtr' if the object is ready, else NULL         */
+#if (OS_CFG_Q_EN > 0u)
+    void                *RdyMsgPtr;                         /* Message received from a queue                          */
+    OS_MSG_SIZE          RdyMsgSize;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               RdyTS;                             /* Timestamp of the post                                  */
+#endif
+};
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     EVENT FLAGS
@@ -731,6 +823,9 @@ struct  os_flag_grp {                                       /* Event Flag Group
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS               TS;                                /* Timestamp of when last post occurred                   */
 #endif
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    OS_PEND_DATA        *PendMultiPtr;                      /* Tasks waiting in OSPendMulti(), see PEND DATA Note #1  */
+#endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
     CPU_INT16U           FlagID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
@@ -803,6 +898,14 @@ struct  os_msg_q {                                          /* OS_MSG_Q
 #if (OS_CFG_DBG_EN > 0u)
     OS_MSG_QTY           NbrEntriesMax;                     /* Peak number of entries in the queue                    */
 #endif
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+    OS_MSG_POOL         *PoolPtr;                           /* Pool the OS_MSGs are taken from, &OSMsgPool by default */
+#endif
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    OS_MSG             **PrioTailTbl;                       /* Last OS_MSG of each priority, NULL if FIFO/LIFO queue  */
+    CPU_DATA             PrioMap;                           /* Priorities holding messages, MSB is priority 0         */
+    OS_PRIO              PrioNbr;                           /* Number of message priorities                           */
+#endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
     CPU_INT16U           MsgQID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
@@ -875,7 +978,10 @@ struct  os_cond {                                           /* Condition Variabl
 ------------------------------------------------------------------------------------------------------------------------
 *                                                    MESSAGE QUEUES
 *
-* Note(s) : See  PEND OBJ  Note #1'.
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) Tasks posting with OS_OPT_POST_BLOCKING to a full queue wait on 'PostPendObj', a pend object of their
+*               own, so the kernel removes them from its list like from any other on a timeout or a deletion.
 ------------------------------------------------------------------------------------------------------------------------
 */
 
@@ -895,6 +1001,129 @@ struct  os_q {                                              /* Message Queue
 #endif
                                                             /* ------------------ SPECIFIC MEMBERS ------------------ */
     OS_MSG_Q             MsgQ;                              /* List of messages                                       */
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    OS_PEND_DATA        *PendMultiPtr;                      /* Tasks waiting in OSPendMulti(), see PEND DATA Note #1  */
+#endif
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+    OS_PEND_OBJ          PostPendObj;                       /* Tasks waiting for room to post (See Note #2)           */
+    OS_TICK              PostTimeout;                       /* Timeout of a blocking post, 0 to wait forever          */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                             RING BUFFER MESSAGE QUEUES
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) Messages are copied in & out of a caller-supplied array of 'NbrMax' slots of 'MsgSize' bytes.  'NbrMax'
+*               is a power of 2: 'InIx' & 'OutIx' run freely & are masked with 'NbrMax - 1' to index a slot, their
+*               difference is the number of messages waiting.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_ring {                                           /* Ring Buffer Message Queue                              */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_RING                      */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Ring Name (NUL terminated ASCII)            */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on the ring                      */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_RING             *DbgPrevPtr;
+    OS_RING             *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    CPU_INT08U          *StoragePtr;                        /* Array of 'NbrMax' slots (See Note #2)                  */
+    OS_MSG_SIZE          MsgSize;                           /* Size of a message, in bytes                            */
+    OS_MSG_QTY           NbrMax;                            /* Number of slots, a power of 2                          */
+    OS_MSG_QTY           InIx;                              /* Index of the next slot to write                        */
+    OS_MSG_QTY           OutIx;                             /* Index of the next slot to read                         */
+    OS_MSG_QTY           NbrEntriesMax;                     /* Peak number of messages waiting                        */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    STREAM BUFFERS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) Bytes are copied in & out of a caller-supplied array of 'Size' bytes, a power of 2.  'InIx' is only
+*               written by the producer & 'OutIx' only by the consumer, both run freely & their difference is the
+*               number of bytes waiting.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_stream {                                         /* Stream Buffer                                          */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_STREAM                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Stream Name (NUL terminated ASCII)          */
+#endif
+    OS_PEND_LIST         PendList;                          /* The task waiting on the stream, if any                 */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_STREAM           *DbgPrevPtr;
+    OS_STREAM           *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    CPU_INT08U          *StoragePtr;                        /* Array of 'Size' bytes (See Note #2)                    */
+    OS_MSG_SIZE          Size;                              /* Size of the array, a power of 2                        */
+    OS_MSG_SIZE          TriggerLevel;                      /* Bytes needed to ready the reader                       */
+    OS_MSG_SIZE          WaitLevel;                         /* Bytes the waiting reader needs, <= TriggerLevel        */
+    OS_MSG_SIZE volatile InIx;                              /* Index of the next byte to write, producer only         */
+    OS_MSG_SIZE volatile OutIx;                             /* Index of the next byte to read,  consumer only         */
+    CPU_INT32U           OverrunCtr;                        /* Number of bytes dropped because the stream was full    */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                               PUBLISH/SUBSCRIBE TOPICS
+*
+* Note(s) : (1) A buffer published on a topic is a block of the topic's memory partition.  The block starts with an
+*               OS_TOPIC_BUF header, the caller only sees the bytes that follow it.
+*
+*           (2) 'RefCtr' counts the holders of a buffer: the publisher until it publishes, then each subscriber queue
+*               it was delivered to until the subscriber releases it.  The block returns to 'MemPtr' at 0.
+*
+*           (3) Subscribers are caller-allocated OS_TOPIC_SUBs, each linked to the message queue the buffers are
+*               delivered to.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_topic_buf {                                      /* Header of a topic buffer (See Note #1)                 */
+    OS_MEM              *MemPtr;                            /* Partition the block returns to                         */
+    OS_OBJ_QTY           RefCtr;                            /* Number of holders of the buffer (See Note #2)          */
+};
+
+
+struct  os_topic_sub {                                      /* Topic subscriber (See Note #3)                         */
+    OS_TOPIC_SUB        *NextPtr;                           /* Next subscriber of the same topic                      */
+    OS_Q                *QPtr;                              /* Queue the buffers are delivered to                     */
+};
+
+
+struct  os_topic {                                          /* Publish/Subscribe Topic                                */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_TOPIC                     */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Topic Name (NUL terminated ASCII)           */
+    OS_TOPIC            *DbgPrevPtr;
+    OS_TOPIC            *DbgNextPtr;
+#endif
+    OS_MEM              *MemPtr;                            /* Partition the buffers are taken from                   */
+    OS_TOPIC_SUB        *SubListPtr;                        /* List of subscribers                                    */
+    OS_OBJ_QTY           SubNbr;                            /* Number of subscribers                                  */
+    CPU_INT32U           DropCtr;                           /* Deliveries lost because a subscriber queue was full    */
 };
 
 
@@ -925,12 +1154,35 @@ struct  os_sem {                                            /* Semaphore
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS               TS;
 #endif
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    OS_PEND_DATA        *PendMultiPtr;                      /* Tasks waiting in OSPendMulti(), see PEND DATA Note #1  */
+#endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
     CPU_INT16U           SemID;                             /* Unique ID for third-party debuggers and tracers.       */
 #endif
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                PERIODIC TASK STATISTICS
+*
+* Note(s) : (1) The samples are in OS_TS_GET() counts.  The average is .Sum / .Nbr.
+*
+*           (2) .Hist[0] counts the samples of 0, .Hist[i] the samples from 4^(i-1) to 4^i - 1.  The last bin also counts
+*               all the longer samples.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_task_period_stat {
+    CPU_TS               Min;                               /* Shortest sample                                        */
+    CPU_TS               Max;                               /* Longest  sample                                        */
+    CPU_INT64U           Sum;                               /* Sum of the samples, see Note #1                        */
+    OS_CTR               Nbr;                               /* Number of samples                                      */
+    OS_CTR               Hist[OS_TASK_PERIOD_HIST_NBR];     /* Histogram of the samples, see Note #2                  */
+};
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                  TASK CONTROL BLOCK
@@ -974,6 +1226,10 @@ struct os_tcb {
     OS_PEND_OBJ         *PendObjPtr;                        /* Pointer to object pended on.                           */
     OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
     OS_STATUS            PendStatus;                        /* Pend status                                            */
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    OS_PEND_DATA        *PendDataTblPtr;                    /* Table passed to OSPendMulti() while waiting in it      */
+    OS_OBJ_QTY           PendDataEntries;                   /* Size of the table                                      */
+#endif
 
     OS_STATE             TaskState;                         /* See OS_TASK_STATE_xxx                                  */
     OS_PRIO              Prio;                              /* Task priority (0 == highest)                           */
@@ -999,6 +1255,17 @@ struct os_tcb {
 #if (OS_CFG_TICK_EN > 0u)
     OS_TICK              TickRemain;                        /* Number of ticks remaining                              */
     OS_TICK              TickCtrPrev;                       /* Used by OSTimeDlyXX() in PERIODIC mode                 */
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OS_TICK              TickMatch;                         /* Value of OSTickCtr at which the delay expires          */
+    CPU_INT08U           TickSlot;                          /* Timing wheel slot holding the task                     */
+#endif
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    OS_TICK              TickSlack;                         /* Ticks by which the task's delays may be extended       */
+#endif
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    CPU_INT32U           UsMatch;                           /* Value of the microsecond timer at which it expires     */
+    CPU_BOOLEAN          UsDly;                             /* The delay is in the microsecond list, not in ticks     */
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
@@ -1006,9 +1273,33 @@ struct os_tcb {
     OS_TICK              TimeQuantaCtr;
 #endif
 
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)                 /* PREEMPTION THRESHOLD                                   */
+    OS_PRIO              PrioThreshold;                     /* Only tasks above this priority may preempt the task    */
+    OS_TCB              *PreemptNextPtr;                    /* Next task in the list of preempted tasks               */
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)                            /* CPU BUDGET                                             */
+    OS_TICK              BudgetQuanta;                      /* Ticks the task may run per period, 0 if unlimited      */
+    OS_TICK              BudgetPeriod;                      /* Replenishment period, in ticks                         */
+    OS_TICK              BudgetStart;                       /* Value of OSTickCtr at the start of the current period  */
+    OS_TICK              BudgetUsed;                        /* Ticks used in the current period                       */
+    OS_CTR               BudgetExhaustCtr;                  /* Number of times the task was throttled                 */
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)                              /* EARLIEST-DEADLINE-FIRST                                */
+    OS_TICK              DeadlineRel;                       /* Relative deadline, 0 if the task has none              */
+    OS_TICK              DeadlinePeriod;                    /* Minimum number of ticks between two releases           */
+    OS_TICK              DeadlineRelease;                   /* Value of OSTickCtr when the current job was released   */
+    OS_TICK              Deadline;                          /* Absolute deadline of the current job                   */
+    CPU_BOOLEAN          DeadlineJobEnd;                    /* Current job complete, the next readying releases one   */
+#endif
+
 #if (OS_MSG_EN > 0u)
     void                *MsgPtr;                            /* Message received                                       */
     OS_MSG_SIZE          MsgSize;
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u) && (OS_CFG_Q_PRIO_EN > 0u)
+    OS_PRIO              MsgPrio;                           /* Priority of the message parked by a blocking post      */
+#endif
 #endif
 
 #if (OS_CFG_TASK_Q_EN > 0u)
@@ -1046,6 +1337,20 @@ struct os_tcb {
     CPU_TS               SemPendTimeMax;                    /* Max amount of time it took for signal to be received   */
 #endif
 
+#if (OS_CFG_TASK_PERIOD_EN > 0u)                            /* PERIODIC RELEASE                                       */
+    OS_TICK              Period;                            /* Release period in ticks, 0 if the task is not periodic */
+    OS_TICK              PeriodRelease;                     /* Value of OSTickCtr at the release of the current job   */
+    OS_CTR               PeriodJobCtr;                      /* Number of jobs released                                */
+    OS_CTR               PeriodOverrunCtr;                  /* Number of jobs completed after their next release      */
+    OS_CTR               PeriodSkipCtr;                     /* Number of releases dropped after an overrun            */
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    CPU_BOOLEAN          PeriodWait;                        /* Delayed by OSTaskWaitNextPeriod(), until the release   */
+    CPU_TS               PeriodReleaseTS;                   /* Timestamp of the release of the current job            */
+    OS_TASK_PERIOD_STAT  PeriodJitter;                      /* From the release to the start      of each job         */
+    OS_TASK_PERIOD_STAT  PeriodResponse;                    /* From the release to the completion of each job         */
+#endif
+#endif
+
 #if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
     CPU_STK_SIZE         StkUsed;                           /* Number of stack elements used from the stack           */
     CPU_STK_SIZE         StkFree;                           /* Number of stack elements free on   the stack           */
@@ -1076,7 +1381,14 @@ struct os_tcb {
 */
 
 struct  os_tick_list {
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+                                                            /* Lists of tasks in the timing wheel, per level & slot  */
+    OS_TCB              *SlotTbl[OS_CFG_TICK_WHEEL_LVL_NBR * OS_TICK_WHEEL_SLOT_NBR];
+                                                            /* Non-empty slots of each level, one bit per slot       */
+    CPU_INT32U           SlotMap[OS_CFG_TICK_WHEEL_LVL_NBR];
+#else
     OS_TCB              *TCB_Ptr;                           /* Pointer to list of tasks in tick list                 */
+#endif
 #if (OS_CFG_DBG_EN > 0u)
     OS_OBJ_QTY           NbrEntries;                        /* Current number of entries in the tick list            */
     OS_OBJ_QTY           NbrUpdated;                        /* Number of entries updated                             */
@@ -1101,11 +1413,24 @@ struct  os_tmr {
     void                *CallbackPtrArg;                    /* Argument to pass to function when timer expires        */
     OS_TMR              *NextPtr;                           /* Double link list pointers                              */
     OS_TMR              *PrevPtr;
-    OS_TICK              Remain;                            /* Amount of time remaining before timer expires          */
+    OS_TICK              Remain;                            /* Delay loaded when the timer was last started           */
+    OS_TICK              Match;                             /* Value of OSTickCtr at which the timer expires          */
+    CPU_INT08U           Slot;                              /* Timer wheel slot holding the timer                     */
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    OS_TICK              Slack;                             /* Ticks by which the expiry may be extended              */
+#endif
     OS_TICK              Dly;                               /* Delay before start of repeat                           */
     OS_TICK              Period;                            /* Period to repeat timer                                 */
     OS_OPT               Opt;                               /* Options (see OS_OPT_TMR_xxx)                           */
     OS_STATE             State;
+#if (OS_CFG_TMR_LANE_EN > 0u)
+    OS_TMR_LANE         *LanePtr;                           /* Lane running the callback, timer task if NULL          */
+    OS_TMR              *LaneNextPtr;                       /* Next timer waiting in the same lane                    */
+    CPU_BOOLEAN          LanePend;                          /* Callback is waiting in the lane                        */
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               LaneTS;                            /* Timestamp of the expiry which queued the callback      */
+#endif
+#endif
 #if (OS_CFG_DBG_EN > 0u)
     OS_TMR              *DbgPrevPtr;
     OS_TMR              *DbgNextPtr;
@@ -1113,6 +1438,28 @@ struct  os_tmr {
 };
 
 
+#if (OS_CFG_TMR_LANE_EN > 0u)
+struct  os_tmr_lane {
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_TMR_LANE                  */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Name of the lane, also given to its task               */
+#endif
+    OS_TCB               Task;                              /* Task running the callbacks                             */
+    OS_TMR              *HeadPtr;                           /* Expired timers waiting for their callback, FIFO        */
+    OS_TMR              *TailPtr;
+    CPU_INT32U           DispatchCtr;                       /* Number of callbacks run by the lane                    */
+    CPU_INT32U           OverrunCtr;                        /* Expiries lost, the previous one still waiting          */
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               Latency;                           /* Expiry to callback latency, last & largest             */
+    CPU_TS               LatencyMax;
+    CPU_INT64U           LatencySum;                        /* Sum of the latencies, for the average                  */
+#endif
+};
+#endif
+
+
 /*
 ************************************************************************************************************************
 ************************************************************************************************************************
@@ -1192,6 +1539,9 @@ OS_EXT            OS_OBJ_QTY                OSMutexQty;                 /* Numbe
 OS_EXT            OS_PRIO                   OSPrioCur;                  /* Priority of current task                   */
 OS_EXT            OS_PRIO                   OSPrioHighRdy;              /* Priority of highest priority task          */
 OS_EXT            CPU_DATA                  OSPrioTbl[OS_PRIO_TBL_SIZE];
+#if (OS_PRIO_GRP_EN > 0u)
+OS_EXT            CPU_DATA                  OSPrioGrp;                  /* Non-empty entries of OSPrioTbl[]           */
+#endif
 
                                                                         /* QUEUES ----------------------------------- */
 #if (OS_CFG_Q_EN > 0u)
@@ -1201,6 +1551,27 @@ OS_EXT            OS_OBJ_QTY                OSQQty;                     /* Numbe
 #endif
 #endif
 
+#if (OS_CFG_RING_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_RING                  *OSRingDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSRingQty;                  /* Number of rings created                    */
+#endif
+#endif
+
+#if (OS_CFG_STREAM_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_STREAM                *OSStreamDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSStreamQty;                /* Number of streams created                  */
+#endif
+#endif
+
+#if (OS_CFG_TOPIC_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_TOPIC                 *OSTopicDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSTopicQty;                 /* Number of topics created                   */
+#endif
+#endif
+
 
 
                                                                         /* READY LIST ------------------------------- */
@@ -1267,7 +1638,14 @@ OS_EXT            OS_TICK                   OSTickCtr;                  /* Cnts
 OS_EXT            OS_TICK                   OSTickCtrStep;              /* Number of ticks to the next tick task call.*/
 #endif
 OS_EXT            OS_TICK_LIST              OSTickList;
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+OS_EXT            OS_CTR                    OSTickMergeCtr;             /* Nbr of timeouts moved by their slack       */
+#endif
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+OS_EXT            OS_TCB                   *OSTickUsListPtr;            /* Microsecond delays, earliest first         */
+#endif
 #if (OS_CFG_TS_EN > 0u)
+OS_EXT            CPU_TS                    OSTickTS;                   /* Timestamp of the last tick                 */
 OS_EXT            CPU_TS                    OSTickTime;
 OS_EXT            CPU_TS                    OSTickTimeMax;
 #endif
@@ -1280,7 +1658,11 @@ OS_EXT            CPU_TS                    OSTickTimeMax;
 OS_EXT            OS_TMR                   *OSTmrDbgListPtr;
 OS_EXT            OS_OBJ_QTY                OSTmrListEntries;           /* Doubly-linked list of timers               */
 #endif
-OS_EXT            OS_TMR                   *OSTmrListPtr;
+                                                                        /* Timer wheel slots, due timers last ...     */
+OS_EXT            OS_TMR                   *OSTmrWheelTbl[OS_TMR_WHEEL_DUE_IX + 1u];
+                                                                        /* ... & non-empty slots of each level        */
+OS_EXT            CPU_INT32U                OSTmrWheelMap[OS_CFG_TMR_WHEEL_LVL_NBR];
+OS_EXT            OS_TICK                   OSTmrWheelTick;             /* Last tick processed by the timer wheel     */
 OS_EXT            OS_COND                   OSTmrCond;
 OS_EXT            OS_MUTEX                  OSTmrMutex;
 
@@ -1294,6 +1676,12 @@ OS_EXT            CPU_TS                    OSTmrTaskTimeMax;
 #endif
 OS_EXT            OS_TICK                   OSTmrTaskTickBase;          /* Tick to which timer delays are relative    */
 OS_EXT            OS_TICK                   OSTmrToTicksMult;           /* Converts Timer time to Ticks Multiplier    */
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+OS_EXT            OS_CTR                    OSTmrMergeCtr;              /* Nbr of timers moved by their slack         */
+#endif
+#if (OS_CFG_TMR_HARD_EN > 0u)
+OS_EXT            OS_TMR                   *OSTmrHardListPtr;           /* Running hard timers, sorted by expiry      */
+#endif
 #endif
 
 
@@ -1302,6 +1690,9 @@ OS_EXT            OS_TICK                   OSTmrToTicksMult;           /* Conve
                                                                         /* TCBs ------------------------------------- */
 OS_EXT            OS_TCB                   *OSTCBCurPtr;                /* Pointer to currently running TCB           */
 OS_EXT            OS_TCB                   *OSTCBHighRdyPtr;            /* Pointer to highest priority  TCB           */
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+OS_EXT            OS_TCB                   *OSTCBPreemptPtr;            /* Last task preempted above its threshold    */
+#endif
 
 
 /*
@@ -1428,6 +1819,11 @@ void          OS_FlagDbgListRemove      (OS_FLAG_GRP           *p_grp);
 void          OS_FlagTaskRdy            (OS_TCB                *p_tcb,
                                          OS_FLAGS               flags_rdy,
                                          CPU_TS                 ts);
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+OS_FLAGS      OS_FlagPendMultiRdy       (OS_FLAG_GRP           *p_grp,
+                                         OS_PEND_DATA          *p_pend_data);
+#endif
 #endif
 
 
@@ -1517,6 +1913,48 @@ void          OS_MutexGrpPostAll        (OS_TCB                *p_tcb);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                              PEND ON MULTIPLE OBJECTS                                              */
+/* ================================================================================================================== */
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+
+OS_OBJ_QTY    OSPendMulti               (OS_PEND_DATA          *p_pend_data_tbl,
+                                         OS_OBJ_QTY             tbl_size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_PendMultiChangePrio    (OS_TCB                *p_tcb);
+
+OS_TCB       *OS_PendMultiNext          (OS_PEND_OBJ           *p_obj,
+                                         OS_PEND_DATA          *p_pend_data);
+
+void          OS_PendMultiRemove        (OS_TCB                *p_tcb);
+
+                                                            /* Highest priority task waiting on 'p_obj' (sem, q, flag)*/
+#define  OS_PEND_LIST_HEAD(p_obj)        OS_PendMultiNext((OS_PEND_OBJ *)((void *)(p_obj)), (p_obj)->PendMultiPtr)
+#else
+#define  OS_PEND_LIST_HEAD(p_obj)        ((p_obj)->PendList.HeadPtr)
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                   MESSAGE POOLS                                                    */
+/* ================================================================================================================== */
+
+#if (OS_MSG_EN > 0u) && (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+
+void          OSMsgPoolCreate           (OS_MSG_POOL           *p_pool,
+                                         OS_MSG                *p_msg_tbl,
+                                         OS_MSG_QTY             qty,
+                                         OS_ERR                *p_err);
+
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                   MESSAGE QUEUES                                                   */
 /* ================================================================================================================== */
@@ -1546,22 +1984,74 @@ void         *OSQPend                   (OS_Q                  *p_q,
                                          CPU_TS                *p_ts,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_N_EN > 0u)
+OS_MSG_QTY    OSQPendN                  (OS_Q                  *p_q,
+                                         void                  *p_msg_tbl[],
+                                         OS_MSG_SIZE            msg_size_tbl[],
+                                         OS_MSG_QTY             nbr_max,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_Q_PEND_ABORT_EN > 0u)
 OS_OBJ_QTY    OSQPendAbort              (OS_Q                  *p_q,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+void          OSQPoolSet                (OS_Q                  *p_q,
+                                         OS_MSG_POOL           *p_pool,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_Q_PRIO_EN > 0u)
+void          OSQPrioSet                (OS_Q                  *p_q,
+                                         OS_MSG                *p_tail_tbl[],
+                                         OS_PRIO                nbr_prio,
+                                         OS_ERR                *p_err);
+#endif
+
 void          OSQPost                   (OS_Q                  *p_q,
                                          void                  *p_void,
                                          OS_MSG_SIZE            msg_size,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_PRIO_EN > 0u)
+void          OSQPostPrio               (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_PRIO                prio,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_Q_N_EN > 0u)
+OS_MSG_QTY    OSQPostN                  (OS_Q                  *p_q,
+                                         void                  *p_msg_tbl[],
+                                         OS_MSG_SIZE            msg_size_tbl[],
+                                         OS_MSG_QTY             nbr,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+void          OSQPostTimeoutSet         (OS_Q                  *p_q,
+                                         OS_TICK                timeout,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_QClr                   (OS_Q                  *p_q);
 
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+CPU_BOOLEAN   OS_QPostRdy               (OS_Q                  *p_q);
+#endif
+
 #if (OS_CFG_DBG_EN > 0u)
 void          OS_QDbgListAdd            (OS_Q                  *p_q);
 
@@ -1571,6 +2061,153 @@ void          OS_QDbgListRemove         (OS_Q                  *p_q);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                             RING BUFFER MESSAGE QUEUES                                             */
+/* ================================================================================================================== */
+
+#if (OS_CFG_RING_EN > 0u)
+
+void          OSRingCreate              (OS_RING               *p_ring,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_storage,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_RING_DEL_EN > 0u)
+OS_OBJ_QTY    OSRingDel                 (OS_RING               *p_ring,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_RING_FLUSH_EN > 0u)
+OS_MSG_QTY    OSRingFlush               (OS_RING               *p_ring,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSRingPend                (OS_RING               *p_ring,
+                                         void                  *p_msg,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_RING_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY    OSRingPendAbort           (OS_RING               *p_ring,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSRingPost                (OS_RING               *p_ring,
+                                         void                  *p_msg,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_RingClr                (OS_RING               *p_ring);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_RingDbgListAdd         (OS_RING               *p_ring);
+
+void          OS_RingDbgListRemove      (OS_RING               *p_ring);
+#endif
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                   STREAM BUFFERS                                                   */
+/* ================================================================================================================== */
+
+#if (OS_CFG_STREAM_EN > 0u)
+
+void          OSStreamCreate            (OS_STREAM             *p_stream,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_storage,
+                                         OS_MSG_SIZE            size,
+                                         OS_MSG_SIZE            trigger,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_STREAM_DEL_EN > 0u)
+OS_OBJ_QTY    OSStreamDel               (OS_STREAM             *p_stream,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_STREAM_PEND_ABORT_EN > 0u)
+CPU_BOOLEAN   OSStreamPendAbort         (OS_STREAM             *p_stream,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+OS_MSG_SIZE   OSStreamRead              (OS_STREAM             *p_stream,
+                                         void                  *p_buf,
+                                         OS_MSG_SIZE            len,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+OS_MSG_SIZE   OSStreamWrite             (OS_STREAM             *p_stream,
+                                         void                  *p_data,
+                                         OS_MSG_SIZE            len,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_StreamClr              (OS_STREAM             *p_stream);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_StreamDbgListAdd       (OS_STREAM             *p_stream);
+
+void          OS_StreamDbgListRemove    (OS_STREAM             *p_stream);
+#endif
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                              PUBLISH/SUBSCRIBE TOPICS                                              */
+/* ================================================================================================================== */
+
+#if (OS_CFG_TOPIC_EN > 0u)
+
+void         *OSTopicBufGet             (OS_TOPIC              *p_topic,
+                                         OS_ERR                *p_err);
+
+void          OSTopicBufRelease         (void                  *p_buf,
+                                         OS_ERR                *p_err);
+
+void          OSTopicCreate             (OS_TOPIC              *p_topic,
+                                         CPU_CHAR              *p_name,
+                                         OS_MEM                *p_mem,
+                                         OS_ERR                *p_err);
+
+OS_OBJ_QTY    OSTopicPublish            (OS_TOPIC              *p_topic,
+                                         void                  *p_buf,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSTopicSubscribe          (OS_TOPIC              *p_topic,
+                                         OS_TOPIC_SUB          *p_sub,
+                                         OS_Q                  *p_q,
+                                         OS_ERR                *p_err);
+
+void          OSTopicUnsubscribe        (OS_TOPIC              *p_topic,
+                                         OS_TOPIC_SUB          *p_sub,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_TopicDbgListAdd        (OS_TOPIC              *p_topic);
+#endif
+
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                     SEMAPHORES                                                     */
 /* ================================================================================================================== */
@@ -1627,6 +2264,13 @@ void          OS_SemDbgListRemove       (OS_SEM                *p_sem);
 /*                                                 TASK MANAGEMENT                                                    */
 /* ================================================================================================================== */
 
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void          OSTaskBudgetSet           (OS_TCB                *p_tcb,
+                                         OS_TICK                budget,
+                                         OS_TICK                period,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_TASK_CHANGE_PRIO_EN > 0u)
 void          OSTaskChangePrio          (OS_TCB                *p_tcb,
                                          OS_PRIO                prio_new,
@@ -1662,6 +2306,16 @@ void         *OSTaskQPend               (OS_TICK                timeout,
                                          CPU_TS                *p_ts,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_TASK_Q_N_EN > 0u)
+OS_MSG_QTY    OSTaskQPendN              (void                  *p_msg_tbl[],
+                                         OS_MSG_SIZE            msg_size_tbl[],
+                                         OS_MSG_QTY             nbr_max,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+#endif
+
 CPU_BOOLEAN   OSTaskQPendAbort          (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
@@ -1672,6 +2326,21 @@ void          OSTaskQPost               (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_TASK_Q_N_EN > 0u)
+OS_MSG_QTY    OSTaskQPostN              (OS_TCB                *p_tcb,
+                                         void                  *p_msg_tbl[],
+                                         OS_MSG_SIZE            msg_size_tbl[],
+                                         OS_MSG_QTY             nbr,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+void          OSTaskQPoolSet            (OS_TCB                *p_tcb,
+                                         OS_MSG_POOL           *p_pool,
+                                         OS_ERR                *p_err);
+#endif
+
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -1735,10 +2404,44 @@ void          OSTaskTimeQuantaSet       (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+void          OSTaskDeadlineSet         (OS_TCB                *p_tcb,
+                                         OS_TICK                deadline,
+                                         OS_TICK                period,
+                                         OS_ERR                *p_err);
+
+void          OSTaskDeadlineJobEnd      (OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_TASK_PERIOD_EN > 0u)
+void          OSTaskPeriodSet           (OS_TCB                *p_tcb,
+                                         OS_TICK                period,
+                                         OS_ERR                *p_err);
+
+void          OSTaskWaitNextPeriod      (OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+void          OSTaskPreemptThresholdSet (OS_TCB                *p_tcb,
+                                         OS_PRIO                threshold,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+void          OSTaskSlackSet            (OS_TCB                *p_tcb,
+                                         OS_TICK                slack,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void          OS_TaskBudgetCharge       (void);
+#endif
+
 void          OS_TaskBlock              (OS_TCB                *p_tcb,
-                                         OS_TICK                timeout);
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt);
 
 #if (OS_CFG_DBG_EN > 0u)
 void          OS_TaskDbgListAdd         (OS_TCB                *p_tcb);
@@ -1750,6 +2453,13 @@ void          OS_TaskInit               (OS_ERR                *p_err);
 
 void          OS_TaskInitTCB            (OS_TCB                *p_tcb);
 
+#if (OS_CFG_TASK_PERIOD_EN > 0u) && (OS_CFG_TASK_PROFILE_EN > 0u)
+void          OS_TaskPeriodStatAdd      (OS_TASK_PERIOD_STAT   *p_stat,
+                                         CPU_TS                 sample);
+
+void          OS_TaskPeriodStatClr      (OS_TASK_PERIOD_STAT   *p_stat);
+#endif
+
 void          OS_TaskReturn             (void);
 
 #if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
@@ -1786,6 +2496,11 @@ void          OSTimeDlyResume           (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+void          OSTimeDlyUs               (CPU_INT32U             us,
+                                         OS_ERR                *p_err);
+#endif
+
 OS_TICK       OSTimeGet                 (OS_ERR                *p_err);
 
 void          OSTimeSet                 (OS_TICK                ticks,
@@ -1797,6 +2512,10 @@ void          OSTimeTick                (void);
 void          OSTimeDynTick             (OS_TICK                ticks);
 #endif
 
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+void          OSTimeUsTick              (void);
+#endif
+
 
 /* ================================================================================================================== */
 /*                                                 TIMER MANAGEMENT                                                   */
@@ -1822,6 +2541,12 @@ void          OSTmrSet                  (OS_TMR                *p_tmr,
                                          void                  *p_callback_arg,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+void          OSTmrSlackSet             (OS_TMR                *p_tmr,
+                                         OS_TICK                slack,
+                                         OS_ERR                *p_err);
+#endif
+
 OS_TICK       OSTmrRemainGet            (OS_TMR                *p_tmr,
                                          OS_ERR                *p_err);
 
@@ -1836,6 +2561,19 @@ CPU_BOOLEAN   OSTmrStop                 (OS_TMR                *p_tmr,
                                          void                  *p_callback_arg,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_TMR_LANE_EN > 0u)
+void          OSTmrLaneCreate           (OS_TMR_LANE           *p_lane,
+                                         CPU_CHAR              *p_name,
+                                         OS_PRIO                prio,
+                                         CPU_STK               *p_stk_base,
+                                         CPU_STK_SIZE           stk_size,
+                                         OS_ERR                *p_err);
+
+void          OSTmrLaneSet              (OS_TMR                *p_tmr,
+                                         OS_TMR_LANE           *p_lane,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_TmrClr                 (OS_TMR                *p_tmr);
@@ -1846,13 +2584,21 @@ void          OS_TmrDbgListAdd          (OS_TMR                *p_tmr);
 void          OS_TmrDbgListRemove       (OS_TMR                *p_tmr);
 #endif
 
+#if (OS_CFG_TMR_HARD_EN > 0u)
+void          OS_TmrHardLink            (OS_TMR                *p_tmr,
+                                         OS_TICK                time);
+
+void          OS_TmrHardUnlink          (OS_TMR                *p_tmr);
+
+void          OS_TmrHardUpdate          (void);
+#endif
+
 void          OS_TmrInit                (OS_ERR                *p_err);
 
 void          OS_TmrLink                (OS_TMR                *p_tmr,
                                          OS_TICK                time);
 
-void          OS_TmrUnlink              (OS_TMR                *p_tmr,
-                                         OS_TICK                time);
+void          OS_TmrUnlink              (OS_TMR                *p_tmr);
 
 void          OS_TmrTask                (void                  *p_arg);
 
@@ -1936,6 +2682,9 @@ void          OS_StatTaskInit           (OS_ERR                *p_err);
 
 void          OS_TickInit               (OS_ERR                *p_err);
 void          OS_TickUpdate             (OS_TICK                ticks);
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+void          OS_TickUsUpdate           (void);
+#endif
 
 /*
 ************************************************************************************************************************
@@ -1992,6 +2741,10 @@ void          OS_Dbg_Init               (void);
 
 void          OS_MsgPoolInit            (OS_ERR                *p_err);
 
+void          OS_MsgPoolLink            (OS_MSG_POOL           *p_pool,
+                                         OS_MSG                *p_msg_tbl,
+                                         OS_MSG_QTY             qty);
+
 OS_MSG_QTY    OS_MsgQFreeAll            (OS_MSG_Q              *p_msg_q);
 
 void         *OS_MsgQGet                (OS_MSG_Q              *p_msg_q,
@@ -2009,12 +2762,38 @@ void          OS_MsgQPut                (OS_MSG_Q              *p_msg_q,
                                          CPU_TS                 ts,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_PRIO_EN > 0u)
+void          OS_MsgQPutPrio            (OS_MSG_Q              *p_msg_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_PRIO                prio,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_MSG_N_EN > 0u)
+OS_MSG_QTY    OS_MsgQGetN               (OS_MSG_Q              *p_msg_q,
+                                         void                  *p_msg_tbl[],
+                                         OS_MSG_SIZE            msg_size_tbl[],
+                                         OS_MSG_QTY             nbr_max,
+                                         CPU_TS                *p_ts);
+
+OS_MSG_QTY    OS_MsgQPutN               (OS_MSG_Q              *p_msg_q,
+                                         void                  *p_msg_tbl[],
+                                         OS_MSG_SIZE            msg_size_tbl[],
+                                         OS_MSG_QTY             nbr,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ---------------------------------------------- PEND/POST MANAGEMENT ---------------------------------------------- */
 
 void          OS_Pend                   (OS_PEND_OBJ           *p_obj,
                                          OS_TCB                *p_tcb,
                                          OS_STATE               pending_on,
-                                         OS_TICK                timeout);
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt);
 
 void          OS_PendAbort              (OS_TCB                *p_tcb,
                                          CPU_TS                 ts,
@@ -2047,6 +2826,17 @@ void          OS_SchedLockTimeMeasStop  (void);
 void          OS_SchedRoundRobin        (OS_RDY_LIST           *p_rdy_list);
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+void          OS_SchedEdfRelease        (OS_TCB                *p_tcb);
+#endif
+
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+OS_PRIO       OS_SchedThreshold         (OS_PRIO                prio);
+CPU_BOOLEAN   OS_SchedThresholdHeld     (OS_PRIO                prio);
+void          OS_SchedThresholdRemove   (OS_TCB                *p_tcb);
+void          OS_SchedThresholdSw       (void);
+#endif
+
 /* --------------------------------------------- READY LIST MANAGEMENT ---------------------------------------------- */
 
 void          OS_RdyListInit            (void);
@@ -2057,6 +2847,10 @@ void          OS_RdyListInsertHead      (OS_TCB                *p_tcb);
 
 void          OS_RdyListInsertTail      (OS_TCB                *p_tcb);
 
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+void          OS_RdyListInsertDeadline  (OS_TCB                *p_tcb);
+#endif
+
 void          OS_RdyListMoveHeadToTail  (OS_RDY_LIST           *p_rdy_list);
 
 void          OS_RdyListRemove          (OS_TCB                *p_tcb);
@@ -2094,10 +2888,30 @@ void          OS_TickListInsertDly      (OS_TCB                *p_tcb,
 
 void          OS_TickListRemove         (OS_TCB                *p_tcb);
 
+OS_TICK       OS_TickListNextGet        (void);
+
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+OS_TICK       OS_TickSlackAlign         (OS_TICK                match,
+                                         OS_TICK                slack);
+#endif
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+void          OS_TickUsListInsert       (OS_TCB                *p_tcb,
+                                         CPU_INT32U             us);
+
+void          OS_TickUsListRemove       (OS_TCB                *p_tcb);
+#endif
+
 #if (OS_CFG_DYN_TICK_EN > 0u)                                   /* OS_DynTick functions must be implemented in the BSP. */
 OS_TICK       OS_DynTickGet             (void);
 OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #endif
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)                                /* OS_UsTmr functions must be implemented in the BSP.   */
+CPU_INT32U    OS_UsTmrGet               (void);
+void          OS_UsTmrSet               (CPU_INT32U             match);
+void          OS_UsTmrStop              (void);
+#endif
 #endif
 
 
@@ -2168,6 +2982,22 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #endif
 
 
+#ifndef OS_CFG_SCHED_EDF_EN
+#error  "OS_CFG.H, Missing OS_CFG_SCHED_EDF_EN: Include code for Earliest-Deadline-First Scheduling"
+#else
+    #if (OS_CFG_SCHED_EDF_EN > 0u) && (OS_CFG_TICK_EN == 0u)
+    #error "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use Earliest-Deadline-First scheduling."
+    #endif
+    #if (OS_CFG_SCHED_EDF_EN > 0u)
+        #ifndef OS_CFG_SCHED_EDF_PRIO
+        #error "OS_CFG_APP.h, Missing OS_CFG_SCHED_EDF_PRIO: Priority of the Earliest-Deadline-First tasks"
+        #elif (OS_CFG_SCHED_EDF_PRIO == 0u) || (OS_CFG_SCHED_EDF_PRIO >= (OS_CFG_PRIO_MAX - 1u))
+        #error "OS_CFG_APP.h, OS_CFG_SCHED_EDF_PRIO must be > 0 and < OS_CFG_PRIO_MAX - 1"
+        #endif
+    #endif
+#endif
+
+
 #ifndef OS_CFG_STK_SIZE_MIN
 #error  "OS_CFG.H, Missing OS_CFG_STK_SIZE_MIN: Determines the minimum size for a task stack"
 #endif
@@ -2251,6 +3081,94 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #ifndef OS_CFG_Q_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_Q_PEND_ABORT_EN: Include code for OSQPendAbort()"
     #endif
+
+    #ifndef OS_CFG_Q_N_EN
+    #error  "OS_CFG.H, Missing OS_CFG_Q_N_EN: Include code for OSQPostN() & OSQPendN()"
+    #endif
+
+    #ifndef OS_CFG_Q_POST_BLOCKING_EN
+    #error  "OS_CFG.H, Missing OS_CFG_Q_POST_BLOCKING_EN: Include code for OS_OPT_POST_BLOCKING & OSQPostTimeoutSet()"
+    #endif
+
+    #ifndef OS_CFG_Q_PRIO_EN
+    #error  "OS_CFG.H, Missing OS_CFG_Q_PRIO_EN: Include code for OSQPrioSet() & OSQPostPrio()"
+    #endif
+#endif
+
+#ifndef OS_CFG_MSG_POOL_PRIVATE_EN
+#error  "OS_CFG.H, Missing OS_CFG_MSG_POOL_PRIVATE_EN: Enable (1) or Disable (0) private OS_MSG pools for (task) queues"
+#endif
+
+/*
+************************************************************************************************************************
+*                                              RING BUFFER MESSAGE QUEUES
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_RING_EN
+#error  "OS_CFG.H, Missing OS_CFG_RING_EN: Enable (1) or Disable (0) code generation for RINGS"
+#else
+    #ifndef OS_CFG_RING_DEL_EN
+    #error  "OS_CFG.H, Missing OS_CFG_RING_DEL_EN: Include code for OSRingDel()"
+    #endif
+
+    #ifndef OS_CFG_RING_FLUSH_EN
+    #error  "OS_CFG.H, Missing OS_CFG_RING_FLUSH_EN: Include code for OSRingFlush()"
+    #endif
+
+    #ifndef OS_CFG_RING_PEND_ABORT_EN
+    #error  "OS_CFG.H, Missing OS_CFG_RING_PEND_ABORT_EN: Include code for OSRingPendAbort()"
+    #endif
+
+    #if ((OS_CFG_RING_EN > 0u) && (OS_MSG_EN == 0u))
+    #error  "OS_CFG.H, OS_CFG_Q_EN or OS_CFG_TASK_Q_EN must be Enabled (1) to use rings, a pending task receives in OS_TCB.MsgPtr"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                    STREAM BUFFERS
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_STREAM_EN
+#error  "OS_CFG.H, Missing OS_CFG_STREAM_EN: Enable (1) or Disable (0) code generation for STREAMS"
+#else
+    #ifndef OS_CFG_STREAM_DEL_EN
+    #error  "OS_CFG.H, Missing OS_CFG_STREAM_DEL_EN: Include code for OSStreamDel()"
+    #endif
+
+    #ifndef OS_CFG_STREAM_PEND_ABORT_EN
+    #error  "OS_CFG.H, Missing OS_CFG_STREAM_PEND_ABORT_EN: Include code for OSStreamPendAbort()"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                               PUBLISH/SUBSCRIBE TOPICS
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_TOPIC_EN
+#error  "OS_CFG.H, Missing OS_CFG_TOPIC_EN: Enable (1) or Disable (0) code generation for TOPICS"
+#else
+    #if ((OS_CFG_TOPIC_EN > 0u) && ((OS_CFG_Q_EN == 0u) || (OS_CFG_MEM_EN == 0u)))
+    #error  "OS_CFG.H, OS_CFG_Q_EN and OS_CFG_MEM_EN must be Enabled (1) to use topics, buffers are OS_MEM blocks posted to OS_Qs"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                               PEND ON MULTIPLE OBJECTS
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_PEND_MULTI_EN
+#error  "OS_CFG.H, Missing OS_CFG_PEND_MULTI_EN: Enable (1) or Disable (0) code generation for OSPendMulti()"
+#else
+    #if ((OS_CFG_PEND_MULTI_EN > 0u) && (OS_CFG_SEM_EN == 0u) && (OS_CFG_Q_EN == 0u) && (OS_CFG_FLAG_EN == 0u))
+    #error  "OS_CFG.H, OS_CFG_SEM_EN, OS_CFG_Q_EN or OS_CFG_FLAG_EN must be Enabled (1) to use OSPendMulti()"
+    #endif
 #endif
 
 /*
@@ -2289,6 +3207,14 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_STAT_TASK_STK_CHK_EN: Check task stacks from statistics task"
 #endif
 
+#ifndef OS_CFG_TASK_BUDGET_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_BUDGET_EN: Include code for OSTaskBudgetSet()"
+#else
+    #if (OS_CFG_TASK_BUDGET_EN > 0u) && ((OS_CFG_TICK_EN == 0u) || (OS_CFG_DYN_TICK_EN > 0u))
+    #error  "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) & OS_CFG_DYN_TICK_EN Disabled (0) to use task budgets"
+    #endif
+#endif
+
 #ifndef OS_CFG_TASK_CHANGE_PRIO_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_CHANGE_PRIO_EN: Include code for OSTaskChangePrio()"
 #endif
@@ -2297,6 +3223,18 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_TASK_DEL_EN: Include code for OSTaskDel()"
 #endif
 
+#ifndef OS_CFG_TASK_PERIOD_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_PERIOD_EN: Include code for OSTaskPeriodSet() and OSTaskWaitNextPeriod()"
+#else
+    #if (OS_CFG_TASK_PERIOD_EN > 0u) && (OS_CFG_TICK_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use periodic tasks"
+    #endif
+#endif
+
+#ifndef OS_CFG_TASK_PREEMPT_THRESHOLD_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_PREEMPT_THRESHOLD_EN: Include code for OSTaskPreemptThresholdSet()"
+#endif
+
 #ifndef OS_CFG_TASK_Q_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_Q_EN: Include code for OSTaskQxxx()"
 #endif
@@ -2305,6 +3243,10 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_TASK_Q_PEND_ABORT_EN: Include code for OSTaskQPendAbort()"
 #endif
 
+#ifndef OS_CFG_TASK_Q_N_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_Q_N_EN: Include code for OSTaskQPostN() & OSTaskQPendN()"
+#endif
+
 #ifndef OS_CFG_TASK_PROFILE_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_PROFILE_EN: Include code for task profiling"
 #else
@@ -2344,6 +3286,26 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #endif
 #endif
 
+#ifndef OS_CFG_TICK_WHEEL_EN
+#error  "OS_CFG.H, Missing OS_CFG_TICK_WHEEL_EN: Enable (1) or Disable (0) the timing wheel tick list"
+#else
+    #if ((OS_CFG_TICK_EN == 0u) && (OS_CFG_TICK_WHEEL_EN > 0u))
+    #error "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use the timing wheel tick list"
+    #endif
+
+    #if ((OS_CFG_TICK_WHEEL_EN > 0u) && ((OS_CFG_TICK_WHEEL_LVL_NBR < 2u) || (OS_CFG_TICK_WHEEL_LVL_NBR > 6u)))
+    #error "OS_CFG.H, OS_CFG_TICK_WHEEL_LVL_NBR must be between 2 and 6"
+    #endif
+#endif
+
+#ifndef OS_CFG_TICK_SLACK_EN
+#error  "OS_CFG.H, Missing OS_CFG_TICK_SLACK_EN: Enable (1) or Disable (0) timer slack to coalesce delays & timeouts"
+#else
+    #if ((OS_CFG_TICK_EN == 0u) && (OS_CFG_TICK_SLACK_EN > 0u))
+    #error "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use timer slack"
+    #endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                  TIME MANAGEMENT
@@ -2358,6 +3320,14 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_TIME_DLY_RESUME_EN: Include code for OSTimeDlyResume()"
 #endif
 
+#ifndef OS_CFG_TIME_DLY_US_EN
+#error  "OS_CFG.H, Missing OS_CFG_TIME_DLY_US_EN: Include code for OSTimeDlyUs() & microsecond pend timeouts"
+#else
+    #if ((OS_CFG_TICK_EN == 0u) && (OS_CFG_TIME_DLY_US_EN > 0u))
+    #error "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use microsecond delays"
+    #endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                  TIMER MANAGEMENT
@@ -2387,6 +3357,22 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #ifndef OS_CFG_TMR_DEL_EN
     #error  "OS_CFG.H, Missing OS_CFG_TMR_DEL_EN: Enables (1) or Disables (0) code for OSTmrDel()"
     #endif
+
+    #ifndef OS_CFG_TMR_HARD_EN
+    #error  "OS_CFG.H, Missing OS_CFG_TMR_HARD_EN: Enables (1) or Disables (0) hard timers"
+    #elif ((OS_CFG_TMR_HARD_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u))
+    #error  "OS_CFG.H, OS_CFG_DYN_TICK_EN must be Disabled (0) to use hard timers"
+    #endif
+
+    #ifndef OS_CFG_TMR_LANE_EN
+    #error  "OS_CFG.H, Missing OS_CFG_TMR_LANE_EN: Enables (1) or Disables (0) timer callback lanes"
+    #endif
+
+    #ifndef OS_CFG_TMR_WHEEL_LVL_NBR
+    #error  "OS_CFG.H, Missing OS_CFG_TMR_WHEEL_LVL_NBR: Number of levels of the timer wheel"
+    #elif ((OS_CFG_TMR_WHEEL_LVL_NBR < 2u) || (OS_CFG_TMR_WHEEL_LVL_NBR > 6u))
+    #error  "OS_CFG.H, OS_CFG_TMR_WHEEL_LVL_NBR must be between 2 and 6"
+    #endif
 #endif
 #endif
 
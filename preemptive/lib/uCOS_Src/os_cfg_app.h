@@ -46,6 +46,11 @@
 #define  OS_CFG_IDLE_TASK_STK_SIZE                        64u
 
 
+                                                                /* ------------------ EDF SCHEDULING ------------------ */
+                                                                /* Priority whose tasks are ordered by deadline         */
+#define  OS_CFG_SCHED_EDF_PRIO           (OS_CFG_PRIO_MAX/2u)
+
+
                                                                 /* ------------------ STATISTIC TASK ------------------ */
                                                                 /* Priority                                             */
 #define  OS_CFG_STAT_TASK_PRIO  ((OS_PRIO)(OS_CFG_PRIO_MAX-2u))
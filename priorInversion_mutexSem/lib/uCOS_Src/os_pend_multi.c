@@ -0,0 +1,709 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       PEND ON MULTIPLE OBJECTS
+*
+* File    : os_pend_multi.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) A task waiting in OSPendMulti() is in none of the pend lists.  Each entry of its
+*               OS_PEND_DATA table is linked, in priority order, in the 'PendMultiPtr' list of the object it
+*               designates instead.
+*
+*           (2) A post to an object compares the priority of the head of its pend list with the head of its
+*               'PendMultiPtr' list & readies the higher one (see OS_PEND_LIST_HEAD()), so posting stays
+*               O(1) whatever the number of objects each task waits on.
+*
+*           (3) Once one of its objects readies the task, OS_PendListRemove() calls OS_PendMultiRemove()
+*               to unlink all the entries of the table.  This also covers timeouts, pend aborts, deletions
+*               & OSTaskDel().
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_pend_multi__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_PEND_DATA  **OS_PendMultiListGet    (OS_PEND_OBJ    *p_obj);
+
+static  void            OS_PendMultiListInsert (OS_PEND_DATA  **p_head,
+                                                OS_PEND_DATA   *p_pend_data);
+
+static  void            OS_PendMultiListRemove (OS_PEND_DATA  **p_head,
+                                                OS_PEND_DATA   *p_pend_data);
+
+static  OS_OBJ_QTY      OS_PendMultiGetRdy     (OS_PEND_DATA   *p_pend_data_tbl,
+                                                OS_OBJ_QTY      tbl_size,
+                                                CPU_BOOLEAN    *p_sched);
+
+#if (OS_CFG_FLAG_EN > 0u)
+static  void            OS_PendMultiFlagConsume(OS_PEND_DATA   *p_pend_data);
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             PEND ON MULTIPLE OBJECTS
+*
+* Description: This function waits on several semaphores, message queues and event flag groups at once.  It returns as
+*              soon as at least one of them is ready, or when the timeout expires.
+*
+* Arguments  : p_pend_data_tbl   is a table of 'tbl_size' OS_PEND_DATA entries, one per object to wait on.  For each
+*                                entry you fill in:
+*
+*                                    .PendObjPtr    a pointer to the semaphore, message queue or event flag group
+*                                    .FlagsPend     the flags to wait on        (event flag groups only)
+*                                    .FlagsOpt      OS_OPT_PEND_FLAG_xxx and optionally OS_OPT_PEND_FLAG_CONSUME
+*                                                                               (event flag groups only)
+*
+*                                On return, '.RdyObjPtr' is equal to '.PendObjPtr' for each object that is ready and
+*                                NULL for the others.  A ready queue entry also holds the message in '.RdyMsgPtr' and
+*                                '.RdyMsgSize', a ready flag group entry the flags that made it ready in '.RdyFlags'.
+*
+*              tbl_size          is the number of entries in the table
+*
+*              timeout           is an optional timeout period (in clock ticks).  If non-zero, your task will wait for
+*                                any of the objects up to the amount of time specified by this argument.  If you
+*                                specify 0, however, your task will wait forever or, until one of the objects is ready.
+*
+*              opt               determines whether the user wants to block if no object is ready:
+*
+*                                    OS_OPT_PEND_BLOCKING
+*                                    OS_OPT_PEND_NON_BLOCKING
+*
+*                                Add OS_OPT_PEND_TIMEOUT_US to give 'timeout' in microseconds (see OSTimeDlyUs()).
+*
+*              p_err             is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                    OS_ERR_NONE               At least one object was ready
+*                                    OS_ERR_FLAG_PEND_OPT      If an event flag group entry has an invalid '.FlagsOpt'
+*                                    OS_ERR_OBJ_DEL            If an object was deleted, it is the ready entry
+*                                    OS_ERR_OBJ_PTR_NULL       If an entry has a NULL '.PendObjPtr'
+*                                    OS_ERR_OBJ_TYPE           If an entry is not a semaphore, queue or flag group
+*                                    OS_ERR_OPT_INVALID        If you specified an invalid value for 'opt'
+*                                    OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                    OS_ERR_PEND_ABORT         If the wait was aborted, the aborted object is the
+*                                                              ready entry
+*                                    OS_ERR_PEND_ISR           If you called this function from an ISR and the result
+*                                                              would lead to a suspension
+*                                    OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but no object was ready
+*                                    OS_ERR_PTR_INVALID        If 'p_pend_data_tbl' is NULL, 'tbl_size' is 0 or an
+*                                                              object is in the table twice
+*                                    OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                    OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                    OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                    OS_ERR_TIMEOUT            No object was ready within the specified timeout
+*
+* Returns    : The number of ready entries, 0 on a timeout or an error.
+*
+* Note(s)    : 1) If objects are ready on entry they are all taken: each semaphore is decremented, a message is
+*                 removed from each queue and flags are consumed if requested.  Otherwise the first object posted
+*                 readies the task and is the only ready entry.
+*
+*              2) Tasks waiting in OSPendMulti() and in OSSemPend(), OSQPend() or OSFlagPend() on the same object are
+*                 served in priority order.  OSSemPendAbort(), OSQPendAbort() and OSFlagPendAbort() abort both.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSPendMulti (OS_PEND_DATA  *p_pend_data_tbl,
+                         OS_OBJ_QTY     tbl_size,
+                         OS_TICK        timeout,
+                         OS_OPT         opt,
+                         OS_ERR        *p_err)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     nbr_rdy;
+    OS_OBJ_QTY     i;
+    CPU_BOOLEAN    sched;
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    OS_OBJ_QTY     j;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return (0u);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_pend_data_tbl == (OS_PEND_DATA *)0) ||               /* Validate the table                                   */
+        (tbl_size        ==                0u)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (OS_OPT_PEND_OPT(opt)) {                             /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+    for (i = 0u; i < tbl_size; i++) {                           /* Validate the entries                                 */
+        p_pend_data = &p_pend_data_tbl[i];
+#if (OS_CFG_ARG_CHK_EN > 0u)
+        if (p_pend_data->PendObjPtr == (OS_PEND_OBJ *)0) {
+           *p_err = OS_ERR_OBJ_PTR_NULL;
+            return (0u);
+        }
+        for (j = 0u; j < i; j++) {                              /* An object may only be waited on once                 */
+            if (p_pend_data_tbl[j].PendObjPtr == p_pend_data->PendObjPtr) {
+               *p_err = OS_ERR_PTR_INVALID;
+                return (0u);
+            }
+        }
+#endif
+        switch (p_pend_data->PendObjPtr->Type) {
+#if (OS_CFG_SEM_EN > 0u)
+            case OS_OBJ_TYPE_SEM:
+                 break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+            case OS_OBJ_TYPE_Q:
+                 break;
+#endif
+
+#if (OS_CFG_FLAG_EN > 0u)
+            case OS_OBJ_TYPE_FLAG:
+#if (OS_CFG_ARG_CHK_EN > 0u)
+                 switch (p_pend_data->FlagsOpt & (OS_OPT)~OS_OPT_PEND_FLAG_CONSUME) {
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+                     case OS_OPT_PEND_FLAG_CLR_ALL:
+                     case OS_OPT_PEND_FLAG_CLR_ANY:
+#endif
+                     case OS_OPT_PEND_FLAG_SET_ALL:
+                     case OS_OPT_PEND_FLAG_SET_ANY:
+                          break;
+
+                     default:
+                         *p_err = OS_ERR_FLAG_PEND_OPT;
+                          return (0u);
+                 }
+#endif
+                 break;
+#endif
+
+            default:                                            /* Make sure the object can be waited on                */
+                *p_err = OS_ERR_OBJ_TYPE;
+                 return (0u);
+        }
+    }
+
+    CPU_CRITICAL_ENTER();
+    nbr_rdy = OS_PendMultiGetRdy(p_pend_data_tbl,               /* Any object ready?                                    */
+                                 tbl_size,
+                                 &sched);
+    if (nbr_rdy > 0u) {                                         /* Yes, see Note #1                                     */
+        CPU_CRITICAL_EXIT();
+        if (sched == OS_TRUE) {                                 /* Run the tasks that could post to the queues          */
+            OSSched();
+        }
+       *p_err = OS_ERR_NONE;
+        return (nbr_rdy);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return (0u);
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+    for (i = 0u; i < tbl_size; i++) {                           /* Wait on each object, see Note #1 at the top          */
+        p_pend_data = &p_pend_data_tbl[i];
+        OS_PendMultiListInsert(OS_PendMultiListGet(p_pend_data->PendObjPtr),
+                               p_pend_data);
+    }
+    OSTCBCurPtr->PendDataTblPtr  = p_pend_data_tbl;
+    OSTCBCurPtr->PendDataEntries = tbl_size;
+    OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task pending on the objects                    */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_MULTI,
+            timeout,
+            opt);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    nbr_rdy = 0u;
+    for (i = 0u; i < tbl_size; i++) {                           /* Find the entry that readied us                       */
+        p_pend_data = &p_pend_data_tbl[i];
+        if (p_pend_data->RdyObjPtr != (OS_PEND_OBJ *)0) {
+            nbr_rdy = 1u;
+            break;
+        }
+    }
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Collect what was posted                              */
+#if (OS_CFG_Q_EN > 0u)
+             if (p_pend_data->PendObjPtr->Type == OS_OBJ_TYPE_Q) {
+                 p_pend_data->RdyMsgPtr  = OSTCBCurPtr->MsgPtr;
+                 p_pend_data->RdyMsgSize = OSTCBCurPtr->MsgSize;
+             }
+#endif
+#if (OS_CFG_FLAG_EN > 0u)
+             if (p_pend_data->PendObjPtr->Type == OS_OBJ_TYPE_FLAG) {
+                 p_pend_data->RdyFlags = OSTCBCurPtr->FlagsRdy;
+                 OS_PendMultiFlagConsume(p_pend_data);
+             }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+             p_pend_data->RdyTS      = OSTCBCurPtr->TS;
+#endif
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get any object within timeout*/
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that an object pended on has been deleted   */
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (nbr_rdy);
+}
+
+
+/*
+************************************************************************************************************************
+*                                   CHANGE THE PRIORITY OF A TASK WAITING IN OSPendMulti()
+*
+* Description: This function is called by OS_TaskChangePrio() to move the entries of a task waiting in OSPendMulti()
+*              to their new position in the lists of the objects.
+*
+* Arguments  : p_tcb    is a pointer to the TCB of the task, with its new priority in .Prio
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_PendMultiChangePrio (OS_TCB  *p_tcb)
+{
+    OS_PEND_DATA   *p_pend_data;
+    OS_PEND_DATA  **p_head;
+    OS_OBJ_QTY      i;
+
+
+    for (i = 0u; i < p_tcb->PendDataEntries; i++) {
+        p_pend_data = &p_tcb->PendDataTblPtr[i];
+        p_head      =  OS_PendMultiListGet(p_pend_data->PendObjPtr);
+        OS_PendMultiListRemove(p_head, p_pend_data);
+        OS_PendMultiListInsert(p_head, p_pend_data);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                      FIND THE NEXT TASK TO READY ON AN OBJECT
+*
+* Description: This function returns the highest priority task waiting on a semaphore, message queue or event flag
+*              group, either in its pend list or in OSPendMulti().
+*
+* Arguments  : p_obj          is a pointer to the object
+*              -----
+*
+*              p_pend_data    is the head of the object's list of OSPendMulti() entries
+*
+* Returns    : A pointer to the task's TCB, or a NULL pointer if no task is waiting.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.  Use OS_PEND_LIST_HEAD().
+*
+*              2) The caller readies the task returned right away.  If it is waiting in OSPendMulti() its entry is
+*                 marked ready so OSPendMulti() knows which object readied it.
+************************************************************************************************************************
+*/
+
+OS_TCB  *OS_PendMultiNext (OS_PEND_OBJ   *p_obj,
+                           OS_PEND_DATA  *p_pend_data)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = p_obj->PendList.HeadPtr;
+    if (p_pend_data != (OS_PEND_DATA *)0) {
+        if ((p_tcb                == (OS_TCB *)0) ||            /* Equal priorities favor the pend list                 */
+            (p_pend_data->TCBPtr->Prio < p_tcb->Prio)) {
+            p_pend_data->RdyObjPtr = p_obj;                     /* See Note #2                                          */
+            p_tcb                  = p_pend_data->TCBPtr;
+        }
+    }
+    return (p_tcb);
+}
+
+
+/*
+************************************************************************************************************************
+*                                    REMOVE A TASK WAITING IN OSPendMulti() FROM ITS OBJECTS
+*
+* Description: This function unlinks all the entries of the table of a task waiting in OSPendMulti().
+*
+* Arguments  : p_tcb    is a pointer to the TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.  It is called by
+*                 OS_PendListRemove().
+************************************************************************************************************************
+*/
+
+void  OS_PendMultiRemove (OS_TCB  *p_tcb)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+
+
+    for (i = 0u; i < p_tcb->PendDataEntries; i++) {
+        p_pend_data = &p_tcb->PendDataTblPtr[i];
+        OS_PendMultiListRemove(OS_PendMultiListGet(p_pend_data->PendObjPtr),
+                               p_pend_data);
+    }
+    p_tcb->PendDataTblPtr  = (OS_PEND_DATA *)0;
+    p_tcb->PendDataEntries =                 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                      TAKE THE OBJECTS READY ON ENTRY TO OSPendMulti()
+*
+* Description: This function initializes the entries of an OSPendMulti() table and takes every object that is ready.
+*
+* Arguments  : p_pend_data_tbl   is the table passed to OSPendMulti()
+*
+*              tbl_size          is the number of entries in the table
+*
+*              p_sched           is set to OS_TRUE if a task waiting to post to a queue was readied
+*
+* Returns    : The number of ready entries.
+*
+* Note(s)    : 1) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_PendMultiGetRdy (OS_PEND_DATA  *p_pend_data_tbl,
+                                        OS_OBJ_QTY     tbl_size,
+                                        CPU_BOOLEAN   *p_sched)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     nbr_rdy;
+    OS_OBJ_QTY     i;
+#if (OS_CFG_SEM_EN > 0u)
+    OS_SEM        *p_sem;
+#endif
+#if (OS_CFG_Q_EN > 0u)
+    OS_Q          *p_q;
+    OS_ERR         err;
+#endif
+#if (OS_CFG_FLAG_EN > 0u)
+    OS_FLAG_GRP   *p_grp;
+#endif
+
+
+   *p_sched = OS_FALSE;
+    nbr_rdy = 0u;
+    for (i = 0u; i < tbl_size; i++) {
+        p_pend_data            = &p_pend_data_tbl[i];
+        p_pend_data->PrevPtr   = (OS_PEND_DATA *)0;
+        p_pend_data->NextPtr   = (OS_PEND_DATA *)0;
+        p_pend_data->TCBPtr    =  OSTCBCurPtr;
+        p_pend_data->RdyObjPtr = (OS_PEND_OBJ  *)0;
+#if (OS_CFG_Q_EN > 0u)
+        p_pend_data->RdyMsgPtr  = (void *)0;
+        p_pend_data->RdyMsgSize =         0u;
+#endif
+#if (OS_CFG_FLAG_EN > 0u)
+        p_pend_data->RdyFlags   =         0u;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+        p_pend_data->RdyTS      =         0u;
+#endif
+        switch (p_pend_data->PendObjPtr->Type) {
+#if (OS_CFG_SEM_EN > 0u)
+            case OS_OBJ_TYPE_SEM:
+                 p_sem = (OS_SEM *)((void *)p_pend_data->PendObjPtr);
+                 if (p_sem->Ctr > 0u) {                         /* Resource available?                                  */
+                     p_sem->Ctr--;                              /* Yes, take it                                         */
+#if (OS_CFG_TS_EN > 0u)
+                     p_pend_data->RdyTS = p_sem->TS;
+#endif
+                     p_pend_data->RdyObjPtr = p_pend_data->PendObjPtr;
+                     nbr_rdy++;
+                 }
+                 break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+            case OS_OBJ_TYPE_Q:
+                 p_q = (OS_Q *)((void *)p_pend_data->PendObjPtr);
+#if (OS_CFG_TS_EN > 0u)
+                 p_pend_data->RdyMsgPtr = OS_MsgQGet(&p_q->MsgQ,    /* Any message waiting in the message queue?        */
+                                                     &p_pend_data->RdyMsgSize,
+                                                     &p_pend_data->RdyTS,
+                                                     &err);
+#else
+                 p_pend_data->RdyMsgPtr = OS_MsgQGet(&p_q->MsgQ,    /* Any message waiting in the message queue?        */
+                                                     &p_pend_data->RdyMsgSize,
+                                                     (CPU_TS *)0,
+                                                     &err);
+#endif
+                 if (err == OS_ERR_NONE) {
+                     p_pend_data->RdyObjPtr = p_pend_data->PendObjPtr;
+                     nbr_rdy++;
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u)
+                     if (OS_QPostRdy(p_q) == OS_TRUE) {         /* Give the room freed to a task waiting to post        */
+                        *p_sched = OS_TRUE;
+                     }
+#endif
+                 }
+                 break;
+#endif
+
+#if (OS_CFG_FLAG_EN > 0u)
+            case OS_OBJ_TYPE_FLAG:
+                 p_grp                 = (OS_FLAG_GRP *)((void *)p_pend_data->PendObjPtr);
+                 p_pend_data->RdyFlags =  OS_FlagPendMultiRdy(p_grp, p_pend_data);
+                 if (p_pend_data->RdyFlags != 0u) {             /* Condition satisfied?                                 */
+#if (OS_CFG_TS_EN > 0u)
+                     p_pend_data->RdyTS = p_grp->TS;
+#endif
+                     p_pend_data->RdyObjPtr = p_pend_data->PendObjPtr;
+                     OS_PendMultiFlagConsume(p_pend_data);
+                     nbr_rdy++;
+                 }
+                 break;
+#endif
+
+            default:
+                 break;
+        }
+    }
+    return (nbr_rdy);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        CONSUME THE FLAGS OF A READY FLAG GROUP ENTRY
+*
+* Description: This function clears (or sets, when waiting for flags to be clear) the flags that made an event flag
+*              group entry ready, if its '.FlagsOpt' includes OS_OPT_PEND_FLAG_CONSUME.
+*
+* Arguments  : p_pend_data    is a pointer to the ready entry
+*              -----------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_EN > 0u)
+static  void  OS_PendMultiFlagConsume (OS_PEND_DATA  *p_pend_data)
+{
+    OS_FLAG_GRP  *p_grp;
+
+
+    if ((p_pend_data->FlagsOpt & OS_OPT_PEND_FLAG_CONSUME) == 0u) {
+        return;
+    }
+    p_grp = (OS_FLAG_GRP *)((void *)p_pend_data->PendObjPtr);
+    switch (p_pend_data->FlagsOpt & OS_OPT_PEND_FLAG_MASK) {
+        case OS_OPT_PEND_FLAG_SET_ALL:
+        case OS_OPT_PEND_FLAG_SET_ANY:                          /* Clear ONLY the flags we got                          */
+             p_grp->Flags &= ~p_pend_data->RdyFlags;
+             break;
+
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+        case OS_OPT_PEND_FLAG_CLR_ALL:
+        case OS_OPT_PEND_FLAG_CLR_ANY:                          /* Set   ONLY the flags we got                          */
+             p_grp->Flags |=  p_pend_data->RdyFlags;
+             break;
+#endif
+
+        default:
+             break;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                      GET THE LIST OF OSPendMulti() ENTRIES OF AN OBJECT
+*
+* Description: This function returns a pointer to the head of the list of OSPendMulti() entries of an object.
+*
+* Arguments  : p_obj    is a pointer to a semaphore, a message queue or an event flag group
+*              -----
+*
+* Returns    : A pointer to the object's 'PendMultiPtr'.
+************************************************************************************************************************
+*/
+
+static  OS_PEND_DATA  **OS_PendMultiListGet (OS_PEND_OBJ  *p_obj)
+{
+    OS_PEND_DATA  **p_head;
+
+
+    switch (p_obj->Type) {
+#if (OS_CFG_SEM_EN > 0u)
+        case OS_OBJ_TYPE_SEM:
+             p_head = &((OS_SEM *)((void *)p_obj))->PendMultiPtr;
+             break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+        case OS_OBJ_TYPE_Q:
+             p_head = &((OS_Q *)((void *)p_obj))->PendMultiPtr;
+             break;
+#endif
+
+#if (OS_CFG_FLAG_EN > 0u)
+        case OS_OBJ_TYPE_FLAG:
+             p_head = &((OS_FLAG_GRP *)((void *)p_obj))->PendMultiPtr;
+             break;
+#endif
+
+        default:                                                /* OSPendMulti() only accepts the types above           */
+             p_head = (OS_PEND_DATA **)0;
+             break;
+    }
+    return (p_head);
+}
+
+
+/*
+************************************************************************************************************************
+*                                  INSERT/REMOVE AN ENTRY IN/FROM THE OSPendMulti() LIST OF AN OBJECT
+*
+* Description: These functions link an entry in priority order in the list of an object, after the entries of the same
+*              priority, or unlink it.
+*
+* Arguments  : p_head         is a pointer to the head of the list
+*
+*              p_pend_data    is a pointer to the entry, its '.TCBPtr' gives the priority
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_PendMultiListInsert (OS_PEND_DATA  **p_head,
+                                      OS_PEND_DATA   *p_pend_data)
+{
+    OS_PEND_DATA  *p_prev;
+    OS_PEND_DATA  *p_next;
+    OS_PRIO        prio;
+
+
+    prio   =  p_pend_data->TCBPtr->Prio;
+    p_prev = (OS_PEND_DATA *)0;
+    p_next = *p_head;
+    while ((p_next               != (OS_PEND_DATA *)0) &&       /* Find the first entry of lower priority               */
+           (p_next->TCBPtr->Prio <= prio)) {
+        p_prev = p_next;
+        p_next = p_next->NextPtr;
+    }
+    p_pend_data->PrevPtr = p_prev;
+    p_pend_data->NextPtr = p_next;
+    if (p_prev == (OS_PEND_DATA *)0) {
+       *p_head           = p_pend_data;
+    } else {
+        p_prev->NextPtr  = p_pend_data;
+    }
+    if (p_next != (OS_PEND_DATA *)0) {
+        p_next->PrevPtr  = p_pend_data;
+    }
+}
+
+
+static  void  OS_PendMultiListRemove (OS_PEND_DATA  **p_head,
+                                      OS_PEND_DATA   *p_pend_data)
+{
+    if (p_pend_data->PrevPtr == (OS_PEND_DATA *)0) {
+       *p_head                        = p_pend_data->NextPtr;
+    } else {
+        p_pend_data->PrevPtr->NextPtr = p_pend_data->NextPtr;
+    }
+    if (p_pend_data->NextPtr != (OS_PEND_DATA *)0) {
+        p_pend_data->NextPtr->PrevPtr = p_pend_data->PrevPtr;
+    }
+    p_pend_data->PrevPtr = (OS_PEND_DATA *)0;
+    p_pend_data->NextPtr = (OS_PEND_DATA *)0;
+}
+#endif
@@ -54,6 +54,9 @@ void  OS_PrioInit (void)
     for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
          OSPrioTbl[i] = 0u;
     }
+#if (OS_PRIO_GRP_EN > 0u)
+    OSPrioGrp = 0u;
+#endif
 
 #if (OS_CFG_TASK_IDLE_EN == 0u)
     OS_PrioInsert ((OS_PRIO)(OS_CFG_PRIO_MAX - 1u));            /* Insert what would be the idle task                   */
@@ -89,6 +92,14 @@ OS_PRIO  OS_PrioGetHighest (void)
     }
 
 
+#elif (OS_PRIO_GRP_EN > 0u)                                     /* Two levels, up to the square of the word size        */
+    OS_PRIO  ix;
+
+
+    ix = (OS_PRIO)CPU_CntLeadZeros(OSPrioGrp);                  /* Find the first non-empty entry of the bitmap table   */
+    return ((OS_PRIO)((ix * (CPU_CFG_DATA_SIZE * 8u)) + (OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[ix])));
+
+
 #else
     CPU_DATA  *p_tbl;
     OS_PRIO    prio;
@@ -141,6 +152,9 @@ void  OS_PrioInsert (OS_PRIO  prio)
     ix             = (OS_PRIO)(prio /  (CPU_CFG_DATA_SIZE * 8u));
     bit_nbr        = (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
     OSPrioTbl[ix] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr);
+#if (OS_PRIO_GRP_EN > 0u)
+    OSPrioGrp     |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix);
+#endif
 #endif
 }
 
@@ -179,5 +193,10 @@ void  OS_PrioRemove (OS_PRIO  prio)
     ix             =   (OS_PRIO)(prio  /   (CPU_CFG_DATA_SIZE * 8u));
     bit_nbr        =   (CPU_DATA)prio  &  ((CPU_CFG_DATA_SIZE * 8u) - 1u);
     OSPrioTbl[ix] &= ~((CPU_DATA)  1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr));
+#if (OS_PRIO_GRP_EN > 0u)
+    if (OSPrioTbl[ix] == 0u) {                                  /* Last ready priority of this entry?                   */
+        OSPrioGrp &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix));
+    }
+#endif
 #endif
 }
@@ -0,0 +1,1020 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                  RING BUFFER MESSAGE QUEUE MANAGEMENT
+*
+* File    : os_ring.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) A ring is a message queue that copies fixed-size messages in & out of an array supplied at
+*               creation, instead of linking pointers to them in OS_MSGs taken from the OS_MSG pool.  The
+*               producer may reuse its buffer as soon as OSRingPost() returns & a full ring never runs
+*               other queues out of OS_MSGs.
+*
+*           (2) A message posted while a task is waiting is copied straight into the waiting task's buffer,
+*               it never goes through the array.
+*
+*           (3) Messages are copied with interrupts disabled, rings are meant for small messages (a few tens
+*               of bytes).  Larger data should be passed by reference through an OS_Q.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_ring__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_RING_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_RingCopy (void         *p_dest,
+                           void         *p_src,
+                           OS_MSG_SIZE   size);
+
+
+/*
+************************************************************************************************************************
+*                                                    CREATE A RING
+*
+* Description: This function is called by your application to create a ring.  Rings MUST be created before they can be
+*              used.
+*
+* Arguments  : p_ring      is a pointer to the ring
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the ring
+*
+*              p_storage   is a pointer to the array that will hold the messages.  It must be at least
+*                          'msg_size * max_qty' bytes long.
+*
+*              msg_size    is the size of every message, in bytes (must be non-zero)
+*
+*              max_qty     is the number of messages the ring can hold.  It MUST be a power of 2.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the ring after you called
+*                                                               OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_ring'
+*                              OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_storage'
+*                              OS_ERR_Q_SIZE                  If 'msg_size' is 0 or 'max_qty' is not a power of 2
+*                              OS_ERR_OBJ_CREATED             If the ring was already created
+*
+* Returns    : none
+*
+* Note(s)    : 1) Messages are copied a CPU_ALIGN word at a time when 'p_storage' & 'msg_size' are multiples of
+*                 sizeof(CPU_ALIGN), the buffers passed to OSRingPost() & OSRingPend() should then be aligned too.
+************************************************************************************************************************
+*/
+
+void  OSRingCreate (OS_RING      *p_ring,
+                    CPU_CHAR     *p_name,
+                    void         *p_storage,
+                    OS_MSG_SIZE   msg_size,
+                    OS_MSG_QTY    max_qty,
+                    OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_storage == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (msg_size == 0u) {                                       /* Cannot specify empty messages                        */
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+    if ((max_qty == 0u) ||                                      /* The ring size must be a power of 2                   */
+        ((max_qty & (OS_MSG_QTY)(max_qty - 1u)) != 0u)) {
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    if (p_ring->Type == OS_OBJ_TYPE_RING) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+    p_ring->Type          = OS_OBJ_TYPE_RING;                   /* Mark the data structure as a ring                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_ring->NamePtr       = p_name;
+#else
+    (void)p_name;
+#endif
+    p_ring->StoragePtr    = (CPU_INT08U *)p_storage;
+    p_ring->MsgSize       = msg_size;
+    p_ring->NbrMax        = max_qty;
+    p_ring->InIx          = 0u;                                 /* The ring is empty                                    */
+    p_ring->OutIx         = 0u;
+    p_ring->NbrEntriesMax = 0u;
+    OS_PendListInit(&p_ring->PendList);                         /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_RingDbgListAdd(p_ring);
+    OSRingQty++;                                                /* One more ring created                                */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    DELETE A RING
+*
+* Description: This function deletes a ring and readies all tasks pending on the ring.
+*
+* Arguments  : p_ring    is a pointer to the ring you want to delete
+*
+*              opt       determines delete options as follows:
+*
+*                            OS_OPT_DEL_NO_PEND          Delete the ring ONLY if no task pending
+*                            OS_OPT_DEL_ALWAYS           Deletes the ring even if tasks are waiting.
+*                                                        In this case, all the tasks pending will be readied.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    The call was successful and the ring was deleted
+*                            OS_ERR_DEL_ISR                 If you tried to delete the ring from an ISR
+*                            OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the ring after you called
+*                                                             OSStart()
+*                            OS_ERR_OBJ_PTR_NULL            If you pass a NULL pointer for 'p_ring'
+*                            OS_ERR_OBJ_TYPE                If the ring was not created
+*                            OS_ERR_OPT_INVALID             An invalid option was specified
+*                            OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                            OS_ERR_TASK_WAITING            One or more tasks were waiting on the ring
+*
+* Returns    : == 0          if no tasks were waiting on the ring, or upon error.
+*              >  0          if one or more tasks waiting on the ring are now readied and informed.
+*
+* Note(s)    : 1) Tasks that would normally expect the presence of the ring MUST check the return code of OSRingPend().
+*
+*              2) The array given to OSRingCreate() can be reused once the ring is deleted.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RING_DEL_EN > 0u)
+OS_OBJ_QTY  OSRingDel (OS_RING  *p_ring,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't delete a ring from an ISR                      */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate 'p_ring'                                    */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_ring->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete ring only if no task waiting                  */
+             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_RingDbgListRemove(p_ring);
+                 OSRingQty--;
+#endif
+                 OS_RingClr(p_ring);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the ring                               */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get local time stamp so all tasks get the same time  */
+#else
+             ts = 0u;
+#endif
+             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
+                 p_tcb = p_pend_list->HeadPtr;
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_RingDbgListRemove(p_ring);
+             OSRingQty--;
+#endif
+             OS_RingClr(p_ring);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                     FLUSH A RING
+*
+* Description : This function discards the messages waiting in a ring.
+*
+* Arguments   : p_ring     is a pointer to the ring to flush
+*
+*               p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE              Upon success
+*                              OS_ERR_FLUSH_ISR         If you called this function from an ISR
+*                              OS_ERR_OBJ_PTR_NULL      If you passed a NULL pointer for 'p_ring'
+*                              OS_ERR_OBJ_TYPE          If you didn't create the ring
+*                              OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*
+* Returns     : == 0       if no messages were discarded, or upon error.
+*               >  0       the number of discarded messages.
+*
+* Note(s)     : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RING_FLUSH_EN > 0u)
+OS_MSG_QTY  OSRingFlush (OS_RING  *p_ring,
+                         OS_ERR   *p_err)
+{
+    OS_MSG_QTY  entries;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't flush a ring from an ISR                       */
+       *p_err = OS_ERR_FLUSH_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    entries       = (OS_MSG_QTY)(p_ring->InIx - p_ring->OutIx);
+    p_ring->OutIx =  p_ring->InIx;                              /* Drop every message waiting                           */
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (entries);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            PEND ON A RING FOR A MESSAGE
+*
+* Description: This function waits for a message to be sent to a ring & copies it to the caller's buffer.
+*
+* Arguments  : p_ring        is a pointer to the ring
+*
+*              p_msg         is a pointer to the buffer that will receive the message.  It must be at least the
+*                            'msg_size' given to OSRingCreate() long.
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            message to arrive at the ring up to the amount of time specified by this argument.  If you
+*                            specify 0, however, your task will wait forever at the specified ring or, until a message
+*                            arrives.
+*
+*              opt           determines whether the user wants to block if the ring is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_TIMEOUT_US to give 'timeout' in microseconds (see OSTimeDlyUs()).
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the message was
+*                            received, pend aborted or the ring deleted.  If you pass a NULL pointer (i.e.
+*                            (CPU_TS *)0) then you will not get the timestamp.  See Note #1.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received a message
+*                                OS_ERR_OBJ_DEL            If 'p_ring' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_ring'
+*                                OS_ERR_OBJ_TYPE           If the ring was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the ring was empty
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_msg'
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : none
+*
+* Note(s)    : 1) The ring doesn't keep a timestamp per message, '*p_ts' is set to 0 when the message was already
+*                 waiting in the ring.
+*
+*              2) This API 'MUST NOT' be called from a timer callback function.
+*
+*              3) A task which blocks leaves 'p_msg' in its TCB (.MsgPtr).  OSRingPost() copies the message straight
+*                 into that buffer & readies the task, the message never goes through the ring.
+************************************************************************************************************************
+*/
+
+void  OSRingPend (OS_RING   *p_ring,
+                  void      *p_msg,
+                  OS_TICK    timeout,
+                  OS_OPT     opt,
+                  CPU_TS    *p_ts,
+                  OS_ERR    *p_err)
+{
+    OS_MSG_QTY  ix;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return;
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_msg == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    switch (OS_OPT_PEND_OPT(opt)) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_ring->OutIx != p_ring->InIx) {                        /* Any message waiting in the ring?                     */
+        ix = p_ring->OutIx & (OS_MSG_QTY)(p_ring->NbrMax - 1u);
+        OS_RingCopy(p_msg,                                      /* Yes, copy it out of its slot                         */
+                    &p_ring->StoragePtr[(CPU_SIZE_T)ix * p_ring->MsgSize],
+                    p_ring->MsgSize);
+        p_ring->OutIx++;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return;
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
+
+    OSTCBCurPtr->MsgPtr = p_msg;                                /* OSRingPost() copies the message there (See Note #3)  */
+    OS_Pend((OS_PEND_OBJ *)((void *)p_ring),                    /* Block task pending on ring                           */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_RING,
+            timeout,
+            opt);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Message already copied to 'p_msg' by the poster      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err      = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err      = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get event within TO          */
+            *p_err      = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err      = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err      = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                               ABORT WAITING ON A RING
+*
+* Description: This function aborts & readies any tasks currently waiting on a ring.  This function should be used to
+*              fault-abort the wait on the ring, rather than to normally signal the ring via OSRingPost().
+*
+* Arguments  : p_ring    is a pointer to the ring
+*
+*              opt       determines the type of ABORT performed:
+*
+*                            OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the ring
+*                            OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the ring
+*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                  At least one task waiting on the ring was readied and
+*                                                         informed of the aborted wait; check return value for the
+*                                                         number of tasks whose wait on the ring was aborted
+*                            OS_ERR_OBJ_PTR_NULL          If you pass a NULL pointer for 'p_ring'
+*                            OS_ERR_OBJ_TYPE              If the ring was not created
+*                            OS_ERR_OPT_INVALID           You specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
+*                            OS_ERR_PEND_ABORT_ISR        If this function was called from an ISR
+*                            OS_ERR_PEND_ABORT_NONE       No task were pending
+*
+* Returns    : == 0      if no tasks were waiting on the ring, or upon error.
+*              >  0      if one or more tasks waiting on the ring are now readied and informed.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RING_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY  OSRingPendAbort (OS_RING  *p_ring,
+                             OS_OPT    opt,
+                             OS_ERR   *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    OS_OBJ_QTY     nbr_tasks;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to Pend Abort from an ISR                */
+       *p_err =  OS_ERR_PEND_ABORT_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate 'p_ring'                                    */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_ABORT_1:
+        case OS_OPT_PEND_ABORT_ALL:
+        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring was created                           */
+       *p_err =  OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_ring->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on ring?                            */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err =  OS_ERR_PEND_ABORT_NONE;
+        return (0u);
+    }
+
+    nbr_tasks = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    ts        = OS_TS_GET();                                    /* Get local time stamp so all tasks get the same time  */
+#else
+    ts        = 0u;
+#endif
+    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
+        p_tcb = p_pend_list->HeadPtr;
+        OS_PendAbort(p_tcb,
+                     ts,
+                     OS_STATUS_PEND_ABORT);
+        nbr_tasks++;
+        if ((opt & OS_OPT_PEND_ABORT_ALL) == 0u) {              /* Pend abort all tasks waiting?                        */
+            break;                                              /* No                                                   */
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               POST MESSAGE TO A RING
+*
+* Description: This function copies a message to a ring.  With the 'opt' argument, you can specify whether the message
+*              is broadcast to all waiting tasks and/or whether the message is placed at the front of the ring (LIFO)
+*              or normally (FIFO) at the end of the ring.
+*
+* Arguments  : p_ring        is a pointer to a ring that must have been created by OSRingCreate().
+*
+*              p_msg         is a pointer to the message to copy, 'msg_size' bytes as given to OSRingCreate().  The
+*                            buffer may be reused as soon as this function returns.
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the ring.  This option
+*                                                         can be added to either OS_OPT_POST_FIFO or OS_OPT_POST_LIFO
+*                                OS_OPT_POST_FIFO         POST message to end of ring (FIFO) and wake up a single
+*                                                         waiting task.
+*                                OS_OPT_POST_LIFO         POST message to the front of the ring (LIFO) and wake up
+*                                                         a single waiting task.
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the message was sent
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_ring' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the ring was not created
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_PTR_INVALID       If you passed a NULL pointer for 'p_msg'
+*                                OS_ERR_Q_MAX             If the ring is full
+*
+* Returns    : None
+*
+* Note(s)    : 1) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSRingPost (OS_RING   *p_ring,
+                  void      *p_msg,
+                  OS_OPT     opt,
+                  OS_ERR    *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    OS_TCB        *p_tcb_next;
+    OS_MSG_QTY     ix;
+    OS_MSG_QTY     entries;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate 'p_ring'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_msg == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_FIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+        case OS_OPT_POST_LIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_ring->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on the ring?                        */
+        entries = (OS_MSG_QTY)(p_ring->InIx - p_ring->OutIx);
+        if (entries >= p_ring->NbrMax) {                        /* No, make sure there is a free slot                   */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_Q_MAX;
+            return;
+        }
+        if ((opt & OS_OPT_POST_LIFO) == 0u) {                   /* FIFO: write at the tail ...                          */
+            ix = p_ring->InIx;
+            p_ring->InIx++;
+        } else {                                                /* ... LIFO: in front of the head                       */
+            p_ring->OutIx--;
+            ix = p_ring->OutIx;
+        }
+        ix &= (OS_MSG_QTY)(p_ring->NbrMax - 1u);
+        OS_RingCopy(&p_ring->StoragePtr[(CPU_SIZE_T)ix * p_ring->MsgSize],
+                    p_msg,
+                    p_ring->MsgSize);
+        entries++;
+        if (p_ring->NbrEntriesMax < entries) {                  /* Update the peak number of messages waiting           */
+            p_ring->NbrEntriesMax = entries;
+        }
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    p_tcb = p_pend_list->HeadPtr;
+    while (p_tcb != (OS_TCB *)0) {
+        p_tcb_next = p_tcb->PendNextPtr;
+        OS_RingCopy(p_tcb->MsgPtr,                              /* Copy straight to the waiting task's buffer           */
+                    p_msg,
+                    p_ring->MsgSize);
+        OS_Post((OS_PEND_OBJ *)((void *)p_ring),
+                p_tcb,
+                p_tcb->MsgPtr,
+                p_ring->MsgSize,
+                ts);
+        if ((opt & OS_OPT_POST_ALL) == 0u)  {                   /* Post message to all tasks waiting?                   */
+            break;                                              /* No                                                   */
+        }
+        p_tcb = p_tcb_next;
+    }
+
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    CLEAR A RING
+*
+* Description: This function is called by OSRingDel() to clear the contents of a ring
+*
+* Argument(s): p_ring   is a pointer to the ring to clear
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RingClr (OS_RING  *p_ring)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_ring->Type          =  OS_OBJ_TYPE_NONE;                  /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_ring->NamePtr       = (CPU_CHAR *)((void *)"?RING");
+#endif
+    p_ring->StoragePtr    = (CPU_INT08U *)0;
+    p_ring->MsgSize       =               0u;
+    p_ring->NbrMax        =               0u;
+    p_ring->InIx          =               0u;
+    p_ring->OutIx         =               0u;
+    p_ring->NbrEntriesMax =               0u;
+    OS_PendListInit(&p_ring->PendList);                         /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                          ADD/REMOVE RING TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a ring to/from the ring debug list.
+*
+* Arguments  : p_ring  is a pointer to the ring to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_RingDbgListAdd (OS_RING  *p_ring)
+{
+    p_ring->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_ring->DbgPrevPtr               = (OS_RING *)0;
+    if (OSRingDbgListPtr == (OS_RING *)0) {
+        p_ring->DbgNextPtr           = (OS_RING *)0;
+    } else {
+        p_ring->DbgNextPtr           =  OSRingDbgListPtr;
+        OSRingDbgListPtr->DbgPrevPtr =  p_ring;
+    }
+    OSRingDbgListPtr                 =  p_ring;
+}
+
+
+void  OS_RingDbgListRemove (OS_RING  *p_ring)
+{
+    OS_RING  *p_ring_next;
+    OS_RING  *p_ring_prev;
+
+
+    p_ring_prev = p_ring->DbgPrevPtr;
+    p_ring_next = p_ring->DbgNextPtr;
+
+    if (p_ring_prev == (OS_RING *)0) {
+        OSRingDbgListPtr = p_ring_next;
+        if (p_ring_next != (OS_RING *)0) {
+            p_ring_next->DbgPrevPtr = (OS_RING *)0;
+        }
+        p_ring->DbgNextPtr = (OS_RING *)0;
+
+    } else if (p_ring_next == (OS_RING *)0) {
+        p_ring_prev->DbgNextPtr = (OS_RING *)0;
+        p_ring->DbgPrevPtr      = (OS_RING *)0;
+
+    } else {
+        p_ring_prev->DbgNextPtr =  p_ring_next;
+        p_ring_next->DbgPrevPtr =  p_ring_prev;
+        p_ring->DbgNextPtr      = (OS_RING *)0;
+        p_ring->DbgPrevPtr      = (OS_RING *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   COPY A MESSAGE
+*
+* Description: This function copies a message in or out of a ring.
+*
+* Arguments  : p_dest   is a pointer to the destination buffer
+*
+*              p_src    is a pointer to the source buffer
+*
+*              size     is the number of bytes to copy
+*
+* Returns    : none
+*
+* Note(s)    : 1) The message is copied a CPU_ALIGN word at a time when both buffers & the size are word aligned, one
+*                 byte at a time otherwise.
+************************************************************************************************************************
+*/
+
+static  void  OS_RingCopy (void         *p_dest,
+                           void         *p_src,
+                           OS_MSG_SIZE   size)
+{
+    CPU_ALIGN   *p_dest_word;
+    CPU_ALIGN   *p_src_word;
+    CPU_INT08U  *p_dest_byte;
+    CPU_INT08U  *p_src_byte;
+
+
+    if ((((CPU_ADDR)p_dest | (CPU_ADDR)p_src | (CPU_ADDR)size) & (sizeof(CPU_ALIGN) - 1u)) == 0u) {
+        p_dest_word = (CPU_ALIGN *)p_dest;                      /* See Note #1                                          */
+        p_src_word  = (CPU_ALIGN *)p_src;
+        while (size > 0u) {
+           *p_dest_word++ = *p_src_word++;
+            size         -= (OS_MSG_SIZE)sizeof(CPU_ALIGN);
+        }
+    } else {
+        p_dest_byte = (CPU_INT08U *)p_dest;
+        p_src_byte  = (CPU_INT08U *)p_src;
+        while (size > 0u) {
+           *p_dest_byte++ = *p_src_byte++;
+            size--;
+        }
+    }
+}
+#endif
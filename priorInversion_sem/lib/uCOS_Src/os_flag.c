@@ -113,6 +113,9 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
     p_grp->TS      = 0u;
 #endif
     OS_PendListInit(&p_grp->PendList);
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    p_grp->PendMultiPtr = (OS_PEND_DATA *)0;
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
     OS_FlagDbgListAdd(p_grp);
@@ -225,7 +228,12 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
     nbr_tasks   = 0u;
     switch (opt) {
         case OS_OPT_DEL_NO_PEND:                                /* Delete group if no task waiting                      */
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+             if ((p_pend_list->HeadPtr == (OS_TCB       *)0) &&
+                 (p_grp->PendMultiPtr  == (OS_PEND_DATA *)0)) {
+#else
              if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#endif
 #if (OS_CFG_DBG_EN > 0u)
                  OS_FlagDbgListRemove(p_grp);
                  OSFlagQty--;
@@ -248,12 +256,13 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
 #else
              ts = 0u;
 #endif
-             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
-                 p_tcb = p_pend_list->HeadPtr;
+             p_tcb = OS_PEND_LIST_HEAD(p_grp);
+             while (p_tcb != (OS_TCB *)0) {                     /* Remove all tasks from the pend list                  */
                  OS_PendAbort(p_tcb,
                               ts,
                               OS_STATUS_PEND_DEL);
                  nbr_tasks++;
+                 p_tcb = OS_PEND_LIST_HEAD(p_grp);
              }
 #if (OS_CFG_DBG_EN > 0u)
              OS_FlagDbgListRemove(p_grp);
@@ -317,6 +326,8 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
 *                                OS_OPT_PEND_NON_BLOCKING   Task will NOT block if flags are not available
 *                                OS_OPT_PEND_BLOCKING       Task will     block if flags are not available
 *
+*                            Add OS_OPT_PEND_TIMEOUT_US to give 'timeout' in microseconds (see OSTimeDlyUs()).
+*
 *              p_ts          is a pointer to a variable that will receive the timestamp of when the event flag group was
 *                            posted, aborted or the event flag group deleted.  If you pass a NULL pointer (i.e. (CPU_TS *)0)
 *                            then you will not get the timestamp.  In other words, passing a NULL pointer is valid and
@@ -403,7 +414,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return (0u);
     }
-    switch (opt) {                                              /* Validate 'opt'                                       */
+    switch (OS_OPT_PEND_OPT(opt)) {                             /* Validate 'opt'                                       */
         case OS_OPT_PEND_FLAG_CLR_ALL:
         case OS_OPT_PEND_FLAG_CLR_ANY:
         case OS_OPT_PEND_FLAG_SET_ALL:
@@ -751,7 +762,6 @@ OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp,
                              OS_OPT        opt,
                              OS_ERR       *p_err)
 {
-    OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     CPU_TS         ts;
     OS_OBJ_QTY     nbr_tasks;
@@ -805,8 +815,8 @@ OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp,
 #endif
 
     CPU_CRITICAL_ENTER();
-    p_pend_list = &p_grp->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on flag group?                      */
+    p_tcb = OS_PEND_LIST_HEAD(p_grp);
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any task waiting on flag group?                      */
         CPU_CRITICAL_EXIT();                                    /* No                                                   */
        *p_err = OS_ERR_PEND_ABORT_NONE;
         return (0u);
@@ -819,8 +829,7 @@ OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp,
     ts        = 0u;
 #endif
 
-    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
-        p_tcb = p_pend_list->HeadPtr;
+    while (p_tcb != (OS_TCB *)0) {
         OS_PendAbort(p_tcb,
                      ts,
                      OS_STATUS_PEND_ABORT);
@@ -828,6 +837,7 @@ OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp,
         if (opt != OS_OPT_PEND_ABORT_ALL) {                     /* Pend abort all tasks waiting?                        */
             break;                                              /* No                                                   */
         }
+        p_tcb = OS_PEND_LIST_HEAD(p_grp);
     }
     CPU_CRITICAL_EXIT();
 
@@ -949,6 +959,10 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     OS_TCB        *p_tcb_next;
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    OS_PEND_DATA  *p_pend_data;
+    OS_PEND_DATA  *p_pend_data_next;
+#endif
     CPU_TS         ts;
     CPU_SR_ALLOC();
 
@@ -1018,7 +1032,12 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     p_grp->TS   = ts;
 #endif
     p_pend_list = &p_grp->PendList;
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    if ((p_pend_list->HeadPtr == (OS_TCB       *)0) &&          /* Any task waiting on event flag group?                */
+        (p_grp->PendMultiPtr  == (OS_PEND_DATA *)0)) {
+#else
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on event flag group?                */
+#endif
         CPU_CRITICAL_EXIT();                                    /* No                                                   */
        *p_err = OS_ERR_NONE;
         OS_TRACE_FLAG_POST_EXIT(*p_err);
@@ -1076,6 +1095,20 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
                                                                 /* Point to next task waiting for event flag(s)         */
         p_tcb = p_tcb_next;
     }
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    p_pend_data = p_grp->PendMultiPtr;
+    while (p_pend_data != (OS_PEND_DATA *)0) {                  /* Go through all tasks waiting in OSPendMulti()        */
+        p_pend_data_next = p_pend_data->NextPtr;
+        flags_rdy        = OS_FlagPendMultiRdy(p_grp, p_pend_data);
+        if (flags_rdy != 0u) {
+            p_pend_data->RdyObjPtr = (OS_PEND_OBJ *)((void *)p_grp);
+            OS_FlagTaskRdy(p_pend_data->TCBPtr,                 /* Make task RTR, event(s) Rx'd                         */
+                           flags_rdy,
+                           ts);
+        }
+        p_pend_data = p_pend_data_next;
+    }
+#endif
     CPU_CRITICAL_EXIT();
 
     if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
@@ -1137,7 +1170,8 @@ void  OS_FlagBlock (OS_FLAG_GRP  *p_grp,
     OS_Pend((OS_PEND_OBJ *)((void *)p_grp),
              OSTCBCurPtr,
              OS_TASK_PEND_ON_FLAG,
-             timeout);
+             timeout,
+             opt);
 }
 
 
@@ -1171,6 +1205,9 @@ void  OS_FlagClr (OS_FLAG_GRP  *p_grp)
     p_grp->Flags            =  0u;
     p_pend_list             = &p_grp->PendList;
     OS_PendListInit(p_pend_list);
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    p_grp->PendMultiPtr     = (OS_PEND_DATA *)0;
+#endif
 }
 
 
@@ -1295,4 +1332,64 @@ void   OS_FlagTaskRdy (OS_TCB    *p_tcb,
     }
     OS_PendListRemove(p_tcb);
 }
+
+
+/*
+************************************************************************************************************************
+*                                   CHECK AN OSPendMulti() ENTRY OF AN EVENT FLAG GROUP
+*
+* Description: This function is internal to uC/OS-III and is used to check whether the event flags of a group satisfy
+*              an entry of a task waiting in OSPendMulti().
+*
+* Arguments  : p_grp         is a pointer to the event flag group
+*              -----
+*
+*              p_pend_data   is a pointer to the entry, '.FlagsPend' and '.FlagsOpt' give the condition
+*              -----------
+*
+* Returns    : The flags that satisfy the condition, 0 if it is not satisfied.
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+OS_FLAGS  OS_FlagPendMultiRdy (OS_FLAG_GRP   *p_grp,
+                               OS_PEND_DATA  *p_pend_data)
+{
+    OS_FLAGS  flags_rdy;
+
+
+    switch (p_pend_data->FlagsOpt & OS_OPT_PEND_FLAG_MASK) {
+        case OS_OPT_PEND_FLAG_SET_ALL:                          /* See if all req. flags are set                        */
+             flags_rdy = (p_grp->Flags & p_pend_data->FlagsPend);
+             if (flags_rdy != p_pend_data->FlagsPend) {
+                 flags_rdy = 0u;
+             }
+             break;
+
+        case OS_OPT_PEND_FLAG_SET_ANY:                          /* See if any flag set                                  */
+             flags_rdy = (p_grp->Flags & p_pend_data->FlagsPend);
+             break;
+
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+        case OS_OPT_PEND_FLAG_CLR_ALL:                          /* See if all req. flags are cleared                    */
+             flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_pend_data->FlagsPend);
+             if (flags_rdy != p_pend_data->FlagsPend) {
+                 flags_rdy = 0u;
+             }
+             break;
+
+        case OS_OPT_PEND_FLAG_CLR_ANY:                          /* See if any flag cleared                              */
+             flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_pend_data->FlagsPend);
+             break;
+#endif
+
+        default:
+             flags_rdy = 0u;
+             break;
+    }
+    return (flags_rdy);
+}
+#endif
 #endif
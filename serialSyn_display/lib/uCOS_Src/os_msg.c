@@ -32,6 +32,17 @@ const  CPU_CHAR  *os_msg__c = "$Id: $";
 
 
 #if (OS_MSG_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PRIO_EN > 0u)
+static  void  OS_MsgQPrioUnlink (OS_MSG_Q  *p_msg_q,
+                                 OS_MSG    *p_msg);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -53,12 +64,6 @@ const  CPU_CHAR  *os_msg__c = "$Id: $";
 
 void  OS_MsgPoolInit (OS_ERR  *p_err)
 {
-    OS_MSG      *p_msg1;
-    OS_MSG      *p_msg2;
-    OS_MSG_QTY   i;
-    OS_MSG_QTY   loops;
-
-
 #if (OS_CFG_ARG_CHK_EN > 0u)
     if (OSCfg_MsgPoolBasePtr == (OS_MSG *)0) {
        *p_err = OS_ERR_MSG_POOL_NULL_PTR;
@@ -70,10 +75,131 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
     }
 #endif
 
-    p_msg1 = OSCfg_MsgPoolBasePtr;
-    p_msg2 = OSCfg_MsgPoolBasePtr;
+    OS_MsgPoolLink(&OSMsgPool,
+                   OSCfg_MsgPoolBasePtr,
+                   OSCfg_MsgPoolSize);
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            CREATE A PRIVATE POOL OF 'OS_MSG'
+*
+* Description: This function is called by your application to create a pool of OS_MSGs that can be given to one or more
+*              message queues or task message queues with OSQPoolSet() or OSTaskQPoolSet().  Those queues then take
+*              their OS_MSGs from this pool instead of the global pool sized by OS_CFG_MSG_POOL_SIZE, so a burst on
+*              one queue can't make unrelated queues fail with OS_ERR_MSG_POOL_EMPTY.
+*
+* Arguments  : p_pool      is a pointer to the pool to create
+*
+*              p_msg_tbl   is a pointer to an array of 'qty' OS_MSGs
+*
+*              qty         is the number of OS_MSGs in the array (must be non-zero)
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the pool after you called
+*                                                               OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_pool'
+*                              OS_ERR_MSG_POOL_NULL_PTR       If you passed a NULL pointer for 'p_msg_tbl'
+*                              OS_ERR_MSG_POOL_EMPTY          If 'qty' is 0
+*
+* Returns    : none
+*
+* Note(s)    : 1) A pool MUST NOT be created again while a queue is using it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+void  OSMsgPoolCreate (OS_MSG_POOL  *p_pool,
+                       OS_MSG       *p_msg_tbl,
+                       OS_MSG_QTY    qty,
+                       OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pool == (OS_MSG_POOL *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_msg_tbl == (OS_MSG *)0) {
+       *p_err = OS_ERR_MSG_POOL_NULL_PTR;
+        return;
+    }
+    if (qty == 0u) {
+       *p_err = OS_ERR_MSG_POOL_EMPTY;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OS_MsgPoolLink(p_pool,
+                   p_msg_tbl,
+                   qty);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              LINK THE OS_MSGs OF A POOL
+*
+* Description: This function links an array of OS_MSGs in the free list of a pool.
+*
+* Argument(s): p_pool      is a pointer to the pool to initialize
+*
+*              p_msg_tbl   is a pointer to an array of 'qty' OS_MSGs
+*
+*              qty         is the number of OS_MSGs in the array, non-zero
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_MsgPoolLink (OS_MSG_POOL  *p_pool,
+                      OS_MSG       *p_msg_tbl,
+                      OS_MSG_QTY    qty)
+{
+    OS_MSG      *p_msg1;
+    OS_MSG      *p_msg2;
+    OS_MSG_QTY   i;
+    OS_MSG_QTY   loops;
+
+
+    p_msg1 = p_msg_tbl;
+    p_msg2 = p_msg_tbl;
     p_msg2++;
-    loops  = OSCfg_MsgPoolSize - 1u;
+    loops  = qty - 1u;
     for (i = 0u; i < loops; i++) {                              /* Init. list of free OS_MSGs                           */
         p_msg1->NextPtr = p_msg2;
         p_msg1->MsgPtr  = (void *)0;
@@ -91,13 +217,12 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
     p_msg1->MsgTS   =           0u;
 #endif
 
-    OSMsgPool.NextPtr    = OSCfg_MsgPoolBasePtr;
-    OSMsgPool.NbrFree    = OSCfg_MsgPoolSize;
-    OSMsgPool.NbrUsed    = 0u;
+    p_pool->NextPtr    = p_msg_tbl;
+    p_pool->NbrFree    = qty;
+    p_pool->NbrUsed    = 0u;
 #if (OS_CFG_DBG_EN > 0u)
-    OSMsgPool.NbrUsedMax = 0u;
+    p_pool->NbrUsedMax = 0u;
 #endif
-   *p_err                = OS_ERR_NONE;
 }
 
 
@@ -118,24 +243,32 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
 
 OS_MSG_QTY  OS_MsgQFreeAll (OS_MSG_Q  *p_msg_q)
 {
-    OS_MSG      *p_msg;
-    OS_MSG_QTY   qty;
-
+    OS_MSG       *p_msg;
+    OS_MSG_POOL  *p_pool;
+    OS_MSG_QTY    qty;
 
 
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+    p_pool = p_msg_q->PoolPtr;
+#else
+    p_pool = &OSMsgPool;
+#endif
     qty = p_msg_q->NbrEntries;                                  /* Get the number of OS_MSGs being freed                */
     if (p_msg_q->NbrEntries > 0u) {
         p_msg                   = p_msg_q->InPtr;               /* Point to end of message chain                        */
-        p_msg->NextPtr          = OSMsgPool.NextPtr;
-        OSMsgPool.NextPtr       = p_msg_q->OutPtr;              /* Point to beginning of message chain                  */
-        OSMsgPool.NbrUsed      -= p_msg_q->NbrEntries;          /* Update statistics for free list of messages          */
-        OSMsgPool.NbrFree      += p_msg_q->NbrEntries;
+        p_msg->NextPtr          = p_pool->NextPtr;
+        p_pool->NextPtr         = p_msg_q->OutPtr;              /* Point to beginning of message chain                  */
+        p_pool->NbrUsed        -= p_msg_q->NbrEntries;          /* Update statistics for free list of messages          */
+        p_pool->NbrFree        += p_msg_q->NbrEntries;
         p_msg_q->NbrEntries     =           0u;                 /* Flush the message queue                              */
 #if (OS_CFG_DBG_EN > 0u)
         p_msg_q->NbrEntriesMax  =           0u;
 #endif
         p_msg_q->InPtr          = (OS_MSG *)0;
         p_msg_q->OutPtr         = (OS_MSG *)0;
+#if (OS_CFG_Q_PRIO_EN > 0u)
+        p_msg_q->PrioMap        =           0u;                 /* No priority holds messages                           */
+#endif
     }
     return (qty);
 }
@@ -155,6 +288,10 @@ OS_MSG_QTY  OS_MsgQFreeAll (OS_MSG_Q  *p_msg_q)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The queue takes its OS_MSGs from the global pool until it is given a private pool.
+*
+*              3) The queue is FIFO/LIFO until it is given a table of priorities (see OSQPrioSet()).
 ************************************************************************************************************************
 */
 
@@ -168,6 +305,14 @@ void  OS_MsgQInit (OS_MSG_Q    *p_msg_q,
 #endif
     p_msg_q->InPtr          = (OS_MSG *)0;
     p_msg_q->OutPtr         = (OS_MSG *)0;
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+    p_msg_q->PoolPtr        = &OSMsgPool;                       /* See Note #2                                          */
+#endif
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    p_msg_q->PrioTailTbl    = (OS_MSG **)0;                     /* See Note #3                                          */
+    p_msg_q->PrioMap        =            0u;
+    p_msg_q->PrioNbr        =            0u;
+#endif
 }
 
 
@@ -200,8 +345,9 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
                    CPU_TS       *p_ts,
                    OS_ERR       *p_err)
 {
-    OS_MSG  *p_msg;
-    void    *p_void;
+    OS_MSG       *p_msg;
+    OS_MSG_POOL  *p_pool;
+    void         *p_void;
 
 
 #if (OS_CFG_TS_EN == 0u)
@@ -228,6 +374,11 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
     }
 #endif
 
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    if (p_msg_q->PrioTailTbl != (OS_MSG **)0) {                 /* Priority queue?                                      */
+        OS_MsgQPrioUnlink(p_msg_q, p_msg);
+    }
+#endif
     p_msg_q->OutPtr = p_msg->NextPtr;                           /* Point to next message to extract                     */
 
     if (p_msg_q->OutPtr == (OS_MSG *)0) {                       /* Are there any more messages in the queue?            */
@@ -237,10 +388,15 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
         p_msg_q->NbrEntries--;                                  /* Yes, One less message in the queue                   */
     }
 
-    p_msg->NextPtr    = OSMsgPool.NextPtr;                      /* Return message control block to free list            */
-    OSMsgPool.NextPtr = p_msg;
-    OSMsgPool.NbrFree++;
-    OSMsgPool.NbrUsed--;
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+    p_pool = p_msg_q->PoolPtr;
+#else
+    p_pool = &OSMsgPool;
+#endif
+    p_msg->NextPtr  = p_pool->NextPtr;                          /* Return message control block to free list            */
+    p_pool->NextPtr = p_msg;
+    p_pool->NbrFree++;
+    p_pool->NbrUsed--;
 
    *p_err             = OS_ERR_NONE;
     return (p_void);
@@ -276,6 +432,9 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) In a priority queue, FIFO posts at the lowest priority and LIFO at the highest (0), after the messages
+*                 already queued at that priority.
 ************************************************************************************************************************
 */
 
@@ -286,32 +445,50 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
                   CPU_TS        ts,
                   OS_ERR       *p_err)
 {
-    OS_MSG  *p_msg;
-    OS_MSG  *p_msg_in;
+    OS_MSG       *p_msg;
+    OS_MSG       *p_msg_in;
+    OS_MSG_POOL  *p_pool;
 
 
 #if (OS_CFG_TS_EN == 0u)
     (void)ts;                                                   /* Prevent compiler warning for not using 'ts'          */
 #endif
 
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    if (p_msg_q->PrioTailTbl != (OS_MSG **)0) {                 /* Priority queue, see Note #2                          */
+        OS_MsgQPutPrio(p_msg_q,
+                       p_void,
+                       msg_size,
+                       ((opt & OS_OPT_POST_LIFO) == OS_OPT_POST_FIFO) ? (OS_PRIO)(p_msg_q->PrioNbr - 1u) : 0u,
+                       ts,
+                       p_err);
+        return;
+    }
+#endif
+
     if (p_msg_q->NbrEntries >= p_msg_q->NbrEntriesSize) {
        *p_err = OS_ERR_Q_MAX;                                   /* Message queue cannot accept any more messages        */
         return;
     }
 
-    if (OSMsgPool.NbrFree == 0u) {
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+    p_pool = p_msg_q->PoolPtr;                                  /* Global pool or the queue's private pool              */
+#else
+    p_pool = &OSMsgPool;
+#endif
+    if (p_pool->NbrFree == 0u) {
        *p_err = OS_ERR_MSG_POOL_EMPTY;                          /* No more OS_MSG to use                                */
         return;
     }
 
-    p_msg = OSMsgPool.NextPtr;                                  /* Remove message control block from free list          */
-    OSMsgPool.NextPtr = p_msg->NextPtr;
-    OSMsgPool.NbrFree--;
-    OSMsgPool.NbrUsed++;
+    p_msg = p_pool->NextPtr;                                    /* Remove message control block from free list          */
+    p_pool->NextPtr = p_msg->NextPtr;
+    p_pool->NbrFree--;
+    p_pool->NbrUsed++;
 
 #if (OS_CFG_DBG_EN > 0u)
-    if (OSMsgPool.NbrUsedMax < OSMsgPool.NbrUsed) {
-        OSMsgPool.NbrUsedMax = OSMsgPool.NbrUsed;
+    if (p_pool->NbrUsedMax < p_pool->NbrUsed) {
+        p_pool->NbrUsedMax = p_pool->NbrUsed;
     }
 #endif
 
@@ -346,4 +523,324 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
 #endif
    *p_err          = OS_ERR_NONE;
 }
+
+
+/*
+************************************************************************************************************************
+*                                     DEPOSIT MESSAGE IN A PRIORITY MESSAGE QUEUE
+*
+* Description: This function places a message in a priority queue, after the messages of the same or a higher
+*              priority.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue
+*              -------
+*
+*              p_void      is a pointer to the message to send.
+*
+*              msg_size    is the size of the message (in bytes)
+*
+*              prio        is the priority of the message, 0 is the highest.  It must be lower than p_msg_q->PrioNbr.
+*
+*              ts          is a timestamp as to when the message was posted
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_Q_MAX           if the queue is full
+*                              OS_ERR_MSG_POOL_EMPTY  if we no longer have any OS_MSG to use
+*                              OS_ERR_NONE            the message was deposited in the queue
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The messages form a single list, highest priority first, so they are extracted by OS_MsgQGet() like
+*                 those of any queue.  'PrioTailTbl[]' holds the last message of each priority and 'PrioMap' has a bit
+*                 set for each priority holding messages, so a message is linked in constant time after either the
+*                 last message of its priority or the last message of the closest higher priority.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PRIO_EN > 0u)
+void  OS_MsgQPutPrio (OS_MSG_Q     *p_msg_q,
+                      void         *p_void,
+                      OS_MSG_SIZE   msg_size,
+                      OS_PRIO       prio,
+                      CPU_TS        ts,
+                      OS_ERR       *p_err)
+{
+    OS_MSG       *p_msg;
+    OS_MSG       *p_msg_prev;
+    OS_MSG_POOL  *p_pool;
+    CPU_DATA      prio_bit;
+    CPU_DATA      prio_above;
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)ts;                                                   /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+    if (p_msg_q->NbrEntries >= p_msg_q->NbrEntriesSize) {
+       *p_err = OS_ERR_Q_MAX;                                   /* Message queue cannot accept any more messages        */
+        return;
+    }
+
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+    p_pool = p_msg_q->PoolPtr;                                  /* Global pool or the queue's private pool              */
+#else
+    p_pool = &OSMsgPool;
+#endif
+    if (p_pool->NbrFree == 0u) {
+       *p_err = OS_ERR_MSG_POOL_EMPTY;                          /* No more OS_MSG to use                                */
+        return;
+    }
+
+    p_msg = p_pool->NextPtr;                                    /* Remove message control block from free list          */
+    p_pool->NextPtr = p_msg->NextPtr;
+    p_pool->NbrFree--;
+    p_pool->NbrUsed++;
+
+#if (OS_CFG_DBG_EN > 0u)
+    if (p_pool->NbrUsedMax < p_pool->NbrUsed) {
+        p_pool->NbrUsedMax = p_pool->NbrUsed;
+    }
+#endif
+
+    prio_bit = (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - prio);
+    if ((p_msg_q->PrioMap & prio_bit) != 0u) {                  /* Any message of the same priority?                    */
+        p_msg_prev = p_msg_q->PrioTailTbl[prio];                /* Yes, link after the last one                         */
+    } else {
+        if (prio == 0u) {                                       /* No,  find the closest higher priority in use         */
+            prio_above = 0u;
+        } else {
+            prio_above = p_msg_q->PrioMap >> ((CPU_CFG_DATA_SIZE * 8u) - prio);
+        }
+        if (prio_above != 0u) {                                 /* Link after its last message                          */
+            p_msg_prev = p_msg_q->PrioTailTbl[(prio - 1u) - (OS_PRIO)CPU_CntTrailZeros(prio_above)];
+        } else {
+            p_msg_prev = (OS_MSG *)0;                           /* Or first, if it is the highest priority in the queue */
+        }
+        p_msg_q->PrioMap |= prio_bit;
+    }
+
+    if (p_msg_prev == (OS_MSG *)0) {                            /* Link at the head of the queue                        */
+        p_msg->NextPtr      = p_msg_q->OutPtr;
+        p_msg_q->OutPtr     = p_msg;
+        if (p_msg_q->NbrEntries == 0u) {
+            p_msg_q->InPtr  = p_msg;
+        }
+    } else {                                                    /* Link after 'p_msg_prev'                              */
+        p_msg->NextPtr      = p_msg_prev->NextPtr;
+        p_msg_prev->NextPtr = p_msg;
+        if (p_msg_q->InPtr == p_msg_prev) {
+            p_msg_q->InPtr  = p_msg;
+        }
+    }
+    p_msg_q->PrioTailTbl[prio] = p_msg;
+    p_msg_q->NbrEntries++;
+
+#if (OS_CFG_DBG_EN > 0u)
+    if (p_msg_q->NbrEntriesMax < p_msg_q->NbrEntries) {
+        p_msg_q->NbrEntriesMax = p_msg_q->NbrEntries;
+    }
+#endif
+
+    p_msg->MsgPtr  = p_void;                                    /* Deposit message in the message queue entry           */
+    p_msg->MsgSize = msg_size;
+#if (OS_CFG_TS_EN > 0u)
+    p_msg->MsgTS   = ts;
+#endif
+   *p_err          = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                      RETRIEVE SEVERAL MESSAGES FROM A MESSAGE QUEUE
+*
+* Description: This function retrieves up to 'nbr_max' messages from a message queue, oldest first
+*
+* Arguments  : p_msg_q        is a pointer to the message queue where we want to extract the messages from
+*              -------
+*
+*              p_msg_tbl      is an array of at least 'nbr_max' entries that will receive the messages
+*
+*              msg_size_tbl   is an array of at least 'nbr_max' entries that will receive the sizes of the messages
+*
+*              nbr_max        is the maximum number of messages to extract
+*
+*              p_ts           is a pointer to where the time stamp of the first message will be placed, or a NULL
+*                             pointer
+*
+* Returns    : The number of messages extracted, 0 if the queue is empty
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The extracted OS_MSGs are returned to the free list as one chain.
+************************************************************************************************************************
+*/
+
+#if (OS_MSG_N_EN > 0u)
+OS_MSG_QTY  OS_MsgQGetN (OS_MSG_Q     *p_msg_q,
+                         void         *p_msg_tbl[],
+                         OS_MSG_SIZE   msg_size_tbl[],
+                         OS_MSG_QTY    nbr_max,
+                         CPU_TS       *p_ts)
+{
+    OS_MSG       *p_msg;
+    OS_MSG       *p_msg_first;
+    OS_MSG       *p_msg_last;
+    OS_MSG_POOL  *p_pool;
+    OS_MSG_QTY    nbr;
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+    if ((p_msg_q->NbrEntries == 0u) ||                          /* Is the queue empty?                                  */
+        (nbr_max             == 0u)) {
+        return (0u);                                            /* Yes                                                  */
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = p_msg_q->OutPtr->MsgTS;
+    }
+#endif
+
+    p_msg_first = p_msg_q->OutPtr;
+    p_msg       = p_msg_first;
+    p_msg_last  = p_msg_first;
+    nbr         = 0u;
+    while ((p_msg != (OS_MSG *)0) && (nbr < nbr_max)) {         /* Copy the messages out, oldest first                  */
+#if (OS_CFG_Q_PRIO_EN > 0u)
+        if (p_msg_q->PrioTailTbl != (OS_MSG **)0) {             /* Priority queue?                                      */
+            OS_MsgQPrioUnlink(p_msg_q, p_msg);
+        }
+#endif
+        p_msg_tbl[nbr]    = p_msg->MsgPtr;
+        msg_size_tbl[nbr] = p_msg->MsgSize;
+        nbr++;
+        p_msg_last        = p_msg;
+        p_msg             = p_msg->NextPtr;
+    }
+
+    p_msg_q->OutPtr      = p_msg;                               /* Point to next message, if any                        */
+    p_msg_q->NbrEntries -= nbr;
+    if (p_msg_q->NbrEntries == 0u) {                            /* Are there any more messages in the queue?            */
+        p_msg_q->InPtr  = (OS_MSG *)0;                          /* No                                                   */
+        p_msg_q->OutPtr = (OS_MSG *)0;
+    }
+
+#if (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+    p_pool = p_msg_q->PoolPtr;
+#else
+    p_pool = &OSMsgPool;
+#endif
+    p_msg_last->NextPtr  = p_pool->NextPtr;                     /* Return the extracted chain to the free list          */
+    p_pool->NextPtr      = p_msg_first;
+    p_pool->NbrFree     += nbr;
+    p_pool->NbrUsed     -= nbr;
+    return (nbr);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                      DEPOSIT SEVERAL MESSAGES IN A MESSAGE QUEUE
+*
+* Description: This function places up to 'nbr' messages in a message queue
+*
+* Arguments  : p_msg_q        is a pointer to the message queue
+*              -------
+*
+*              p_msg_tbl      is an array of 'nbr' pointers to the messages to send
+*
+*              msg_size_tbl   is an array of 'nbr' message sizes (in bytes)
+*
+*              nbr            is the number of messages to deposit
+*
+*              opt            specifies whether the messages will be posted in FIFO or LIFO order
+*
+*                                 OS_OPT_POST_FIFO
+*                                 OS_OPT_POST_LIFO
+*
+*              ts             is a timestamp as to when the messages were posted
+*
+*              p_err          is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                 OS_ERR_Q_MAX           if the queue filled up before all messages were deposited
+*                                 OS_ERR_MSG_POOL_EMPTY  if we ran out of OS_MSG before all messages were deposited
+*                                 OS_ERR_NONE            all the messages were deposited in the queue
+*
+* Returns    : The number of messages deposited
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Messages are deposited in table order, so with OS_OPT_POST_LIFO the last entry of the table is the
+*                 next one to be extracted.
+************************************************************************************************************************
+*/
+
+#if (OS_MSG_N_EN > 0u)
+OS_MSG_QTY  OS_MsgQPutN (OS_MSG_Q     *p_msg_q,
+                         void         *p_msg_tbl[],
+                         OS_MSG_SIZE   msg_size_tbl[],
+                         OS_MSG_QTY    nbr,
+                         OS_OPT        opt,
+                         CPU_TS        ts,
+                         OS_ERR       *p_err)
+{
+    OS_MSG_QTY  ix;
+
+
+   *p_err = OS_ERR_NONE;
+    for (ix = 0u; ix < nbr; ix++) {
+        OS_MsgQPut(p_msg_q,
+                   p_msg_tbl[ix],
+                   msg_size_tbl[ix],
+                   opt,
+                   ts,
+                   p_err);
+        if (*p_err != OS_ERR_NONE) {                            /* Stop at the first message that did not fit           */
+            break;
+        }
+    }
+    return (ix);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                     REMOVE THE FIRST MESSAGE OF A PRIORITY QUEUE
+*
+* Description: This function updates the priorities of a priority queue when its first message is extracted.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue
+*              -------
+*
+*              p_msg       is a pointer to the first message of the queue
+*
+* Returns    : none
+*
+* Note(s)    : 1) The first message always has the highest priority of the queue (see OS_MsgQPutPrio()).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PRIO_EN > 0u)
+static  void  OS_MsgQPrioUnlink (OS_MSG_Q  *p_msg_q,
+                                 OS_MSG    *p_msg)
+{
+    OS_PRIO  prio;
+
+
+    prio = (OS_PRIO)CPU_CntLeadZeros(p_msg_q->PrioMap);         /* See Note #1                                          */
+    if (p_msg_q->PrioTailTbl[prio] == p_msg) {                  /* Was it the last message of its priority?             */
+        p_msg_q->PrioMap &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - prio));
+    }
+}
+#endif
 #endif
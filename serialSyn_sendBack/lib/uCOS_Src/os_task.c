@@ -31,6 +31,86 @@
 const  CPU_CHAR  *os_task__c = "$Id: $";
 #endif
 
+/*
+************************************************************************************************************************
+*                                                SET A TASK'S CPU BUDGET
+*
+* Description: This function is called to limit the number of ticks a task may run for in each replenishment period.
+*              A task which uses up its budget is delayed until the end of the period, so a runaway task cannot
+*              starve the tasks of lower priority.
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
+*
+*              budget       is the number of ticks the task may run for in each period.  0 removes the budget.
+*
+*              period       is the replenishment period, in ticks.
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE                       Upon success
+*                               OS_ERR_SCHED_INVALID_TIME_SLICE   If the budget is longer than the period
+*                               OS_ERR_SET_ISR                    If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The budget is charged one tick at a time, by the tick interrupt, to the task it interrupts (see
+*                 OS_TaskBudgetCharge()).
+*
+*              2) A period starts on the first tick charged to the task after the previous period ended, so a task which
+*                 ran out of budget runs again a full period after its previous period started.
+*
+*              3) A task which runs out of budget while it owns a mutex is delayed once it released the mutex.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void  OSTaskBudgetSet (OS_TCB   *p_tcb,
+                       OS_TICK   budget,
+                       OS_TICK   period,
+                       OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((budget != 0u) &&                                       /* The budget must fit in the period                    */
+        (budget >  period)) {
+       *p_err = OS_ERR_SCHED_INVALID_TIME_SLICE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+
+    p_tcb->BudgetQuanta = budget;
+    p_tcb->BudgetPeriod = period;
+    p_tcb->BudgetStart  = OSTickCtr;                            /* Start a full period now                              */
+    p_tcb->BudgetUsed   = 0u;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                CHANGE PRIORITY OF A TASK
@@ -54,7 +134,7 @@ const  CPU_CHAR  *os_task__c = "$Id: $";
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) The preemption threshold of the task is reset to its new priority.
 ************************************************************************************************************************
 */
 
@@ -119,6 +199,10 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
     }
 #endif
 
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+    p_tcb->PrioThreshold = prio_new;                            /* See Note #1                                          */
+#endif
+
     OS_TaskChangePrio(p_tcb, prio_new);
 
     OS_TRACE_TASK_PRIO_CHANGE(p_tcb, prio_new);
@@ -376,6 +460,10 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 
     p_tcb->Prio          = prio;                                /* Save the task's priority                             */
 
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+    p_tcb->PrioThreshold = prio;                                /* Any higher priority task may preempt it              */
+#endif
+
 #if (OS_CFG_MUTEX_EN > 0u)
     p_tcb->BasePrio      = prio;                                /* Set the base priority                                */
 #endif
@@ -450,6 +538,155 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 }
 
 
+/*
+************************************************************************************************************************
+*                                            END A TASK'S DEADLINE JOB
+*
+* Description: This function is called by a task scheduled Earliest-Deadline-First when it completed its current job.
+*              The next time the task is made ready, it starts a new job & gets a new deadline.
+*
+* Arguments  : p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE       Upon success
+*                               OS_ERR_SET_ISR    If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) A task released by an event calls this function right before it waits for the event, e.g.:
+*
+*                     while (DEF_TRUE) {
+*                         OSTaskDeadlineJobEnd(&err);
+*                         OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, &ts, &err);
+*                         :
+*                     }
+*
+*                 Until then, the task keeps the deadline of its current job whenever it blocks & is made ready again.
+*
+*              2) The new job is only released if the task is made ready.  A task which finds its event already posted
+*                 & does not block continues under the deadline of the job it just completed.
+*
+*              3) A periodic task does not need to call this function, OSTaskWaitNextPeriod() ends its jobs.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+void  OSTaskDeadlineJobEnd (OS_ERR  *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OSTCBCurPtr->DeadlineJobEnd = OS_TRUE;                      /* See Note #1.                                         */
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                SET A TASK'S DEADLINE
+*
+* Description: This function is called to set the deadline & period of a task scheduled Earliest-Deadline-First.  The
+*              ready tasks at OS_CFG_SCHED_EDF_PRIO run in the order of their absolute deadline, the tasks at a higher
+*              priority still preempt them.
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
+*
+*              deadline     is the number of ticks, from the release of a job, by which the job must complete.  0
+*                           removes the deadline of the task.
+*
+*              period       is the minimum number of ticks between two releases.  0 if a job may be released at any
+*                           time.
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE       Upon success
+*                               OS_ERR_SET_ISR    If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The current job of the task is considered released by this call.  Its deadline is now + 'deadline'.
+*
+*              2) The deadline & period only matter while the task runs at OS_CFG_SCHED_EDF_PRIO.
+*
+*              3) The next jobs are released by OSTaskWaitNextPeriod() or OSTaskDeadlineJobEnd().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+void  OSTaskDeadlineSet (OS_TCB   *p_tcb,
+                         OS_TICK   deadline,
+                         OS_TICK   period,
+                         OS_ERR   *p_err)
+{
+    OS_TICK  time;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    time                   = OSTickCtr + OS_DynTickGet();
+#else
+    time                   = OSTickCtr;
+#endif
+    p_tcb->DeadlineRel     = deadline;
+    p_tcb->DeadlinePeriod  = period;
+    p_tcb->DeadlineRelease = time;                              /* See Note #1.                                         */
+    p_tcb->Deadline        = time + deadline;
+    p_tcb->DeadlineJobEnd  = OS_FALSE;
+
+    if ((p_tcb->TaskState == OS_TASK_STATE_RDY) &&              /* Move a ready EDF task to its new place in the list   */
+        (p_tcb->Prio      == OS_CFG_SCHED_EDF_PRIO)) {
+        OS_RdyListRemove(p_tcb);
+        OS_PrioInsert(p_tcb->Prio);
+        OS_RdyListInsertDeadline(p_tcb);
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OSSched();                                              /* The order of the EDF tasks may have changed          */
+    }
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                     DELETE A TASK
@@ -559,7 +796,11 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 
                  case OS_TASK_PEND_ON_FLAG:                     /* Remove from pend list                                */
                  case OS_TASK_PEND_ON_Q:
+                 case OS_TASK_PEND_ON_RING:
                  case OS_TASK_PEND_ON_SEM:
+                 case OS_TASK_PEND_ON_STREAM:
+                 case OS_TASK_PEND_ON_Q_POST:
+                 case OS_TASK_PEND_ON_MULTI:
                       OS_PendListRemove(p_tcb);
                       break;
 
@@ -639,122 +880,284 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 
 /*
 ************************************************************************************************************************
-*                                                    FLUSH TASK's QUEUE
+*                                             MAKE A TASK PERIODIC
 *
-* Description: This function is used to flush the task's internal message queue.
+* Description: This function is called to release a task periodically.  The task runs one job per period & calls
+*              OSTaskWaitNextPeriod() at the end of each job.  The releases are at absolute ticks, so the period does
+*              not drift with the time the jobs take.
 *
-* Arguments  : p_tcb       is a pointer to the task's OS_TCB.  Specifying a NULL pointer indicates that you wish to
-*                          flush the message queue of the calling task.
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
 *
-*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*              period       is the number of ticks between two releases.  0 makes the task no longer periodic.
 *
-*                              OS_ERR_NONE              Upon success
-*                              OS_ERR_FLUSH_ISR         If you called this function from an ISR
-*                              OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*              p_err        is a pointer to an error code returned by this function:
 *
-* Returns     : The number of entries freed from the queue
+*                               OS_ERR_NONE       Upon success
+*                               OS_ERR_SET_ISR    If you called this function from an ISR
 *
-* Note(s)     : 1) You should use this function with great care because, when to flush the queue, you LOOSE the
-*                  references to what the queue entries are pointing to and thus, you could cause 'memory leaks'.  In
-*                  other words, the data you are pointing to that's being referenced by the queue entries should, most
-*                  likely, need to be de-allocated (i.e. freed).
+* Returns    : none
+*
+* Note(s)    : 1) The current job of the task is considered released by this call.  The next release is now + 'period'.
+*
+*              2) The counters & the statistics of the task (.PeriodJobCtr, .PeriodOverrunCtr, .PeriodSkipCtr,
+*                 .PeriodJitter & .PeriodResponse) are cleared.
+*
+*              3) A task waiting in OSTaskWaitNextPeriod() is still released at the time it waits for, the new period
+*                 counts from there.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_Q_EN > 0u)
-OS_MSG_QTY  OSTaskQFlush (OS_TCB  *p_tcb,
-                          OS_ERR  *p_err)
+#if (OS_CFG_TASK_PERIOD_EN > 0u)
+void  OSTaskPeriodSet (OS_TCB   *p_tcb,
+                       OS_TICK   period,
+                       OS_ERR   *p_err)
 {
-    OS_MSG_QTY  entries;
     CPU_SR_ALLOC();
 
 
+
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return (0u);
+        return;
     }
 #endif
 
 #if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* Can't flush a message queue from an ISR              */
-       *p_err = OS_ERR_FLUSH_ISR;
-        return (0u);
-    }
-#endif
-
-#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
-    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-       *p_err = OS_ERR_OS_NOT_RUNNING;
-        return (0u);
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
     }
 #endif
 
-    if (p_tcb == (OS_TCB *)0) {                                 /* Flush message queue of calling task?                 */
-        CPU_CRITICAL_ENTER();
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
         p_tcb = OSTCBCurPtr;
-        CPU_CRITICAL_EXIT();
     }
 
-    CPU_CRITICAL_ENTER();
-    entries = OS_MsgQFreeAll(&p_tcb->MsgQ);                     /* Return all OS_MSGs to the OS_MSG pool                */
+    p_tcb->Period           = period;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    p_tcb->PeriodRelease    = OSTickCtr + OS_DynTickGet();      /* See Note #1.                                         */
+#else
+    p_tcb->PeriodRelease    = OSTickCtr;                        /* See Note #1.                                         */
+#endif
+    p_tcb->PeriodJobCtr     = 0u;                               /* See Note #2.                                         */
+    p_tcb->PeriodOverrunCtr = 0u;
+    p_tcb->PeriodSkipCtr    = 0u;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    p_tcb->PeriodReleaseTS  = OS_TS_GET();
+    OS_TaskPeriodStatClr(&p_tcb->PeriodJitter);
+    OS_TaskPeriodStatClr(&p_tcb->PeriodResponse);
+#endif
     CPU_CRITICAL_EXIT();
-   *p_err   = OS_ERR_NONE;
-    return (entries);
+   *p_err = OS_ERR_NONE;
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                                  WAIT FOR A MESSAGE
-*
-* Description: This function causes the current task to wait for a message to be posted to it.
-*
-* Arguments  : timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
-*                            message to arrive up to the amount of time specified by this argument.
-*                            If you specify 0, however, your task will wait forever or, until a message arrives.
+*                                          SET A TASK'S PREEMPTION THRESHOLD
 *
-*              opt           determines whether the user wants to block if the task's queue is empty or not:
+* Description: This function is called to set the preemption threshold of a task.  The task keeps its priority but, while
+*              it runs, only the tasks of a priority higher than the threshold may preempt it.  Cooperating tasks can
+*              thus run to completion without locking the scheduler.
 *
-*                                OS_OPT_PEND_BLOCKING
-*                                OS_OPT_PEND_NON_BLOCKING
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
 *
-*              p_msg_size    is a pointer to a variable that will receive the size of the message
+*              threshold    is the new preemption threshold.  It MUST NOT be lower (i.e. numerically greater) than the
+*                           priority of the task.  Set it to the priority of the task for normal preemption.
 *
-*              p_ts          is a pointer to a variable that will receive the timestamp of when the message was
-*                            received.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not get the
-*                            timestamp.  In other words, passing a NULL pointer is valid and indicates that you don't
-*                            need the timestamp.
+*              p_err        is a pointer to an error code returned by this function:
 *
-*              p_err         is a pointer to where an error message will be deposited.  Possible error
-*                            messages are:
+*                               OS_ERR_NONE            Upon success
+*                               OS_ERR_PRIO_INVALID    If the threshold is lower than the priority of the task
+*                               OS_ERR_SET_ISR         If you called this function from an ISR
 *
-*                                OS_ERR_NONE               The call was successful and your task received a message.
-*                                OS_ERR_OPT_INVALID        If you specified an invalid option
-*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
-*                                OS_ERR_PEND_ABORT         If the pend was aborted
-*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the result
-*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was not empty
-*                                OS_ERR_PTR_INVALID        If 'p_msg_size' is NULL
-*                                OS_ERR_SCHED_LOCKED       If the scheduler is locked
-*                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
-*                                                          would lead to a suspension
-*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+* Returns    : none
 *
-* Returns    : A pointer to the message received or a NULL pointer upon error.
+* Note(s)    : 1) A task preempted by a task above its threshold resumes before the tasks that are not above it.
 *
-* Note(s)    : 1) It is possible to receive NULL pointers when there are no errors.
+*              2) A new threshold takes effect the next time the task gets the CPU.
 *
-*            : 2) This API 'MUST NOT' be called from a timer callback function.
+*              3) OSTaskChangePrio() resets the threshold to the new priority of the task.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_Q_EN > 0u)
-void  *OSTaskQPend (OS_TICK       timeout,
-                    OS_OPT        opt,
-                    OS_MSG_SIZE  *p_msg_size,
-                    CPU_TS       *p_ts,
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+void  OSTaskPreemptThresholdSet (OS_TCB   *p_tcb,
+                                 OS_PRIO   threshold,
+                                 OS_ERR   *p_err)
+{
+    OS_PRIO  prio;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+
+#if (OS_CFG_MUTEX_EN > 0u)
+    prio = p_tcb->BasePrio;                                     /* Not the priority inherited from a mutex              */
+#else
+    prio = p_tcb->Prio;
+#endif
+    if (threshold > prio) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+
+    OS_SchedThresholdRemove(p_tcb);                             /* See Note #2                                          */
+    p_tcb->PrioThreshold = threshold;
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OSSched();                                              /* Tasks held back by the old threshold may run now     */
+    }
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                    FLUSH TASK's QUEUE
+*
+* Description: This function is used to flush the task's internal message queue.
+*
+* Arguments  : p_tcb       is a pointer to the task's OS_TCB.  Specifying a NULL pointer indicates that you wish to
+*                          flush the message queue of the calling task.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE              Upon success
+*                              OS_ERR_FLUSH_ISR         If you called this function from an ISR
+*                              OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*
+* Returns     : The number of entries freed from the queue
+*
+* Note(s)     : 1) You should use this function with great care because, when to flush the queue, you LOOSE the
+*                  references to what the queue entries are pointing to and thus, you could cause 'memory leaks'.  In
+*                  other words, the data you are pointing to that's being referenced by the queue entries should, most
+*                  likely, need to be de-allocated (i.e. freed).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN > 0u)
+OS_MSG_QTY  OSTaskQFlush (OS_TCB  *p_tcb,
+                          OS_ERR  *p_err)
+{
+    OS_MSG_QTY  entries;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't flush a message queue from an ISR              */
+       *p_err = OS_ERR_FLUSH_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+    if (p_tcb == (OS_TCB *)0) {                                 /* Flush message queue of calling task?                 */
+        CPU_CRITICAL_ENTER();
+        p_tcb = OSTCBCurPtr;
+        CPU_CRITICAL_EXIT();
+    }
+
+    CPU_CRITICAL_ENTER();
+    entries = OS_MsgQFreeAll(&p_tcb->MsgQ);                     /* Return all OS_MSGs to the OS_MSG pool                */
+    CPU_CRITICAL_EXIT();
+   *p_err   = OS_ERR_NONE;
+    return (entries);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                  WAIT FOR A MESSAGE
+*
+* Description: This function causes the current task to wait for a message to be posted to it.
+*
+* Arguments  : timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            message to arrive up to the amount of time specified by this argument.
+*                            If you specify 0, however, your task will wait forever or, until a message arrives.
+*
+*              opt           determines whether the user wants to block if the task's queue is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_TIMEOUT_US to give 'timeout' in microseconds (see OSTimeDlyUs()).
+*
+*              p_msg_size    is a pointer to a variable that will receive the size of the message
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the message was
+*                            received.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not get the
+*                            timestamp.  In other words, passing a NULL pointer is valid and indicates that you don't
+*                            need the timestamp.
+*
+*              p_err         is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                                OS_ERR_NONE               The call was successful and your task received a message.
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the result
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was not empty
+*                                OS_ERR_PTR_INVALID        If 'p_msg_size' is NULL
+*                                OS_ERR_SCHED_LOCKED       If the scheduler is locked
+*                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
+*                                                          would lead to a suspension
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : A pointer to the message received or a NULL pointer upon error.
+*
+* Note(s)    : 1) It is possible to receive NULL pointers when there are no errors.
+*
+*            : 2) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN > 0u)
+void  *OSTaskQPend (OS_TICK       timeout,
+                    OS_OPT        opt,
+                    OS_MSG_SIZE  *p_msg_size,
+                    CPU_TS       *p_ts,
                     OS_ERR       *p_err)
 {
     OS_MSG_Q  *p_msg_q;
@@ -802,7 +1205,7 @@ void  *OSTaskQPend (OS_TICK       timeout,
        *p_err = OS_ERR_PTR_INVALID;
         return ((void *)0);
     }
-    switch (opt) {                                              /* User must supply a valid option                      */
+    switch (OS_OPT_PEND_OPT(opt)) {                             /* User must supply a valid option                      */
         case OS_OPT_PEND_BLOCKING:
         case OS_OPT_PEND_NON_BLOCKING:
              break;
@@ -860,7 +1263,8 @@ void  *OSTaskQPend (OS_TICK       timeout,
     OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task pending on Message                        */
              OSTCBCurPtr,
              OS_TASK_PEND_ON_TASK_Q,
-             timeout);
+             timeout,
+             opt);
     CPU_CRITICAL_EXIT();
     OS_TRACE_TASK_MSG_Q_PEND_BLOCK(p_msg_q);
     OSSched();                                                  /* Find the next highest priority task ready to run     */
@@ -915,6 +1319,194 @@ void  *OSTaskQPend (OS_TICK       timeout,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                                WAIT FOR SEVERAL MESSAGES
+*
+* Description: This function causes the current task to wait for messages to be posted to it and retrieves up to
+*              'nbr_max' of them in a single call.  It blocks only if the task's queue is empty.
+*
+* Arguments  : p_msg_tbl     is an array of at least 'nbr_max' entries that will receive the messages, oldest first
+*
+*              msg_size_tbl  is an array of at least 'nbr_max' entries that will receive the sizes of the messages
+*
+*              nbr_max       is the maximum number of messages to retrieve
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            message to arrive up to the amount of time specified by this argument.
+*                            If you specify 0, however, your task will wait forever or, until a message arrives.
+*
+*              opt           determines whether the user wants to block if the task's queue is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_TIMEOUT_US to give 'timeout' in microseconds (see OSTimeDlyUs()).
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of the first message received.
+*                            Passing a NULL pointer is valid.
+*
+*              p_err         is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                                OS_ERR_NONE               The call was successful and your task received messages.
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was empty
+*                                OS_ERR_PTR_INVALID        If 'p_msg_tbl' or 'msg_size_tbl' is NULL
+*                                OS_ERR_Q_SIZE             If 'nbr_max' is 0
+*                                OS_ERR_SCHED_LOCKED       If the scheduler is locked
+*                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : The number of messages received, 0 upon error.
+*
+* Note(s)    : 1) This API 'MUST NOT' be called from a timer callback function.
+*
+*              2) When the task was blocked, the message that readied it is returned first, followed by any message
+*                 posted to the task before it got to run.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_N_EN > 0u)
+OS_MSG_QTY  OSTaskQPendN (void         *p_msg_tbl[],
+                          OS_MSG_SIZE   msg_size_tbl[],
+                          OS_MSG_QTY    nbr_max,
+                          OS_TICK       timeout,
+                          OS_OPT        opt,
+                          CPU_TS       *p_ts,
+                          OS_ERR       *p_err)
+{
+    OS_MSG_QTY  nbr;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't Pend from an ISR                               */
+       *p_err = OS_ERR_PEND_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)                                    /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if ((p_msg_tbl    == (void      **)0) ||                    /* User must supply valid destinations for the msgs     */
+        (msg_size_tbl == (OS_MSG_SIZE *)0)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (nbr_max == 0u) {
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+    switch (OS_OPT_PEND_OPT(opt)) {                             /* User must supply a valid option                      */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
+
+    CPU_CRITICAL_ENTER();
+    nbr = OS_MsgQGetN(&OSTCBCurPtr->MsgQ,                       /* Any messages waiting in the message queue?           */
+                      p_msg_tbl,
+                      msg_size_tbl,
+                      nbr_max,
+                      p_ts);
+    if (nbr > 0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return (nbr);                                           /* Yes, Return oldest messages received                 */
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return (0u);
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't block when the scheduler is locked             */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+    OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task pending on Message                        */
+             OSTCBCurPtr,
+             OS_TASK_PEND_ON_TASK_Q,
+             timeout,
+             opt);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    nbr = 0u;
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Extract message from TCB (Put there by Post)         */
+             p_msg_tbl[0]    = OSTCBCurPtr->MsgPtr;
+             msg_size_tbl[0] = OSTCBCurPtr->MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             nbr             = 1u + OS_MsgQGetN(&OSTCBCurPtr->MsgQ,  /* ... followed by those posted since (Note #2)   */
+                                                &p_msg_tbl[1],
+                                                &msg_size_tbl[1],
+                                                nbr_max - 1u,
+                                                (CPU_TS *)0);
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get event within TO          */
+        default:
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (nbr);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                              ABORT WAITING FOR A MESSAGE
@@ -1159,13 +1751,238 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
              }
              break;
 
-        default:
-             CPU_CRITICAL_EXIT();
-            *p_err = OS_ERR_STATE_INVALID;
-             break;
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATE_INVALID;
+             break;
+    }
+
+    OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              POST SEVERAL MESSAGES TO A TASK
+*
+* Description: This function sends up to 'nbr' messages to a task in a single call.  If the task is waiting for a
+*              message, it receives the first one directly and the others are placed in its queue.  The whole batch is
+*              posted in one critical section and the scheduler runs at most once.
+*
+* Arguments  : p_tcb         is a pointer to the TCB of the task receiving the messages.  If you specify a NULL pointer
+*                            then the messages will be posted to the task's queue of the calling task.
+*
+*              p_msg_tbl     is an array of 'nbr' pointers to the messages to send.
+*
+*              msg_size_tbl  is an array of 'nbr' message sizes (in bytes)
+*
+*              nbr           is the number of messages to send
+*
+*              opt           specifies whether the post will be FIFO or LIFO:
+*
+*                                OS_OPT_POST_FIFO       Post at the end   of the queue
+*                                OS_OPT_POST_LIFO       Post at the front of the queue
+*
+*                                OS_OPT_POST_NO_SCHED   Do not run the scheduler after the post
+*
+*                            Note(s): 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*
+*              p_err         is a pointer to a variable that will hold the error code associated
+*                            with the outcome of this call.  Errors can be:
+*
+*                                OS_ERR_NONE              The call was successful and all the messages were sent
+*                                OS_ERR_MSG_POOL_EMPTY    If the OS_MSGs ran out before all the messages were sent
+*                                OS_ERR_OPT_INVALID       If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_PTR_INVALID       If 'p_msg_tbl' or 'msg_size_tbl' is NULL
+*                                OS_ERR_Q_MAX             If the queue filled up before all the messages were sent
+*                                OS_ERR_Q_SIZE            If 'nbr' is 0
+*                                OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
+*                                                         and if it does, would be considered a system failure
+*
+* Returns    : The number of messages sent.  Messages past that count were not sent.
+*
+* Note(s)    : 1) Messages are sent in table order.  With OS_OPT_POST_LIFO the last entry of the table is thus the next
+*                 one to be retrieved from the queue.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_N_EN > 0u)
+OS_MSG_QTY  OSTaskQPostN (OS_TCB       *p_tcb,
+                          void         *p_msg_tbl[],
+                          OS_MSG_SIZE   msg_size_tbl[],
+                          OS_MSG_QTY    nbr,
+                          OS_OPT        opt,
+                          OS_ERR       *p_err)
+{
+    OS_MSG_QTY   nbr_posted;
+    CPU_BOOLEAN  rdy;
+    CPU_TS       ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)                                    /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if ((p_msg_tbl    == (void      **)0) ||
+        (msg_size_tbl == (OS_MSG_SIZE *)0)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (nbr == 0u) {
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+    switch (opt) {                                              /* User must supply a valid option                      */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp, shared by the whole batch             */
+#else
+    ts = 0u;
+#endif
+
+   *p_err      = OS_ERR_NONE;                                   /* Assume we won't have any errors                      */
+    nbr_posted = 0u;
+    rdy        = OS_FALSE;
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Post msgs to 'self'?                                 */
+        p_tcb = OSTCBCurPtr;
+    }
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+        case OS_TASK_STATE_DLY:
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             break;
+
+        case OS_TASK_STATE_PEND:
+        case OS_TASK_STATE_PEND_TIMEOUT:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {     /* Is task waiting for a message to be sent to it?      */
+                 OS_Post((OS_PEND_OBJ *)0,                      /* Yes, hand it the first message                       */
+                          p_tcb,
+                          p_msg_tbl[0],
+                          msg_size_tbl[0],
+                          ts);
+                 nbr_posted = 1u;
+                 rdy        = OS_TRUE;
+             }
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATE_INVALID;
+             return (0u);
+    }
+
+    if (nbr_posted < nbr) {                                     /* Deposit the remaining messages in the queue          */
+        nbr_posted += OS_MsgQPutN(&p_tcb->MsgQ,
+                                  &p_msg_tbl[nbr_posted],
+                                  &msg_size_tbl[nbr_posted],
+                                  nbr - nbr_posted,
+                                  opt & OS_OPT_POST_LIFO,
+                                  ts,
+                                  p_err);
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((rdy                          == OS_TRUE) &&            /* Run the scheduler once, if the task was readied      */
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();
+    }
+
+    return (nbr_posted);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                    GIVE A PRIVATE POOL OF OS_MSGs TO A TASK'S QUEUE
+*
+* Description: This function makes a task's message queue take its OS_MSGs from a pool created by OSMsgPoolCreate()
+*              instead of the global pool.
+*
+* Arguments  : p_tcb     is a pointer to the task's OS_TCB.  If 'p_tcb' is a NULL pointer then the calling task's queue
+*                        is given the pool.
+*
+*              p_pool    is a pointer to the pool, a NULL pointer returns the queue to the global pool
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE              The call was successful
+*                            OS_ERR_Q_NOT_EMPTY       Messages are waiting in the task's queue
+*                            OS_ERR_SET_ISR           If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) Messages taken from a pool are returned to it, so the pool can only change while the queue is empty.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_MSG_POOL_PRIVATE_EN > 0u)
+void  OSTaskQPoolSet (OS_TCB       *p_tcb,
+                      OS_MSG_POOL  *p_pool,
+                      OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't change the pool from an ISR                    */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    if (p_pool == (OS_MSG_POOL *)0) {                           /* Back to the global pool?                             */
+        p_pool = &OSMsgPool;
     }
 
-    OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Give the pool to the calling task's queue?           */
+        p_tcb = OSTCBCurPtr;
+    }
+    if (p_tcb->MsgQ.NbrEntries > 0u) {                          /* See Note #1                                          */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_Q_NOT_EMPTY;
+        return;
+    }
+    p_tcb->MsgQ.PoolPtr = p_pool;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
 }
 #endif
 
@@ -1488,6 +2305,8 @@ void  OSTaskResume (OS_TCB  *p_tcb,
 *                                OS_OPT_PEND_BLOCKING
 *                                OS_OPT_PEND_NON_BLOCKING
 *
+*                            Add OS_OPT_PEND_TIMEOUT_US to give 'timeout' in microseconds (see OSTimeDlyUs()).
+*
 *              p_ts          is a pointer to a variable that will receive the timestamp of when the semaphore was posted
 *                            or pend aborted.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not get the
 *                            timestamp.  In other words, passing a NULL pointer is valid and indicates that you don't
@@ -1560,7 +2379,7 @@ OS_SEM_CTR  OSTaskSemPend (OS_TICK   timeout,
 #endif
 
 #if (OS_CFG_ARG_CHK_EN > 0u)
-    switch (opt) {                                              /* Validate 'opt'                                       */
+    switch (OS_OPT_PEND_OPT(opt)) {                             /* Validate 'opt'                                       */
         case OS_OPT_PEND_BLOCKING:
         case OS_OPT_PEND_NON_BLOCKING:
              break;
@@ -1626,7 +2445,8 @@ OS_SEM_CTR  OSTaskSemPend (OS_TICK   timeout,
     OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task pending on Signal                         */
              OSTCBCurPtr,
              OS_TASK_PEND_ON_TASK_SEM,
-             timeout);
+             timeout,
+             opt);
     CPU_CRITICAL_EXIT();
     OS_TRACE_TASK_SEM_PEND_BLOCK(OSTCBCurPtr);
     OSSched();                                                  /* Find next highest priority task ready to run         */
@@ -2000,6 +2820,68 @@ OS_SEM_CTR  OSTaskSemSet (OS_TCB      *p_tcb,
 }
 
 
+/*
+************************************************************************************************************************
+*                                                SET A TASK'S TIMER SLACK
+*
+* Description: This function is called to allow the delays & the pend timeouts of a task to expire late by up to
+*              'slack' ticks.  The kernel uses the slack to make the timeouts of several tasks expire on the same tick,
+*              which saves tick list updates & wakeups.
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
+*
+*              slack        is the number of ticks by which a delay or a timeout may be extended.  0 for exact timeouts.
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE       Upon success
+*                               OS_ERR_SET_ISR    If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The slack applies to every delay (OSTimeDly(), OSTimeDlyHMSM()) & every timed pend of the task, in all
+*                 the OS_OPT_TIME_xxx modes.  A periodic delay keeps its period, only the wakeup is late.
+*
+*              2) The new slack applies to the next delay or timeout of the task (see OS_TickListInsert()).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+void  OSTaskSlackSet (OS_TCB   *p_tcb,
+                      OS_TICK   slack,
+                      OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+
+    p_tcb->TickSlack = slack;                                   /* See Note #2                                          */
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                    STACK CHECKING
@@ -2366,6 +3248,242 @@ void  OSTaskTimeQuantaSet (OS_TCB   *p_tcb,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                           WAIT FOR THE NEXT PERIODIC RELEASE
+*
+* Description: This function is called by a periodic task (see OSTaskPeriodSet()) at the end of each job.  The task is
+*              delayed until its next release.
+*
+* Arguments  : p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE                   The task was delayed until its next release
+*                               OS_ERR_OS_NOT_RUNNING         If uC/OS-III is not running yet
+*                               OS_ERR_SCHED_LOCKED           Can't delay when the scheduler is locked
+*                               OS_ERR_TASK_NOT_PERIODIC      If the task has no period
+*                               OS_ERR_TASK_PERIOD_OVERRUN    If the next release was already due, see Note #2
+*                               OS_ERR_TIME_DLY_ISR           If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) With OS_CFG_TASK_PROFILE_EN, the time from the release of a job to its start (.PeriodJitter) & to its
+*                 completion (.PeriodResponse) are recorded, in OS_TS_GET() counts (OS_CFG_TS_EN must be enabled).  A
+*                 job starts when the task returns from this function.
+*
+*              2) A job which completes after the next release overruns.  The task is not delayed, it starts the next
+*                 job at once.  If more releases were missed, the latest one is kept & the earlier ones are dropped
+*                 (.PeriodSkipCtr), so the task does not run a burst of late jobs.  No jitter is recorded for the late
+*                 job.
+*
+*              3) OSTimeDlyResume() starts an extra job at once, the next release stays on schedule.
+*
+*              4) Only the expiry of the delay taken here stamps the release (.PeriodReleaseTS).  The delays & the pend
+*                 timeouts of the task within a job leave it alone.
+*
+*              5) With OS_CFG_SCHED_EDF_EN, each release also starts a new Earliest-Deadline-First job, see
+*                 OSTaskDeadlineSet().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PERIOD_EN > 0u)
+void  OSTaskWaitNextPeriod (OS_ERR  *p_err)
+{
+    OS_TCB   *p_tcb;
+    OS_TICK   time;
+    OS_TICK   release;
+    OS_TICK   late;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    CPU_TS    ts;
+#endif
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't delay when the scheduler is locked             */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if (p_tcb->Period == 0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_NOT_PERIODIC;
+        return;
+    }
+
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    ts = OS_TS_GET();                                           /* The current job is complete                          */
+    OS_TaskPeriodStatAdd(&p_tcb->PeriodResponse, ts - p_tcb->PeriodReleaseTS);
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    time    = OSTickCtr + OS_DynTickGet();
+#else
+    time    = OSTickCtr;
+#endif
+    release = p_tcb->PeriodRelease + p_tcb->Period;             /* Absolute time of the next release                    */
+    late    = time - p_tcb->PeriodRelease;
+    if (late >= p_tcb->Period) {                                /* Is the next release already due?                     */
+        late                    /= p_tcb->Period;               /* Number of releases due, see Note #2                  */
+        p_tcb->PeriodRelease    += late * p_tcb->Period;
+        p_tcb->PeriodSkipCtr    += late - 1u;
+        p_tcb->PeriodOverrunCtr++;
+        p_tcb->PeriodJobCtr++;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+        p_tcb->PeriodReleaseTS   = ts;
+#endif
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+        if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {             /* The next job is released at once, see Note #5        */
+            OS_SchedEdfRelease(p_tcb);
+            OS_RdyListRemove(p_tcb);
+            OS_PrioInsert(p_tcb->Prio);
+            OS_RdyListInsertDeadline(p_tcb);
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+        OSSched();                                              /* Its deadline may now be later than another EDF task's*/
+#endif
+       *p_err = OS_ERR_TASK_PERIOD_OVERRUN;
+        return;
+    }
+
+    OS_TickListInsertDly(p_tcb,
+                         release,
+                         OS_OPT_TIME_MATCH,
+                         p_err);
+    if (*p_err != OS_ERR_NONE) {
+         CPU_CRITICAL_EXIT();
+         return;
+    }
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    p_tcb->PeriodWait = OS_TRUE;                                /* Its expiry is the release, see Note #4               */
+#endif
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    p_tcb->DeadlineJobEnd = OS_TRUE;                            /* The next readying releases a job, see Note #5        */
+#endif
+
+    OS_RdyListRemove(p_tcb);                                    /* Remove current task from ready list                  */
+    CPU_CRITICAL_EXIT();
+
+    OSSched();                                                  /* Find next task to run!                               */
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    p_tcb->PeriodWait = OS_FALSE;
+#endif
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    p_tcb->DeadlineJobEnd = OS_FALSE;                           /* Not at OS_CFG_SCHED_EDF_PRIO when readied            */
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    late = OSTickCtr + OS_DynTickGet() - time;
+#else
+    late = OSTickCtr - time;
+#endif
+    p_tcb->PeriodJobCtr++;
+    if (late >= (release - time)) {                             /* Released by the tick list?                           */
+        p_tcb->PeriodRelease   = release;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)                               /* .PeriodReleaseTS was set when the delay expired      */
+        OS_TaskPeriodStatAdd(&p_tcb->PeriodJitter, OS_TS_GET() - p_tcb->PeriodReleaseTS);
+#endif
+    } else {
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+        p_tcb->PeriodReleaseTS = OS_TS_GET();                   /* Resumed early, see Note #3                           */
+#endif
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             CHARGE A TICK TO A TASK'S BUDGET
+*
+* Description: This function is called by OSTimeTick() to charge the tick which just elapsed to the task which was
+*              running.  A task which used up its budget is delayed until the end of its period.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The task is placed in the tick list as if it had called OSTimeDly(), OSIntExit() switches to the next
+*                 ready task.  OSTimeDlyResume() makes the task ready before the end of its period.
+*
+*              3) The task keeps running while the scheduler is locked, it is delayed on the first tick after the
+*                 scheduler is unlocked.
+*
+*              4) The task also keeps running while it owns a mutex, so the tasks waiting for the mutex are not held up
+*                 until the end of its period.  It is delayed on the first tick after it released its last mutex.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void  OS_TaskBudgetCharge (void)
+{
+    OS_TCB  *p_tcb;
+    OS_ERR   err;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if (p_tcb->BudgetQuanta == 0u) {                            /* Is the task's CPU time limited?                      */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    if ((OSTickCtr - p_tcb->BudgetStart) >= p_tcb->BudgetPeriod) {
+        p_tcb->BudgetStart = OSTickCtr;                         /* Previous period is over, replenish the budget        */
+        p_tcb->BudgetUsed  = 0u;
+    }
+    p_tcb->BudgetUsed++;
+
+    if ((p_tcb->BudgetUsed      >= p_tcb->BudgetQuanta) &&      /* Budget used up ...                                   */
+        (p_tcb->TaskState       == OS_TASK_STATE_RDY)   &&
+#if (OS_CFG_MUTEX_EN > 0u)
+        (p_tcb->MutexGrpHeadPtr == (OS_MUTEX *)0)       &&      /* ... & no mutex is held up by the task, see Note #4   */
+#endif
+        (OSSchedLockNestingCtr  ==                   0u)) {     /* ... & the task can be switched out, see Note #3      */
+        OS_TickListInsertDly(p_tcb,                             /* Delay the task until the end of its period           */
+                             p_tcb->BudgetStart + p_tcb->BudgetPeriod,
+                             OS_OPT_TIME_MATCH,
+                             &err);
+        if (err == OS_ERR_NONE) {
+            OS_RdyListRemove(p_tcb);
+            p_tcb->BudgetExhaustCtr++;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                            ADD/REMOVE TASK TO/FROM DEBUG LIST
@@ -2515,6 +3633,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if (OS_MSG_EN > 0u)
     p_tcb->MsgPtr               = (void             *)0;
     p_tcb->MsgSize              =                     0u;
+#if (OS_CFG_Q_POST_BLOCKING_EN > 0u) && (OS_CFG_Q_PRIO_EN > 0u)
+    p_tcb->MsgPrio              =                     0u;
+#endif
 #endif
 
 #if (OS_CFG_TASK_Q_EN > 0u)
@@ -2569,6 +3690,17 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if (OS_CFG_TICK_EN > 0u)
     p_tcb->TickRemain           =                     0u;
     p_tcb->TickCtrPrev          =                     0u;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    p_tcb->TickMatch            =                     0u;
+    p_tcb->TickSlot             =                     0u;
+#endif
+#if (OS_CFG_TICK_SLACK_EN > 0u)
+    p_tcb->TickSlack            =                     0u;
+#endif
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    p_tcb->UsMatch              =                     0u;
+    p_tcb->UsDly                =              OS_FALSE;
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
@@ -2576,6 +3708,41 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->TimeQuantaCtr        =                     0u;
 #endif
 
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    p_tcb->BudgetQuanta         =                     0u;
+    p_tcb->BudgetPeriod         =                     0u;
+    p_tcb->BudgetStart          =                     0u;
+    p_tcb->BudgetUsed           =                     0u;
+    p_tcb->BudgetExhaustCtr     =                     0u;
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    p_tcb->DeadlineRel          =                     0u;
+    p_tcb->DeadlinePeriod       =                     0u;
+    p_tcb->DeadlineRelease      =                     0u;
+    p_tcb->Deadline             =                     0u;
+    p_tcb->DeadlineJobEnd       =               OS_FALSE;
+#endif
+
+#if (OS_CFG_TASK_PERIOD_EN > 0u)
+    p_tcb->Period               =                     0u;
+    p_tcb->PeriodRelease        =                     0u;
+    p_tcb->PeriodJobCtr         =                     0u;
+    p_tcb->PeriodOverrunCtr     =                     0u;
+    p_tcb->PeriodSkipCtr        =                     0u;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    p_tcb->PeriodWait           =               OS_FALSE;
+    p_tcb->PeriodReleaseTS      =                     0u;
+    OS_TaskPeriodStatClr(&p_tcb->PeriodJitter);
+    OS_TaskPeriodStatClr(&p_tcb->PeriodResponse);
+#endif
+#endif
+
+#if (OS_CFG_TASK_PREEMPT_THRESHOLD_EN > 0u)
+    p_tcb->PrioThreshold        =           OS_PRIO_INIT;
+    p_tcb->PreemptNextPtr       =             (OS_TCB *)0;
+#endif
+
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
     p_tcb->CPUUsage             =                     0u;
     p_tcb->CPUUsageMax          =                     0u;
@@ -2601,6 +3768,10 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->PendObjPtr           = (OS_PEND_OBJ      *)0;
     p_tcb->PendOn               =  OS_TASK_PEND_ON_NOTHING;
     p_tcb->PendStatus           =  OS_STATUS_PEND_OK;
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    p_tcb->PendDataTblPtr       = (OS_PEND_DATA     *)0;
+    p_tcb->PendDataEntries      =                     0u;
+#endif
     p_tcb->TaskState            =  OS_TASK_STATE_RDY;
 
     p_tcb->Prio                 =  OS_PRIO_INIT;
@@ -2617,6 +3788,84 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 }
 
 
+/*
+************************************************************************************************************************
+*                                        ADD A SAMPLE TO A PERIODIC TASK STATISTIC
+*
+* Description: This function is called by OSTaskWaitNextPeriod() to record the jitter or the response time of a job.
+*
+* Arguments  : p_stat       is a pointer to the statistic.
+*              ------
+*
+*              sample       is the time to record, in OS_TS_GET() counts.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The bin of the histogram is half the number of significant bits of the sample, rounded up, so each bin
+*                 covers 4 times the range of the previous one.
+*
+*              3) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PERIOD_EN > 0u) && (OS_CFG_TASK_PROFILE_EN > 0u)
+void  OS_TaskPeriodStatAdd (OS_TASK_PERIOD_STAT  *p_stat,
+                            CPU_TS                sample)
+{
+    CPU_DATA  ix;
+
+
+    if ((p_stat->Nbr == 0u) ||
+        (p_stat->Min >  sample)) {
+        p_stat->Min = sample;
+    }
+    if (p_stat->Max < sample) {
+        p_stat->Max = sample;
+    }
+    p_stat->Sum += sample;
+    p_stat->Nbr++;
+                                                                /* See Note #2.                                         */
+    ix = (33u - CPU_CntLeadZeros32((CPU_INT32U)sample)) / 2u;
+    if (ix >= OS_TASK_PERIOD_HIST_NBR) {
+        ix  = OS_TASK_PERIOD_HIST_NBR - 1u;
+    }
+    p_stat->Hist[ix]++;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           CLEAR A PERIODIC TASK STATISTIC
+*
+* Description: This function is called to clear the jitter or the response time statistic of a periodic task.
+*
+* Arguments  : p_stat       is a pointer to the statistic.
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TaskPeriodStatClr (OS_TASK_PERIOD_STAT  *p_stat)
+{
+    CPU_DATA  ix;
+
+
+    p_stat->Min = 0u;
+    p_stat->Max = 0u;
+    p_stat->Sum = 0u;
+    p_stat->Nbr = 0u;
+    for (ix = 0u; ix < OS_TASK_PERIOD_HIST_NBR; ix++) {
+        p_stat->Hist[ix] = 0u;
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                              CATCH ACCIDENTAL TASK RETURN
@@ -2797,10 +4046,19 @@ void  OS_TaskChangePrio(OS_TCB  *p_tcb,
                  switch (p_tcb->PendOn) {                       /* What to do depends on what we are pending on         */
                      case OS_TASK_PEND_ON_FLAG:
                      case OS_TASK_PEND_ON_Q:
+                     case OS_TASK_PEND_ON_RING:
                      case OS_TASK_PEND_ON_SEM:
+                     case OS_TASK_PEND_ON_STREAM:
+                     case OS_TASK_PEND_ON_Q_POST:
                           OS_PendListChangePrio(p_tcb);
                           break;
 
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+                     case OS_TASK_PEND_ON_MULTI:
+                          OS_PendMultiChangePrio(p_tcb);
+                          break;
+#endif
+
                      case OS_TASK_PEND_ON_MUTEX:
 #if (OS_CFG_MUTEX_EN > 0u)
                           OS_PendListChangePrio(p_tcb);
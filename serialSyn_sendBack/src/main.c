@@ -20,7 +20,9 @@
 #define APP_TASK_START_PRIO 1u
 #define UART_TRANSMIT_TASK_PRIO 12u
 
-#define MAX_SIZE 65535u //Maximum UART transmission size
+#define RX_STREAM_SIZE 256u //Bytes buffered between the UART interrupt and the task, a power of 2
+#define TX_CHUNK_SIZE 64u   //Maximum bytes sent back per transmission
+#define RX_IDLE_TICKS 2u    //Idle time ending a received frame
 
 /*
 *********************************************************************************************************
@@ -34,10 +36,12 @@ static OS_TCB UartTransmitTaskTCB;
 static CPU_STK AppTaskStartStk[APP_TASK_START_STK_SIZE];
 static CPU_STK UartTransmitTaskStk[UART_TASK_STK_SIZE];
 
+static OS_STREAM rxStream;
+static CPU_INT08U rxStreamStorage[RX_STREAM_SIZE];
+
 UART_HandleTypeDef huart1;
 
-CPU_INT08U rxData[MAX_SIZE];
-CPU_INT16U rxLen;
+static CPU_INT08U txData[TX_CHUNK_SIZE];
 
 /*
 *********************************************************************************************************
@@ -63,6 +67,13 @@ int main(void)
 
     OSInit(&err);
 
+    OSStreamCreate((OS_STREAM *)&rxStream,
+                   (CPU_CHAR *)"UART Rx Stream",
+                   (void *)&rxStreamStorage[0],
+                   (OS_MSG_SIZE)RX_STREAM_SIZE,
+                   (OS_MSG_SIZE)TX_CHUNK_SIZE, //Ready the task once a full chunk is received
+                   (OS_ERR *)&err);
+
     OSTaskCreate((OS_TCB *)&AppTaskStartTCB,
                  (CPU_CHAR *)"App Task Start",
                  (OS_TASK_PTR)AppTaskStart,
@@ -96,8 +107,7 @@ static void AppTaskStart(void *p_arg)
     BSP_LED_Init(LED4);
     MX_USART1_UART_Init();
 
-    __HAL_UART_ENABLE_IT(&huart1, UART_IT_IDLE); //Enable UART IDLE Interrupt
-    HAL_UART_Receive_IT(&huart1, rxData, MAX_SIZE);
+    __HAL_UART_ENABLE_IT(&huart1, UART_IT_RXNE); //Interrupt on each received byte
 
     OSTaskCreate((OS_TCB *)&UartTransmitTaskTCB,
                  (CPU_CHAR *)"Uart Transmit Task",
@@ -123,20 +133,30 @@ static void AppTaskStart(void *p_arg)
 static void UartTransmitTask(void *p_arg)
 {
     OS_ERR err;
-    CPU_INT08U *txData;
-    OS_MSG_SIZE msg_size;
+    OS_MSG_SIZE len;
     CPU_TS ts;
 
     while (DEF_TRUE)
     {
-        txData = OSTaskQPend((OS_TICK)0, //Wait for messages from UART interrupt
-                             (OS_OPT)OS_OPT_PEND_BLOCKING,
-                             (OS_MSG_SIZE *)&msg_size,
-                             (CPU_TS *)&ts,
-                             (OS_ERR *)&err);
-
-        HAL_UART_Transmit_IT(&huart1, txData, msg_size); //Transmit back
-        HAL_UART_Receive_IT(&huart1, rxData, MAX_SIZE);  //Make ready for next interrupt
+        len = OSStreamRead((OS_STREAM *)&rxStream, //Wait for the first byte of a frame
+                           (void *)&txData[0],
+                           (OS_MSG_SIZE)1u,
+                           (OS_TICK)0,
+                           (OS_OPT)OS_OPT_PEND_BLOCKING,
+                           (OS_ERR *)&err);
+
+        len += OSStreamRead((OS_STREAM *)&rxStream, //Then for a full chunk, or for the line to go idle
+                            (void *)&txData[len],
+                            (OS_MSG_SIZE)(TX_CHUNK_SIZE - len),
+                            (OS_TICK)RX_IDLE_TICKS,
+                            (OS_OPT)OS_OPT_PEND_BLOCKING,
+                            (OS_ERR *)&err);
+
+        HAL_UART_Transmit_IT(&huart1, txData, len); //Transmit back
+        OSTaskSemPend((OS_TICK)0,                   //Wait for the transmission before reusing txData
+                      (OS_OPT)OS_OPT_PEND_BLOCKING,
+                      (CPU_TS *)&ts,
+                      (OS_ERR *)&err);
         BSP_LED_Toggle(LED4);
     }
 }
@@ -150,25 +170,36 @@ static void UartTransmitTask(void *p_arg)
 void USART1_IRQHandler(void)
 {
     OS_ERR err;
+    CPU_INT08U data;
+    CPU_SR_ALLOC();
 
-    uint32_t isrflags = READ_REG(huart1.Instance->SR);
-    uint32_t cr1its = READ_REG(huart1.Instance->CR1);
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();
+    CPU_CRITICAL_EXIT();
 
-    /* IDLE interrupt detection and handler to achieve unknown size transmission */
-    if (((isrflags & USART_SR_IDLE) != RESET) && ((cr1its & USART_CR1_IDLEIE)))
+    /* Received byte goes to the stream without masking interrupts, the task is readied once per chunk */
+    if (__HAL_UART_GET_FLAG(&huart1, UART_FLAG_RXNE) != RESET)
     {
-        __HAL_UART_CLEAR_IDLEFLAG(&huart1);
-        huart1.RxState = HAL_UART_STATE_READY;
-
-        rxLen = MAX_SIZE - huart1.RxXferCount;
-        OSTaskQPost((OS_TCB *)&UartTransmitTaskTCB,
-                    (void *)rxData,
-                    (OS_MSG_SIZE)rxLen,
-                    (OS_OPT)OS_OPT_POST_FIFO,
-                    (OS_ERR *)&err);
+        data = (CPU_INT08U)READ_REG(huart1.Instance->DR); //Reading SR then DR clears RXNE & the error flags
+        (void)OSStreamWrite((OS_STREAM *)&rxStream,
+                            (void *)&data,
+                            (OS_MSG_SIZE)1u,
+                            (OS_OPT)OS_OPT_POST_NONE,
+                            (OS_ERR *)&err);
     }
 
-    HAL_UART_IRQHandler(&huart1);
+    HAL_UART_IRQHandler(&huart1); //Transmission
+
+    OSIntExit();
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) //Weak function called from IRQ handler when transmit completed
+{
+    OS_ERR err;
+
+    OSTaskSemPost((OS_TCB *)&UartTransmitTaskTCB,
+                  (OS_OPT)OS_OPT_POST_NONE,
+                  (OS_ERR *)&err);
 }
 
 static void MX_USART1_UART_Init(void)
@@ -211,7 +242,7 @@ void HAL_UART_MspInit(UART_HandleTypeDef *huart)
         HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
         /* USART1 interrupt Init */
-        HAL_NVIC_SetPriority(USART1_IRQn, 0, 0);
+        HAL_NVIC_SetPriority(USART1_IRQn, CPU_CFG_KA_IPL_BOUNDARY, 0); //Kernel aware, calls OSStreamWrite()
         HAL_NVIC_EnableIRQ(USART1_IRQn);
     }
 }
\ No newline at end of file
@@ -117,6 +117,9 @@ void  OSSemCreate (OS_SEM      *p_sem,
     (void)p_name;
 #endif
     OS_PendListInit(&p_sem->PendList);                          /* Initialize the waiting list                          */
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    p_sem->PendMultiPtr = (OS_PEND_DATA *)0;
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
     OS_SemDbgListAdd(p_sem);
@@ -233,7 +236,12 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
     nbr_tasks   = 0u;
     switch (opt) {
         case OS_OPT_DEL_NO_PEND:                                /* Delete semaphore only if no task waiting             */
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+             if ((p_pend_list->HeadPtr == (OS_TCB       *)0) &&
+                 (p_sem->PendMultiPtr  == (OS_PEND_DATA *)0)) {
+#else
              if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#endif
 #if (OS_CFG_DBG_EN > 0u)
                  OS_SemDbgListRemove(p_sem);
                  OSSemQty--;
@@ -254,12 +262,13 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 #else
              ts = 0u;
 #endif
-             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks on the pend list                    */
-                 p_tcb = p_pend_list->HeadPtr;
+             p_tcb = OS_PEND_LIST_HEAD(p_sem);
+             while (p_tcb != (OS_TCB *)0) {                     /* Remove all tasks on the pend list                    */
                  OS_PendAbort(p_tcb,
                               ts,
                               OS_STATUS_PEND_DEL);
                  nbr_tasks++;
+                 p_tcb = OS_PEND_LIST_HEAD(p_sem);
              }
 #if (OS_CFG_DBG_EN > 0u)
              OS_SemDbgListRemove(p_sem);
@@ -303,6 +312,8 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 *                                OS_OPT_PEND_BLOCKING
 *                                OS_OPT_PEND_NON_BLOCKING
 *
+*                            Add OS_OPT_PEND_TIMEOUT_US to give 'timeout' in microseconds (see OSTimeDlyUs()).
+*
 *              p_ts          is a pointer to a variable that will receive the timestamp of when the semaphore was posted
 *                            or pend aborted or the semaphore deleted.  If you pass a NULL pointer (i.e. (CPU_TS*)0)
 *                            then you will not get the timestamp.  In other words, passing a NULL pointer is valid
@@ -392,7 +403,7 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return (0u);
     }
-    switch (opt) {                                              /* Validate 'opt'                                       */
+    switch (OS_OPT_PEND_OPT(opt)) {                             /* Validate 'opt'                                       */
         case OS_OPT_PEND_BLOCKING:
         case OS_OPT_PEND_NON_BLOCKING:
              break;
@@ -461,7 +472,8 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
     OS_Pend((OS_PEND_OBJ *)((void *)p_sem),                     /* Block task pending on Semaphore                      */
             OSTCBCurPtr,
             OS_TASK_PEND_ON_SEM,
-            timeout);
+            timeout,
+            opt);
     CPU_CRITICAL_EXIT();
     OS_TRACE_SEM_PEND_BLOCK(p_sem);
     OSSched();                                                  /* Find the next highest priority task ready to run     */
@@ -561,7 +573,6 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
                             OS_OPT   opt,
                             OS_ERR  *p_err)
 {
-    OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     CPU_TS         ts;
     OS_OBJ_QTY     nbr_tasks;
@@ -615,8 +626,8 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
 #endif
 
     CPU_CRITICAL_ENTER();
-    p_pend_list = &p_sem->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on semaphore?                       */
+    p_tcb = OS_PEND_LIST_HEAD(p_sem);
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any task waiting on semaphore?                       */
         CPU_CRITICAL_EXIT();                                    /* No                                                   */
        *p_err =  OS_ERR_PEND_ABORT_NONE;
         return (0u);
@@ -628,8 +639,7 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
 #else
     ts        = 0u;
 #endif
-    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
-        p_tcb = p_pend_list->HeadPtr;
+    while (p_tcb != (OS_TCB *)0) {
         OS_PendAbort(p_tcb,
                      ts,
                      OS_STATUS_PEND_ABORT);
@@ -637,6 +647,7 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
         if (opt != OS_OPT_PEND_ABORT_ALL) {                     /* Pend abort all tasks waiting?                        */
             break;                                              /* No                                                   */
         }
+        p_tcb = OS_PEND_LIST_HEAD(p_sem);
     }
     CPU_CRITICAL_EXIT();
 
@@ -687,9 +698,7 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
                        OS_ERR  *p_err)
 {
     OS_SEM_CTR     ctr;
-    OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
     CPU_TS         ts;
     CPU_SR_ALLOC();
 
@@ -749,8 +758,8 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
 
     OS_TRACE_SEM_POST(p_sem);
     CPU_CRITICAL_ENTER();
-    p_pend_list = &p_sem->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on semaphore?                       */
+    p_tcb = OS_PEND_LIST_HEAD(p_sem);
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any task waiting on semaphore?                       */
         if (p_sem->Ctr == (OS_SEM_CTR)-1) {
            CPU_CRITICAL_EXIT();
           *p_err = OS_ERR_SEM_OVF;
@@ -768,9 +777,7 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
         return (ctr);
     }
 
-    p_tcb = p_pend_list->HeadPtr;
     while (p_tcb != (OS_TCB *)0) {
-        p_tcb_next = p_tcb->PendNextPtr;
         OS_Post((OS_PEND_OBJ *)((void *)p_sem),
                 p_tcb,
                 (void *)0,
@@ -779,7 +786,7 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
         if ((opt & OS_OPT_POST_ALL) == 0u) {                     /* Post to all tasks waiting?                           */
             break;                                              /* No                                                   */
         }
-        p_tcb = p_tcb_next;
+        p_tcb = OS_PEND_LIST_HEAD(p_sem);
     }
     CPU_CRITICAL_EXIT();
     if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
@@ -863,7 +870,12 @@ void  OSSemSet (OS_SEM      *p_sem,
         p_sem->Ctr = cnt;                                       /* Yes, set it to the new value specified.              */
     } else {
         p_pend_list = &p_sem->PendList;                         /* No                                                   */
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+        if ((p_pend_list->HeadPtr == (OS_TCB       *)0) &&      /* See if task(s) waiting?                              */
+            (p_sem->PendMultiPtr  == (OS_PEND_DATA *)0)) {
+#else
         if (p_pend_list->HeadPtr == (OS_TCB *)0) {              /* See if task(s) waiting?                              */
+#endif
             p_sem->Ctr = cnt;                                   /* No, OK to set the value                              */
         } else {
            *p_err      = OS_ERR_TASK_WAITING;
@@ -903,6 +915,9 @@ void  OS_SemClr (OS_SEM  *p_sem)
     p_sem->NamePtr = (CPU_CHAR *)((void *)"?SEM");
 #endif
     OS_PendListInit(&p_sem->PendList);                          /* Initialize the waiting list                          */
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    p_sem->PendMultiPtr = (OS_PEND_DATA *)0;
+#endif
 }
 
 
@@ -62,6 +62,11 @@ extern  "C" {                                    /* See Note #1.
 *                                               DEFINES
 * Note(s) : (1) Determines the interrupt programmable priority levels. This is normally specified in the
 *               Microcontroller reference manual. 4-bits gives us 16 programmable priority levels.
+*
+*           (2) 32-bit timer of the dynamic tick (OS_CFG_DYN_TICK_EN) & of the microsecond timer
+*               (OS_CFG_TIME_DLY_US_EN), TIM2 (2) or TIM5 (5).  The interrupt of this timer is routed to
+*               OS_CPU_TmrHandler() in 'cortex_ports.S' when one of these options is enabled.  That file
+*               repeats the default below, select TIM2 in the build flags rather than here.
 *********************************************************************************************************
 */
 
@@ -87,6 +92,14 @@ extern  "C" {                                    /* See Note #1.
 #endif
 #endif
 
+#ifndef  OS_CPU_CFG_DYN_TICK_TMR
+#define  OS_CPU_CFG_DYN_TICK_TMR       5u                                       /* See Note # 2            */
+#endif
+
+#if (OS_CPU_CFG_DYN_TICK_TMR != 2u) && (OS_CPU_CFG_DYN_TICK_TMR != 5u)
+#error  "OS_CPU_CFG_DYN_TICK_TMR        illegal, should be 2 (TIM2) or 5 (TIM5) "
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -157,10 +170,13 @@ void  OS_CPU_SysTickInitFreq(CPU_INT32U   cpu_freq);
 void  OS_CPU_SysTickHandler (void);
 void  OS_CPU_PendSVHandler  (void);
 
-#if (OS_CPU_ARM_FP_EN > 0u)
-void  OS_CPU_FP_Reg_Push    (CPU_STK     *stkPtr);
-void  OS_CPU_FP_Reg_Pop     (CPU_STK     *stkPtr);
-#endif
+void  OS_CPU_TmrHandler     (void);
+
+void  OS_CPU_DynTickInit    (CPU_INT32U   tmr_freq);
+void  OS_CPU_DynTickHandler (void);
+
+void  OS_CPU_UsTmrInit      (CPU_INT32U   tmr_freq);
+void  OS_CPU_UsTmrHandler   (void);
 
 
 /*
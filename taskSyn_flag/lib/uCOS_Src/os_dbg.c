@@ -108,6 +108,12 @@ CPU_INT16U  const  OSDbg_MutexSize             = 0u;
 CPU_INT08U  const  OSDbg_ObjTypeChkEn          = OS_CFG_OBJ_TYPE_CHK_EN;
 
 
+CPU_INT08U  const  OSDbg_PendMultiEn           = OS_CFG_PEND_MULTI_EN;
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+CPU_INT16U  const  OSDbg_PendDataSize          = sizeof(OS_PEND_DATA);         /* Size in bytes of OS_PEND_DATA       */
+#else
+CPU_INT16U  const  OSDbg_PendDataSize          = 0u;
+#endif
 CPU_INT16U  const  OSDbg_PendListSize          = sizeof(OS_PEND_LIST);
 CPU_INT16U  const  OSDbg_PendObjSize           = sizeof(OS_PEND_OBJ);
 
@@ -133,6 +139,21 @@ CPU_INT16U  const  OSDbg_QSize                 = 0u;
 #endif
 
 
+OS_RING     const  OSDbg_Ring                  = { 0u };
+CPU_INT08U  const  OSDbg_RingEn                = OS_CFG_RING_EN;
+#if (OS_CFG_RING_EN > 0u)
+CPU_INT08U  const  OSDbg_RingDelEn             = OS_CFG_RING_DEL_EN;
+CPU_INT08U  const  OSDbg_RingFlushEn           = OS_CFG_RING_FLUSH_EN;
+CPU_INT08U  const  OSDbg_RingPendAbortEn       = OS_CFG_RING_PEND_ABORT_EN;
+CPU_INT16U  const  OSDbg_RingSize              = sizeof(OS_RING);              /* Size in bytes of OS_RING structure  */
+#else
+CPU_INT08U  const  OSDbg_RingDelEn             = 0u;
+CPU_INT08U  const  OSDbg_RingFlushEn           = 0u;
+CPU_INT08U  const  OSDbg_RingPendAbortEn       = 0u;
+CPU_INT16U  const  OSDbg_RingSize              = 0u;
+#endif
+
+
 CPU_INT08U  const  OSDbg_SchedRoundRobinEn     = OS_CFG_SCHED_ROUND_ROBIN_EN;
 
 
@@ -151,6 +172,28 @@ CPU_INT16U  const  OSDbg_SemSize               = 0u;
 #endif
 
 
+OS_STREAM   const  OSDbg_Stream                = { 0u };
+CPU_INT08U  const  OSDbg_StreamEn              = OS_CFG_STREAM_EN;
+#if (OS_CFG_STREAM_EN > 0u)
+CPU_INT08U  const  OSDbg_StreamDelEn           = OS_CFG_STREAM_DEL_EN;
+CPU_INT08U  const  OSDbg_StreamPendAbortEn     = OS_CFG_STREAM_PEND_ABORT_EN;
+CPU_INT16U  const  OSDbg_StreamSize            = sizeof(OS_STREAM);            /* Size in bytes of OS_STREAM          */
+#else
+CPU_INT08U  const  OSDbg_StreamDelEn           = 0u;
+CPU_INT08U  const  OSDbg_StreamPendAbortEn     = 0u;
+CPU_INT16U  const  OSDbg_StreamSize            = 0u;
+#endif
+
+
+OS_TOPIC    const  OSDbg_Topic                 = { 0u };
+CPU_INT08U  const  OSDbg_TopicEn               = OS_CFG_TOPIC_EN;
+#if (OS_CFG_TOPIC_EN > 0u)
+CPU_INT16U  const  OSDbg_TopicSize             = sizeof(OS_TOPIC);             /* Size in bytes of OS_TOPIC           */
+#else
+CPU_INT16U  const  OSDbg_TopicSize             = 0u;
+#endif
+
+
 CPU_INT16U  const  OSDbg_RdyList               = sizeof(OS_RDY_LIST);
 CPU_INT32U  const  OSDbg_RdyListSize           = sizeof(OSRdyList);            /* Number of bytes in the ready table  */
 
@@ -288,12 +331,22 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSPrioCur)
                                   + sizeof(OSPrioHighRdy)
                                   + sizeof(OSPrioTbl)
+#if (OS_PRIO_GRP_EN > 0u)
+                                  + sizeof(OSPrioGrp)
+#endif
 
 #if (OS_CFG_Q_EN > 0u)
 #if (OS_CFG_DBG_EN > 0u)
                                   + sizeof(OSQDbgListPtr)
                                   + sizeof(OSQQty)
 #endif
+#endif
+
+#if (OS_CFG_RING_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSRingDbgListPtr)
+                                  + sizeof(OSRingQty)
+#endif
 #endif
 
                                   + sizeof(OSRdyList)
@@ -317,6 +370,20 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #endif
                                   + sizeof(OSSemQty)
 #endif
+
+#if (OS_CFG_STREAM_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSStreamDbgListPtr)
+                                  + sizeof(OSStreamQty)
+#endif
+#endif
+
+#if (OS_CFG_TOPIC_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSTopicDbgListPtr)
+                                  + sizeof(OSTopicQty)
+#endif
+#endif
 #if ((OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u))
                                   + sizeof(OSTaskCtxSwCtr)
 #if (OS_CFG_DBG_EN > 0u)
@@ -346,6 +413,7 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSTickCtr)
                                   + sizeof(OSTickList)
 #if (OS_CFG_TS_EN > 0u)
+                                  + sizeof(OSTickTS)
                                   + sizeof(OSTickTime)
                                   + sizeof(OSTickTimeMax)
 #endif
@@ -357,7 +425,9 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSTmrDbgListPtr)
                                   + sizeof(OSTmrListEntries)
 #endif
-                                  + sizeof(OSTmrListPtr)
+                                  + sizeof(OSTmrWheelTbl)
+                                  + sizeof(OSTmrWheelMap)
+                                  + sizeof(OSTmrWheelTick)
                                   + sizeof(OSTmrMutex)
                                   + sizeof(OSTmrCond)
 #if (OS_CFG_DBG_EN > 0u)
@@ -450,6 +520,8 @@ void  OS_Dbg_Init (void)
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_ObjTypeChkEn;
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_PendMultiEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_PendDataSize;
     p_temp16 = (CPU_INT16U const *)&OSDbg_PendListSize;
     p_temp16 = (CPU_INT16U const *)&OSDbg_PendObjSize;
 
@@ -467,6 +539,15 @@ void  OS_Dbg_Init (void)
     p_temp16 = (CPU_INT16U const *)&OSDbg_QSize;
 #endif
 
+    p_temp16 = (CPU_INT16U const *)&OSDbg_Ring;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RingEn;
+#if (OS_CFG_RING_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RingDelEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RingFlushEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RingPendAbortEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_RingSize;
+#endif
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_SchedRoundRobinEn;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_Sem;
@@ -478,6 +559,18 @@ void  OS_Dbg_Init (void)
     p_temp16 = (CPU_INT16U const *)&OSDbg_SemSize;
 #endif
 
+    p_temp16 = (CPU_INT16U const *)&OSDbg_Stream;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_StreamEn;
+#if (OS_CFG_STREAM_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_StreamDelEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_StreamPendAbortEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_StreamSize;
+#endif
+
+    p_temp16 = (CPU_INT16U const *)&OSDbg_Topic;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TopicEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TopicSize;
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_RdyList;
     p_temp32 = (CPU_INT32U const *)&OSDbg_RdyListSize;
 
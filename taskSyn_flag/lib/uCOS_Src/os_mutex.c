@@ -319,6 +319,8 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *                                OS_OPT_PEND_BLOCKING
 *                                OS_OPT_PEND_NON_BLOCKING
 *
+*                            Add OS_OPT_PEND_TIMEOUT_US to give 'timeout' in microseconds (see OSTimeDlyUs()).
+*
 *              p_ts          is a pointer to a variable that will receive the timestamp of when the mutex was posted or
 *                            pend aborted or the mutex deleted.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you
 *                            will not get the timestamp.  In other words, passing a NULL pointer is valid and indicates
@@ -406,7 +408,7 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return;
     }
-    switch (opt) {                                              /* Validate 'opt'                                       */
+    switch (OS_OPT_PEND_OPT(opt)) {                             /* Validate 'opt'                                       */
         case OS_OPT_PEND_BLOCKING:
         case OS_OPT_PEND_NON_BLOCKING:
              break;
@@ -501,7 +503,8 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
     OS_Pend((OS_PEND_OBJ *)((void *)p_mutex),                   /* Block task pending on Mutex                          */
              OSTCBCurPtr,
              OS_TASK_PEND_ON_MUTEX,
-             timeout);
+             timeout,
+             opt);
 
     CPU_CRITICAL_EXIT();
     OS_TRACE_MUTEX_PEND_BLOCK(p_mutex);
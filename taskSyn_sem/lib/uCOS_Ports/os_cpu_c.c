@@ -60,6 +60,18 @@ extern  "C" {
 
 CPU_INT32U  OS_KA_BASEPRI_Boundary;                             /* Base Priority boundary.                              */
 
+#if (OS_CFG_DYN_TICK_EN > 0u) || (OS_CFG_TIME_DLY_US_EN > 0u)
+static  CPU_INT32U  OS_CPU_TmrCntFreq;                          /* Timer counting frequency, 0 until it is started.     */
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT32U  OS_CPU_DynTickCnts;                         /* Timer counts per tick, 0 until the timer is started. */
+static  CPU_INT32U  OS_CPU_DynTickBase;                         /* Timer count when OSTickCtr was ...                   */
+static  OS_TICK     OS_CPU_DynTickBaseCtr;                      /* ... equal to OS_CPU_DynTickBaseCtr.                  */
+static  OS_TICK     OS_CPU_DynTickStep;                         /* Ticks from the base to the programmed event.         */
+static  OS_TICK     OS_CPU_DynTickMax;                          /* Longest step the 32-bit timer can count.             */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -74,6 +86,57 @@ CPU_INT32U  OS_KA_BASEPRI_Boundary;                             /* Base Priority
 #define  CPU_REG_FPCCR_LAZY_STK                        0xC0000000uL
 
 
+/*
+*********************************************************************************************************
+*                                         DYNAMIC TICK DEFINES
+*
+* Note(s) : (1) The dynamic tick counts on a 32-bit general purpose timer of the STM32F4xx clocked from
+*               APB1, TIM2 or TIM5 (see 'os_cpu.h  OS_CPU_CFG_DYN_TICK_TMR').
+*
+*           (2) The microsecond timer (OS_CFG_TIME_DLY_US_EN) shares that timer : it then counts at 1 MHz,
+*               the dynamic tick on compare channel 1 & the microsecond delays on compare channel 2.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_DYN_TICK_TMR == 2u)
+#define  OS_CPU_DYN_TICK_TMR_BASE                      0x40000000uL     /* TIM2.                                       */
+#define  OS_CPU_DYN_TICK_TMR_CLK_EN                    DEF_BIT_00       /* RCC_APB1ENR.TIM2EN                          */
+#define  OS_CPU_DYN_TICK_INT_POS                      (CPU_INT_EXT0 + 28u)
+#else
+#define  OS_CPU_DYN_TICK_TMR_BASE                      0x40000C00uL     /* TIM5.                                       */
+#define  OS_CPU_DYN_TICK_TMR_CLK_EN                    DEF_BIT_03       /* RCC_APB1ENR.TIM5EN                          */
+#define  OS_CPU_DYN_TICK_INT_POS                      (CPU_INT_EXT0 + 50u)
+#endif
+
+#define  OS_CPU_REG_RCC_APB1ENR        (*((CPU_REG32 *)0x40023840uL))   /* APB1 Peripheral Clock Enable Reg.           */
+
+#define  OS_CPU_REG_TMR_CR1            (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x00u)))   /* Control Reg. 1.       */
+#define  OS_CPU_REG_TMR_DIER           (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x0Cu)))   /* DMA/Int. Enable Reg.  */
+#define  OS_CPU_REG_TMR_SR             (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x10u)))   /* Status Reg.           */
+#define  OS_CPU_REG_TMR_EGR            (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x14u)))   /* Event Generation Reg. */
+#define  OS_CPU_REG_TMR_CNT            (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x24u)))   /* Counter.              */
+#define  OS_CPU_REG_TMR_PSC            (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x28u)))   /* Prescaler.            */
+#define  OS_CPU_REG_TMR_ARR            (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x2Cu)))   /* Auto-Reload Reg.      */
+#define  OS_CPU_REG_TMR_CCR1           (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x34u)))   /* Capture/Compare Reg 1 */
+#define  OS_CPU_REG_TMR_CCR2           (*((CPU_REG32 *)(OS_CPU_DYN_TICK_TMR_BASE + 0x38u)))   /* Capture/Compare Reg 2 */
+
+#define  OS_CPU_REG_TMR_CR1_CEN                        DEF_BIT_00       /* Counter enable.                             */
+#define  OS_CPU_REG_TMR_EGR_UG                         DEF_BIT_00       /* Update generation.                          */
+#define  OS_CPU_REG_TMR_CC1                            DEF_BIT_01       /* DIER.CC1IE, SR.CC1IF & EGR.CC1G.            */
+#define  OS_CPU_REG_TMR_CC2                            DEF_BIT_02       /* DIER.CC2IE, SR.CC2IF & EGR.CC2G.            */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u) || (OS_CFG_TIME_DLY_US_EN > 0u)
+static  CPU_INT32U  OS_CPU_TmrStart (CPU_INT32U  tmr_freq);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           IDLE TASK HOOK
@@ -83,7 +146,9 @@ CPU_INT32U  OS_KA_BASEPRI_Boundary;                             /* Base Priority
 *
 * Arguments  : None.
 *
-* Note(s)    : None.
+* Note(s)    : 1) With the dynamic tick, the CPU sleeps until the next interrupt : the tick list event
+*                 programmed in the timer or a peripheral.  OSIdleTaskCtr then no longer measures the idle
+*                 time & the CPU usage computed by the statistic task is meaningless.
 *********************************************************************************************************
 */
 
@@ -94,6 +159,10 @@ void  OSIdleTaskHook (void)
         (*OS_AppIdleTaskHookPtr)();
     }
 #endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_WaitForInt();                                           /* See Note #1.                                         */
+#endif
 }
 
 
@@ -283,15 +352,16 @@ void  OSTaskReturnHook (OS_TCB  *p_tcb)
 *
 *              (2) All tasks run in Thread mode, using process stack.
 *
-*              (3) There are two different stack frames depending on whether the Floating-Point(FP)
-*                  co-processor is enabled or not.
+*              (3) There are two different stack frames depending on whether the task uses the Floating-Point(FP)
+*                  co-processor or not.
 *
-*                  (a) The stack frame shown in the diagram is used when the Co-processor Access Control
-*                      Register(CPACR) is disabling the Floating Point Unit. In this case, the FP
-*                      registers(S0- S31) & FP Status Control(FPSCR) register are not saved in the stack frame.
+*                  (a) The stack frame shown in the diagram is used by every task when it is created and by a task
+*                      which never executes an FP instruction. In this case, the FP registers(S0- S31) & FP Status
+*                      Control(FPSCR) register are not saved in the stack frame.
 *
-*                  (b) The stack frame shown in the diagram is used when the Floating Point Unit is enabled,
-*                      that is, CP10 and CP11 field in CPACR are ones and FPCCR sets bits ASPEN and LSPEN to 1.
+*                  (b) The stack frame shown in the diagram is used once the task has executed an FP instruction,
+*                      which is flagged by bit 4 of EXEC_RETURN being clear (see Note 5). The processor stacks
+*                      S0-S15 & FPSCR lazily and PendSV saves S16-S31 above EXEC_RETURN.
 *
 *                      (1) When enabling the FPU through CPACR, make sure to set bits ASPEN and LSPEN in the
 *                          Floating-Point Context Control Register (FPCCR).
@@ -329,43 +399,39 @@ void  OSTaskReturnHook (OS_TCB  *p_tcb)
 *                    +-------------+       +-------------+
 *                    |    R3       |       |     R3      |
 *                    +-------------+       +-------------+
-*                    |    R2       |       |     R0      |
+*                    |    R2       |       |     R2      |
 *                    +-------------+       +-------------+
 *                    |    R1       |       |     R1      |
 *                    +-------------+       +-------------+
 *                    |    R0       |       |     R0      |
 *                    +-------------+       +-------------+
-*                    | EXEC_RETURN |       | EXEC_RETURN |
-*                    +-------------+       +-------------+
-*                    |    R11      |       |     R11     |
+*                    | EXEC_RETURN |       |     S31     |
 *                    +-------------+       +-------------+
-*                    |    R10      |       |     R10     |
+*                    |    R11      |       |     S30     |
 *                    +-------------+       +-------------+
-*                    |    R9       |       |     R9      |
+*                    |    R10      |       |     S29     |
 *                    +-------------+       +-------------+
-*                    |    R8       |       |     R8      |
+*                    |    R9       |             .
+*                    +-------------+             .
+*                    |    R8       |             .
 *                    +-------------+       +-------------+
-*                    |    R7       |       |     R7      |
+*                    |    R7       |       |     S17     |
 *                    +-------------+       +-------------+
-*                    |    R6       |       |     R6      |
+*                    |    R6       |       |     S16     |
 *                    +-------------+       +-------------+
-*                    |    R5       |       |     R5      |
+*                    |    R5       |       | EXEC_RETURN |
 *                    +-------------+       +-------------+
-*                    |    R4       |       |     R4      |
+*                    |    R4       |       |     R11     |
 *                    +-------------+       +-------------+
-*                          (a)             |     S31     |
+*                          (a)             |     R10     |
 *                                          +-------------+
-*                                          |     S30     |
-*                                          +-------------+
-*                                          |     S29     |
-                                           +-------------+
 *                                                .
 *                                                .
 *                                                .
 *                                          +-------------+
-*                                          |     S17     |
-                                           +-------------+
-*                                          |     S16     |
+*                                          |     R5      |
+*                                          +-------------+
+*                                          |     R4      |
 *                                          +-------------+
 *                                               (b)
 *
@@ -451,27 +517,6 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
                                                                 /* Align the stack to 8-bytes.                          */
     p_stk = (CPU_STK *)((CPU_STK)(p_stk) & 0xFFFFFFF8u);
                                                                 /* Registers stacked as if auto-saved on exception      */
-#if (OS_CPU_ARM_FP_EN > 0u)                                     /* FPU auto-saved registers.                            */
-     --p_stk;
-    *(--p_stk) = (CPU_STK)0x02000000u;                          /* FPSCR                                                */
-                                                                /* Initialize S0-S15 floating point registers           */
-    *(--p_stk) = (CPU_STK)0x41700000u;                          /* S15                                                  */
-    *(--p_stk) = (CPU_STK)0x41600000u;                          /* S14                                                  */
-    *(--p_stk) = (CPU_STK)0x41500000u;                          /* S13                                                  */
-    *(--p_stk) = (CPU_STK)0x41400000u;                          /* S12                                                  */
-    *(--p_stk) = (CPU_STK)0x41300000u;                          /* S11                                                  */
-    *(--p_stk) = (CPU_STK)0x41200000u;                          /* S10                                                  */
-    *(--p_stk) = (CPU_STK)0x41100000u;                          /* S9                                                   */
-    *(--p_stk) = (CPU_STK)0x41000000u;                          /* S8                                                   */
-    *(--p_stk) = (CPU_STK)0x40E00000u;                          /* S7                                                   */
-    *(--p_stk) = (CPU_STK)0x40C00000u;                          /* S6                                                   */
-    *(--p_stk) = (CPU_STK)0x40A00000u;                          /* S5                                                   */
-    *(--p_stk) = (CPU_STK)0x40800000u;                          /* S4                                                   */
-    *(--p_stk) = (CPU_STK)0x40400000u;                          /* S3                                                   */
-    *(--p_stk) = (CPU_STK)0x40000000u;                          /* S2                                                   */
-    *(--p_stk) = (CPU_STK)0x3F800000u;                          /* S1                                                   */
-    *(--p_stk) = (CPU_STK)0x00000000u;                          /* S0                                                   */
-#endif
     *(--p_stk) = (CPU_STK)0x01000000u;                          /* xPSR                                                 */
     *(--p_stk) = (CPU_STK)p_task;                               /* Entry Point                                          */
     *(--p_stk) = (CPU_STK)OS_TaskReturn;                        /* R14 (LR)                                             */
@@ -481,11 +526,7 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
     *(--p_stk) = (CPU_STK)p_stk_limit;                          /* R1                                                   */
     *(--p_stk) = (CPU_STK)p_arg;                                /* R0 : argument                                        */
 
-#if (OS_CPU_ARM_FP_EN > 0u)
-    *(--p_stk) = (CPU_STK)0xFFFFFFEDuL;                         /* R14: EXEC_RETURN; See Note 5                         */
-#else
-    *(--p_stk) = (CPU_STK)0xFFFFFFFDuL;                         /* R14: EXEC_RETURN; See Note 5                         */
-#endif
+    *(--p_stk) = (CPU_STK)0xFFFFFFFDuL;                         /* R14: EXEC_RETURN; See Note 3a & 5                    */
                                                                 /* Remaining registers saved on process stack           */
     *(--p_stk) = (CPU_STK)0x11111111uL;                         /* R11                                                  */
     *(--p_stk) = (CPU_STK)0x10101010uL;                         /* R10                                                  */
@@ -496,26 +537,6 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
     *(--p_stk) = (CPU_STK)0x05050505uL;                         /* R5                                                   */
     *(--p_stk) = (CPU_STK)0x04040404uL;                         /* R4                                                   */
 
-#if (OS_CPU_ARM_FP_EN > 0u)
-                                                                /* Initialize S16-S31 floating point registers          */
-    *(--p_stk) = (CPU_STK)0x41F80000u;                          /* S31                                                  */
-    *(--p_stk) = (CPU_STK)0x41F00000u;                          /* S30                                                  */
-    *(--p_stk) = (CPU_STK)0x41E80000u;                          /* S29                                                  */
-    *(--p_stk) = (CPU_STK)0x41E00000u;                          /* S28                                                  */
-    *(--p_stk) = (CPU_STK)0x41D80000u;                          /* S27                                                  */
-    *(--p_stk) = (CPU_STK)0x41D00000u;                          /* S26                                                  */
-    *(--p_stk) = (CPU_STK)0x41C80000u;                          /* S25                                                  */
-    *(--p_stk) = (CPU_STK)0x41C00000u;                          /* S24                                                  */
-    *(--p_stk) = (CPU_STK)0x41B80000u;                          /* S23                                                  */
-    *(--p_stk) = (CPU_STK)0x41B00000u;                          /* S22                                                  */
-    *(--p_stk) = (CPU_STK)0x41A80000u;                          /* S21                                                  */
-    *(--p_stk) = (CPU_STK)0x41A00000u;                          /* S20                                                  */
-    *(--p_stk) = (CPU_STK)0x41980000u;                          /* S19                                                  */
-    *(--p_stk) = (CPU_STK)0x41900000u;                          /* S18                                                  */
-    *(--p_stk) = (CPU_STK)0x41880000u;                          /* S17                                                  */
-    *(--p_stk) = (CPU_STK)0x41800000u;                          /* S16                                                  */
-#endif
-
     return (p_stk);
 }
 
@@ -533,6 +554,8 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
 *              2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task
 *                 that will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points
 *                 to the task being switched out (i.e. the preempted task).
+*              3) The FP registers are saved & restored by OS_CPU_PendSVHandler(), only for the tasks
+*                 which use the FPU.
 *********************************************************************************************************
 */
 
@@ -548,10 +571,6 @@ void  OSTaskSwHook (void)
     CPU_BOOLEAN  stk_status;
 #endif
 
-#if (OS_CPU_ARM_FP_EN > 0u)
-    OS_CPU_FP_Reg_Push(OSTCBCurPtr->StkPtr);                    /* Push the FP registers of the current task.           */
-#endif
-
 #if OS_CFG_APP_HOOKS_EN > 0u
     if (OS_AppTaskSwHookPtr != (OS_APP_HOOK_VOID)0) {
         (*OS_AppTaskSwHookPtr)();
@@ -592,10 +611,6 @@ void  OSTaskSwHook (void)
         OSRedzoneHitHook(OSTCBCurPtr);
     }
 #endif
-
-#if (OS_CPU_ARM_FP_EN > 0u)
-    OS_CPU_FP_Reg_Pop(OSTCBHighRdyPtr->StkPtr);                 /* Pop the FP registers of the highest ready task.      */
-#endif
 }
 
 
@@ -631,6 +646,8 @@ void  OSTimeTickHook (void)
 * Arguments  : None.
 *
 * Note(s)    : 1) This function MUST be placed on entry 15 of the Cortex-M vector table.
+*
+*              2) With the dynamic tick, the kernel is ticked by OS_CPU_DynTickHandler() only.
 *********************************************************************************************************
 */
 
@@ -643,7 +660,9 @@ void  OS_CPU_SysTickHandler  (void)
     OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
     CPU_CRITICAL_EXIT();
 
+#if (OS_CFG_DYN_TICK_EN == 0u)                                  /* See Note #2.                                         */
     OSTimeTick();                                               /* Call uC/OS-III's OSTimeTick()                        */
+#endif
 
     OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
 }
@@ -720,6 +739,419 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
 #endif
 }
 
+
+/*
+*********************************************************************************************************
+*                                       INITIALIZE DYNAMIC TICK
+*
+* Description: Start the dynamic tick timer (see 'DYNAMIC TICK DEFINES') & program the first event of the
+*              tick list.
+*
+* Arguments  : tmr_freq     Timer clock frequency : the APB1 timer clock, twice PCLK1 when the APB1
+*                           prescaler is not 1 (90 MHz with a 180 MHz core clock).
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization, instead
+*                 of OS_CPU_SysTickInit().  With the microsecond timer, the tick is counted in microseconds
+*                 (see 'DYNAMIC TICK DEFINES  Note #2').
+*
+*              2) The SysTick may keep running for the HAL, but its interrupt no longer ticks the kernel.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_DynTickInit (CPU_INT32U  tmr_freq)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_INT32U  cnt_freq;
+    CPU_SR_ALLOC();
+
+
+    cnt_freq                = OS_CPU_TmrStart(tmr_freq);
+
+    CPU_REG_SYST_CSR       &= ~CPU_REG_SYST_CSR_TICKINT;        /* See Note #2.                                         */
+
+    CPU_CRITICAL_ENTER();
+    OS_CPU_DynTickCnts      = cnt_freq / (CPU_INT32U)OSCfg_TickRate_Hz;
+    OS_CPU_DynTickMax       = (OS_TICK)((DEF_INT_32U_MAX_VAL / OS_CPU_DynTickCnts) - 1u);
+    OS_CPU_DynTickBase      = OS_CPU_REG_TMR_CNT;
+    OS_CPU_DynTickBaseCtr   = OSTickCtr;
+    OS_CPU_REG_TMR_DIER    |= OS_CPU_REG_TMR_CC1;               /* Interrupt on a compare match.                        */
+
+    (void)OS_DynTickSet(OSTickCtrStep);                         /* Program the first event of the tick list.            */
+    CPU_CRITICAL_EXIT();
+#else
+    (void)tmr_freq;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DYNAMIC TICK HANDLER
+*
+* Description: Handle the compare match of the dynamic tick timer : announce the ticks elapsed to the
+*              kernel, which programs the next event of the tick list.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is called by OS_CPU_TmrHandler() on a compare 1 match.
+*
+*              2) The elapsed ticks are read from the timer, so a late interrupt loses no time.  Reading
+*                 them & updating the tick list is done in one critical section : an interrupt posting
+*                 to a task waiting with a timeout also moves OSTickCtr forward (see OS_TickListRemove()).
+*
+*              3) A match of the previous event may be raised while OS_DynTickSet() programs the next one.
+*                 The interrupt then finds no elapsed tick & the same event is simply programmed again.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_DynTickHandler (void)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK  ticks;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+    OS_CPU_REG_TMR_SR = ~OS_CPU_REG_TMR_CC1;                    /* Clear the compare match.                             */
+
+    ticks = OS_DynTickGet();                                    /* See Note #2.                                         */
+    if (ticks > 0u) {
+        OSTimeDynTick(ticks);                                   /* Update the tick list & program its next event.       */
+    } else {
+        (void)OS_DynTickSet(OS_CPU_DynTickStep);                /* See Note #3.                                         */
+    }
+    CPU_CRITICAL_EXIT();
+
+    OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                     GET ELAPSED DYNAMIC TICKS
+*
+* Description: Return the number of ticks elapsed since OSTickCtr was last brought up to date.
+*
+* Arguments  : None.
+*
+* Returns    : The number of ticks not yet accounted for in OSTickCtr.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled.
+*
+*              2) Ticks past the programmed event belong to the timer interrupt, which is pending : the
+*                 kernel must not step over the event before its tick list is updated.
+*
+*              3) OS_TickUpdate() adds the ticks to OSTickCtr before it programs the next event : ticks
+*                 already in OSTickCtr are not returned twice (e.g. to OS_SchedEdfRelease()).
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    OS_TICK  ticks;
+    OS_TICK  done;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* Timer not started yet.                               */
+        return (0u);
+    }
+
+    ticks = (OS_TICK)((CPU_INT32U)(OS_CPU_REG_TMR_CNT - OS_CPU_DynTickBase) / OS_CPU_DynTickCnts);
+    if (ticks > OS_CPU_DynTickStep) {                           /* See Note #2.                                         */
+        ticks = OS_CPU_DynTickStep;
+    }
+
+    done = OSTickCtr - OS_CPU_DynTickBaseCtr;                   /* See Note #3.                                         */
+    if (ticks <= done) {
+        return (0u);
+    }
+
+    return (ticks - done);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     SET NEXT DYNAMIC TICK EVENT
+*
+* Description: Program the timer to interrupt 'ticks' ticks after OSTickCtr.
+*
+* Arguments  : ticks        Number of ticks from OSTickCtr to the next event of the tick list, 0 if the
+*                           tick list is empty.
+*
+* Returns    : The number of ticks programmed.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled, right after OSTickCtr is brought up to
+*                 date.
+*
+*              2) The base moves by whole ticks, so the tick boundaries never drift from the timer count.
+*
+*              3) Without an event, or with one beyond the 32-bit timer range, the timer interrupts after
+*                 the longest step it can count : the kernel then catches up & programs the rest.
+*
+*              4) A compare only matches when the counter equals CCR1 : a match already passed while
+*                 programming is forced by software.
+*
+*              5) The interrupt itself is left pending : it may be a match of the microsecond timer, and
+*                 OS_CPU_TmrHandler() ignores an interrupt without a match flag.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    CPU_INT32U  cnts;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* OS_CPU_DynTickInit() programs the first event.       */
+        return (ticks);
+    }
+                                                                /* See Note #2.                                         */
+    OS_CPU_DynTickBase    += (CPU_INT32U)(OSTickCtr - OS_CPU_DynTickBaseCtr) * OS_CPU_DynTickCnts;
+    OS_CPU_DynTickBaseCtr  =  OSTickCtr;
+
+    if ((ticks == 0u) || (ticks > OS_CPU_DynTickMax)) {         /* See Note #3.                                         */
+        ticks = OS_CPU_DynTickMax;
+    }
+    OS_CPU_DynTickStep     =  ticks;
+
+    cnts                   = (CPU_INT32U)ticks * OS_CPU_DynTickCnts;
+    OS_CPU_REG_TMR_SR      = ~OS_CPU_REG_TMR_CC1;               /* Drop a match of the previous event (see Note #5).    */
+    OS_CPU_REG_TMR_CCR1    =  OS_CPU_DynTickBase + cnts;
+
+    if ((CPU_INT32U)(OS_CPU_REG_TMR_CNT - OS_CPU_DynTickBase) >= cnts) {
+        OS_CPU_REG_TMR_EGR = OS_CPU_REG_TMR_CC1;                /* See Note #4.                                         */
+    }
+
+    return (ticks);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            TIMER HANDLER
+*
+* Description: Handle the interrupt of the 32-bit timer shared by the dynamic tick & the microsecond timer
+*              (see 'DYNAMIC TICK DEFINES').
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function MUST be placed on the TIM2 or TIM5 entry of the vector table (see
+*                 'cortex_ports.S').
+*
+*              2) Only the matches whose interrupt is enabled are handled : a stale interrupt, whose flag
+*                 was cleared when the next match was programmed, does nothing.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_TmrHandler (void)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u) || (OS_CFG_TIME_DLY_US_EN > 0u)
+    CPU_INT32U  flags;
+
+
+    flags = OS_CPU_REG_TMR_SR & OS_CPU_REG_TMR_DIER;            /* See Note #2.                                         */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if ((flags & OS_CPU_REG_TMR_CC1) != 0u) {
+        OS_CPU_DynTickHandler();
+    }
+#endif
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    if ((flags & OS_CPU_REG_TMR_CC2) != 0u) {
+        OS_CPU_UsTmrHandler();
+    }
+#endif
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                    INITIALIZE MICROSECOND TIMER
+*
+* Description: Start the timer (see 'DYNAMIC TICK DEFINES') which times OSTimeDlyUs() & the pend timeouts
+*              given in microseconds.
+*
+* Arguments  : tmr_freq     Timer clock frequency : the APB1 timer clock, a multiple of 1 MHz.
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization, before
+*                 the first microsecond delay.  With the dynamic tick, 'tmr_freq' MUST be the same as the
+*                 one given to OS_CPU_DynTickInit().
+*********************************************************************************************************
+*/
+
+void  OS_CPU_UsTmrInit (CPU_INT32U  tmr_freq)
+{
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    (void)OS_CPU_TmrStart(tmr_freq);
+#else
+    (void)tmr_freq;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MICROSECOND TIMER HANDLER
+*
+* Description: Handle the compare match of the microsecond timer : the kernel readies the tasks whose
+*              microsecond delay or timeout expired & programs the next match.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is called by OS_CPU_TmrHandler() on a compare 2 match.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_UsTmrHandler (void)
+{
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+    OS_CPU_REG_TMR_SR = ~OS_CPU_REG_TMR_CC2;                    /* Clear the compare match.                             */
+    CPU_CRITICAL_EXIT();
+
+    OSTimeUsTick();                                             /* Expire the microsecond delays due                    */
+
+    OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                      READ MICROSECOND TIMER
+*
+* Description: Return the free running 32-bit microsecond count.
+*
+* Arguments  : None.
+*
+* Returns    : The timer count, in microseconds.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+CPU_INT32U  OS_UsTmrGet (void)
+{
+    return (OS_CPU_REG_TMR_CNT);
+}
+
+
+/*
+*********************************************************************************************************
+*                                   SET MICROSECOND TIMER MATCH
+*
+* Description: Program compare channel 2 to interrupt when the count reaches 'match'.
+*
+* Arguments  : match        Count at which to interrupt.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled.
+*
+*              2) A compare only matches when the counter equals CCR2 : a match already passed while
+*                 programming is forced by software.
+*********************************************************************************************************
+*/
+
+void  OS_UsTmrSet (CPU_INT32U  match)
+{
+    OS_CPU_REG_TMR_SR    = ~OS_CPU_REG_TMR_CC2;                 /* Drop a match of the previous entry.                  */
+    OS_CPU_REG_TMR_CCR2  =  match;
+    OS_CPU_REG_TMR_DIER |=  OS_CPU_REG_TMR_CC2;
+
+    if ((CPU_INT32S)(OS_CPU_REG_TMR_CNT - match) >= 0) {
+        OS_CPU_REG_TMR_EGR = OS_CPU_REG_TMR_CC2;                /* See Note #2.                                         */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                  STOP MICROSECOND TIMER MATCH
+*
+* Description: Disable the compare 2 interrupt; the timer keeps counting.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Called by the kernel with interrupts disabled.
+*********************************************************************************************************
+*/
+
+void  OS_UsTmrStop (void)
+{
+    OS_CPU_REG_TMR_DIER &= ~OS_CPU_REG_TMR_CC2;
+    OS_CPU_REG_TMR_SR    = ~OS_CPU_REG_TMR_CC2;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_TmrStart()
+*
+* Description: Start the 32-bit timer of the dynamic tick & of the microsecond timer, once.
+*
+* Arguments  : tmr_freq     Timer clock frequency.
+*
+* Returns    : The counting frequency : 1 MHz with the microsecond timer (see 'DYNAMIC TICK DEFINES
+*              Note #2'), else 'tmr_freq'.
+*
+* Note(s)    : 1) The timer interrupt is kernel aware, at the SysTick priority.  Each user enables the
+*                 interrupt of its own compare channel.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u) || (OS_CFG_TIME_DLY_US_EN > 0u)
+static  CPU_INT32U  OS_CPU_TmrStart (CPU_INT32U  tmr_freq)
+{
+    CPU_INT32U  cnt_freq;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (OS_CPU_TmrCntFreq == 0u) {                              /* Not started yet?                                     */
+        OS_CPU_REG_RCC_APB1ENR |= OS_CPU_DYN_TICK_TMR_CLK_EN;   /* Clock the timer.                                     */
+
+        OS_CPU_REG_TMR_CR1      = 0u;
+#if (OS_CFG_TIME_DLY_US_EN > 0u)
+        OS_CPU_REG_TMR_PSC      = (tmr_freq / 1000000u) - 1u;   /* Count microseconds ...                               */
+        OS_CPU_TmrCntFreq       =  1000000u;
+#else
+        OS_CPU_REG_TMR_PSC      = 0u;                           /* Count at the timer clock ...                         */
+        OS_CPU_TmrCntFreq       = tmr_freq;
+#endif
+        OS_CPU_REG_TMR_ARR      = DEF_INT_32U_MAX_VAL;          /* ... over the full 32-bit range.                      */
+        OS_CPU_REG_TMR_EGR      = OS_CPU_REG_TMR_EGR_UG;        /* Load the prescaler.                                  */
+        OS_CPU_REG_TMR_SR       = 0u;
+        OS_CPU_REG_TMR_DIER     = 0u;
+        OS_CPU_REG_TMR_CNT      = 0u;
+        OS_CPU_REG_TMR_CR1      = OS_CPU_REG_TMR_CR1_CEN;       /* Start counting.                                      */
+
+        CPU_IntSrcPrioSet(OS_CPU_DYN_TICK_INT_POS, CPU_CFG_KA_IPL_BOUNDARY, CPU_INT_KA);
+        CPU_IntSrcEn(OS_CPU_DYN_TICK_INT_POS);                  /* See Note #1.                                         */
+    }
+    cnt_freq = OS_CPU_TmrCntFreq;
+    CPU_CRITICAL_EXIT();
+
+    return (cnt_freq);
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif